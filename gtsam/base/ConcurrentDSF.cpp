@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file ConcurrentDSF.cpp
+ * @date October 2026
+ * @brief Lock-free disjoint set forest over integer keys
+ */
+
+#include <gtsam/base/ConcurrentDSF.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+// Link priority of a key: the splitmix64 finalizer, a bijection on 64 bits,
+// so distinct keys never tie and the priorities look random in the keys.
+static uint64_t priority(size_t key) {
+  uint64_t z = static_cast<uint64_t>(key) + 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/* ************************************************************************* */
+ConcurrentDSF::ConcurrentDSF(size_t numNodes) : parent_(numNodes) {
+  for (size_t i = 0; i < numNodes; i++)
+    parent_[i].store(i, memory_order_relaxed);
+}
+
+/* ************************************************************************* */
+size_t ConcurrentDSF::find(size_t key) const {
+  while (true) {
+    size_t parent = parent_[key].load(memory_order_acquire);
+    if (parent == key) return key;
+    const size_t grandParent = parent_[parent].load(memory_order_acquire);
+    // Path halving. If another thread changed parent_[key] first, its value
+    // is at least as good, so a failed CAS is simply ignored.
+    if (parent != grandParent)
+      parent_[key].compare_exchange_weak(parent, grandParent,
+                                         memory_order_acq_rel);
+    key = grandParent;
+  }
+}
+
+/* ************************************************************************* */
+bool ConcurrentDSF::merge(size_t i1, size_t i2) {
+  while (true) {
+    i1 = find(i1);
+    i2 = find(i2);
+    if (i1 == i2) return false;
+    if (priority(i1) > priority(i2)) swap(i1, i2);
+    // Link the root with the lower priority below the other one. This fails
+    // if i1 stopped being a root in the meantime, in which case we look up
+    // the roots again.
+    size_t expected = i1;
+    if (parent_[i1].compare_exchange_strong(expected, i2,
+                                            memory_order_acq_rel))
+      return true;
+  }
+}
+
+/* ************************************************************************* */
+bool ConcurrentDSF::sameSet(size_t i1, size_t i2) const {
+  // Without concurrent merges, a single comparison of the labels suffices.
+  // Otherwise, i1's root might be linked right after we find it, so check
+  // that it is still a root before concluding the sets are different.
+  while (true) {
+    const size_t r1 = find(i1), r2 = find(i2);
+    if (r1 == r2) return true;
+    if (parent_[r1].load(memory_order_acquire) == r1) return false;
+  }
+}
+
+/* ************************************************************************* */
+void ConcurrentDSF::flatten() {
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, parent_.size()),
+                    [this](const tbb::blocked_range<size_t>& range) {
+                      for (size_t i = range.begin(); i != range.end(); ++i)
+                        parent_[i].store(find(i), memory_order_release);
+                    });
+#else
+  for (size_t i = 0; i < parent_.size(); ++i)
+    parent_[i].store(find(i), memory_order_release);
+#endif
+}
+
+/* ************************************************************************* */
+map<size_t, set<size_t> > ConcurrentDSF::sets() const {
+  map<size_t, set<size_t> > sets;
+  for (size_t i = 0; i < parent_.size(); ++i) sets[find(i)].insert(i);
+  return sets;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file ConcurrentDSF.h
+ * @date October 2026
+ * @brief Lock-free disjoint set forest over integer keys
+ */
+
+#pragma once
+
+#include <gtsam/dllexport.h>
+#include <gtsam/global_includes.h>
+
+#include <atomic>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A disjoint set forest over keys 0...numNodes-1, like DSFBase, but safe to
+ * use from many threads at once without locks.
+ *
+ * Parent pointers are atomics. Two sets are linked with a single
+ * compare-and-swap on the root of one of them, retrying if another thread
+ * changed that root in the meantime, and find() does path halving with CAS.
+ *
+ * Roots are linked by randomized priorities: every key has a fixed priority,
+ * a pseudo-random permutation of the keys, and the root with the lower
+ * priority is linked below the other one. This keeps the trees shallow in
+ * expectation, like union by rank, whatever the order of the merges, without
+ * storing a rank that would have to change together with the parent. The
+ * label of a set is its key with the highest priority, so it does not depend
+ * on the order of the merges either, but it is not its smallest key.
+ * @ingroup base
+ */
+class GTSAM_EXPORT ConcurrentDSF {
+ private:
+  mutable std::vector<std::atomic<size_t>> parent_;  ///< parent pointers
+
+ public:
+  /// Constructor that allocates new memory, allows for keys 0...numNodes-1.
+  explicit ConcurrentDSF(size_t numNodes);
+
+  /// Number of keys.
+  size_t size() const { return parent_.size(); }
+
+  /// Find the label of the set in which {key} lives.
+  size_t find(size_t key) const;
+
+  /**
+   * Merge the sets containing i1 and i2, thread-safe.
+   * @return false if i1 and i2 were already in the same set.
+   */
+  bool merge(size_t i1, size_t i2);
+
+  /// Check whether i1 and i2 are in the same set.
+  bool sameSet(size_t i1, size_t i2) const;
+
+  /**
+   * Point every key directly at its label, in parallel if TBB is enabled.
+   * Afterwards, find() takes a single step until the next merge.
+   * This must not be called concurrently with merge().
+   */
+  void flatten();
+
+  /// Return all sets, i.e. a partition of all elements.
+  std::map<size_t, std::set<size_t> > sets() const;
+};
+
+}  // namespace gtsam
@@ -157,4 +157,60 @@ bool choleskyPartial(Matrix& ABC, size_t nFrontal, size_t topleft) {
     return true;
   }
 }
+
+/* ************************************************************************* */
+std::vector<bool> choleskyPartialBatch(double* ABC, size_t n, size_t nFrontal,
+                                       size_t batchSize) {
+  gttic(choleskyPartialBatch);
+  const size_t B = batchSize;
+  auto entry = [&](size_t i, size_t j) { return ABC + (j * n + i) * B; };
+  std::vector<bool> success(B, true);
+  std::vector<double> rowK(n * B);  // row k of all matrices, interleaved
+
+  for (size_t k = 0; k < nFrontal; ++k) {
+    // R(k, k) = sqrt(A(k, k)), failing like LLT on non-positive pivots
+    double* pivot = entry(k, k);
+    for (size_t b = 0; b < B; ++b) {
+      if (!(pivot[b] > 0.0)) {
+        success[b] = false;
+        pivot[b] = 1.0;
+      }
+      pivot[b] = std::sqrt(pivot[b]);
+    }
+
+    // Row k of [R S] is row k of [A B] divided by R(k, k)
+    for (size_t j = k + 1; j < n; ++j) {
+      double* a = entry(k, j);
+      double* r = rowK.data() + j * B;
+      for (size_t b = 0; b < B; ++b) r[b] = a[b] = a[b] / pivot[b];
+    }
+
+    // Rank-1 downdate of the trailing upper triangle
+    for (size_t j = k + 1; j < n; ++j) {
+      const double* rj = rowK.data() + j * B;
+      for (size_t i = k + 1; i <= j; ++i) {
+        const double* ri = rowK.data() + i * B;
+        double* a = entry(i, j);
+        for (size_t b = 0; b < B; ++b) a[b] -= ri[b] * rj[b];
+      }
+    }
+  }
+
+  // Check the last diagonal elements, as choleskyPartial
+  for (size_t b = 0; b < B; ++b) {
+    if (!success[b]) continue;
+    if (nFrontal >= 2) {
+      int exp2, exp1;
+      (void)frexp(entry(nFrontal - 2, nFrontal - 2)[b], &exp2);
+      (void)frexp(entry(nFrontal - 1, nFrontal - 1)[b], &exp1);
+      success[b] = (exp2 - exp1 < underconstrainedExponentDifference);
+    } else if (nFrontal == 1) {
+      int exp1;
+      (void)frexp(entry(0, 0)[b], &exp1);
+      success[b] = (exp1 > -underconstrainedExponentDifference);
+    }
+  }
+  return success;
+}
+
 }  // namespace gtsam
@@ -19,6 +19,8 @@
 
 #include <gtsam/base/Matrix.h>
 
+#include <vector>
+
 namespace gtsam {
 
 /**
@@ -61,5 +63,18 @@ GTSAM_EXPORT std::pair<size_t,bool> choleskyCareful(Matrix& ATA, int order = -1)
  */
 GTSAM_EXPORT bool choleskyPartial(Matrix& ABC, size_t nFrontal, size_t topleft=0);
 
+/**
+ * choleskyPartial of a batch of matrices of the same size n x n, with the same
+ * nFrontal. The matrices are interleaved: entry (i, j) of matrix k is
+ * ABC[(j * n + i) * batchSize + k], so that the innermost loops run over the
+ * batch with unit stride and vectorize, which pays off for many small
+ * matrices. Only the upper triangles are read and written.
+ *
+ * @return for each matrix, the result choleskyPartial would return
+ */
+GTSAM_EXPORT std::vector<bool> choleskyPartialBatch(double* ABC, size_t n,
+                                                    size_t nFrontal,
+                                                    size_t batchSize);
+
 }
 
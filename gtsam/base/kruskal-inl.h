@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include <gtsam/base/DSFMap.h>
+#include <gtsam/base/ConcurrentDSF.h>
 #include <gtsam/base/FastMap.h>
 #include <gtsam/base/types.h>
 #include <gtsam/inference/VariableIndex.h>
@@ -72,8 +72,15 @@ std::vector<size_t> kruskal(const FactorGraph<FACTOR> &fg,
   std::vector<size_t> treeIndices;
   treeIndices.reserve(n - 1);
 
-  // Initialize disjoint-set forest to keep track of merged Keys.
-  DSFMap<Key> dsf;
+  // Number the Keys densely, in sorted order, so the disjoint-set forest that
+  // keeps track of merged Keys can be a flat array.
+  KeyVector keys;
+  keys.reserve(n);
+  for (const auto &key_factors : variableIndex) keys.push_back(key_factors.first);
+  auto indexOf = [&keys](Key key) {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+  };
+  ConcurrentDSF dsf(n);
 
   // Loop over all edges in order of increasing weight.
   size_t count = 0;
@@ -83,16 +90,10 @@ std::vector<size_t> kruskal(const FactorGraph<FACTOR> &fg,
     // Ignore non-binary edges.
     if (factor->size() != 2) continue;
 
-    // Find the representatives of the sets for both the Keys in the binary
-    // factor.
-    const auto u = dsf.find(factor->front()), v = dsf.find(factor->back());
-
-    // Check if there is a potential loop.
-    const bool loop = (u == v);
-    if (!loop) {
-      // Merge the sets.
-      dsf.merge(u, v);
-
+    // Merge the sets of both the Keys in the binary factor, unless they are
+    // already the same set, which would create a loop.
+    const size_t u = indexOf(factor->front()), v = indexOf(factor->back());
+    if (dsf.merge(u, v)) {
       // Add the current index to the tree.
       treeIndices.push_back(index);
 
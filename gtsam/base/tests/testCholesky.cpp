@@ -66,6 +66,44 @@ TEST(cholesky, choleskyPartial) {
   EXPECT(assert_equal(expected, actual, 1e-9));
 }
 
+/* ************************************************************************* */
+TEST(cholesky, choleskyPartialBatch) {
+  Matrix ABC = (Matrix(7,7) <<
+                      4.0375,   3.4584,   3.5735,   2.4815,   2.1471,   2.7400,   2.2063,
+                          0.,   4.7267,   3.8423,   2.3624,   2.8091,   2.9579,   2.5914,
+                          0.,       0.,   5.1600,   2.0797,   3.4690,   3.2419,   2.9992,
+                          0.,       0.,       0.,   1.8786,   1.0535,   1.4250,   1.3347,
+                          0.,       0.,       0.,       0.,   3.0788,   2.6283,   2.3791,
+                          0.,       0.,       0.,       0.,       0.,   2.9227,   2.4056,
+                          0.,       0.,       0.,       0.,       0.,       0.,   2.5776).finished();
+
+  // A batch of four matrices, the last one not positive definite
+  const size_t n = 7, B = 4;
+  std::vector<Matrix> matrices{ABC, ABC + 2 * Matrix::Identity(n, n), 3 * ABC,
+                               ABC};
+  matrices[3](1, 1) = -1.0;
+  std::vector<double> interleaved(n * n * B);
+  for (size_t b = 0; b < B; ++b)
+    for (size_t j = 0; j < n; ++j)
+      for (size_t i = 0; i <= j; ++i)
+        interleaved[(j * n + i) * B + b] = matrices[b](i, j);
+
+  const std::vector<bool> success =
+      choleskyPartialBatch(interleaved.data(), n, 3, B);
+  for (size_t b = 0; b < B; ++b) {
+    Matrix expected = matrices[b];
+    EXPECT(success[b] == choleskyPartial(expected, 3));
+    if (!success[b]) continue;
+    Matrix actual = Matrix::Zero(n, n);
+    for (size_t j = 0; j < n; ++j)
+      for (size_t i = 0; i <= j; ++i)
+        actual(i, j) = interleaved[(j * n + i) * B + b];
+    expected.triangularView<Eigen::StrictlyLower>().setZero();
+    EXPECT(assert_equal(expected, actual, 1e-9));
+  }
+  EXPECT(!success[3]);
+}
+
 /* ************************************************************************* */
 TEST(cholesky, BadScalingCholesky) {
   Matrix A = (Matrix(2,2) <<
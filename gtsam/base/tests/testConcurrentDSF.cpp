@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testConcurrentDSF.cpp
+ * @date October 2026
+ * @brief unit tests for the lock-free DSF
+ */
+
+#include <gtsam/base/ConcurrentDSF.h>
+#include <gtsam/base/DSFVector.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+TEST(ConcurrentDSF, merge) {
+  ConcurrentDSF dsf(4);
+  EXPECT(dsf.merge(3, 1));
+  EXPECT(dsf.merge(2, 3));
+  EXPECT(!dsf.merge(1, 2));  // already in the same set
+  EXPECT(dsf.sameSet(1, 2));
+  EXPECT(!dsf.sameSet(0, 2));
+
+  // Every set has one label, whatever the order of the merges.
+  const size_t label = dsf.find(1);
+  EXPECT(label == 1 || label == 2 || label == 3);
+  LONGS_EQUAL(label, dsf.find(2));
+  LONGS_EQUAL(label, dsf.find(3));
+  LONGS_EQUAL(0, dsf.find(0));
+  ConcurrentDSF other(4);
+  other.merge(1, 2);
+  other.merge(3, 2);
+  LONGS_EQUAL(label, other.find(1));
+
+  map<size_t, set<size_t> > expected{{0, {0}}, {label, {1, 2, 3}}};
+  EXPECT(expected == dsf.sets());
+}
+
+/* ************************************************************************* */
+// Merging a chain from its end, the worst case for linking roots by key,
+// still gives a single set with a single label.
+TEST(ConcurrentDSF, chain) {
+  const size_t n = 1000;
+  ConcurrentDSF dsf(n);
+  for (size_t k = n - 1; k-- > 0;) EXPECT(dsf.merge(k, k + 1));
+  const size_t label = dsf.find(0);
+  bool same = true;
+  for (size_t k = 0; k < n; k++) same = same && dsf.find(k) == label;
+  EXPECT(same);
+  LONGS_EQUAL(1, dsf.sets().size());
+}
+
+/* ************************************************************************* */
+// Merge random pairs from several threads, compare with DSFVector.
+TEST(ConcurrentDSF, threads) {
+  const size_t n = 10000, m = 8000, nrThreads = 4;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> key(0, n - 1);
+  vector<pair<size_t, size_t> > pairs;
+  for (size_t k = 0; k < m; k++) pairs.emplace_back(key(rng), key(rng));
+
+  DSFVector expected(n);
+  for (const auto& [i1, i2] : pairs) expected.merge(i1, i2);
+
+  ConcurrentDSF dsf(n);
+  vector<thread> threads;
+  for (size_t t = 0; t < nrThreads; t++) {
+    threads.emplace_back([&, t]() {
+      for (size_t k = t; k < m; k += nrThreads)
+        dsf.merge(pairs[k].first, pairs[k].second);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  dsf.flatten();
+
+  // Same partition, and the same labels as merging on a single thread.
+  ConcurrentDSF sequential(n);
+  for (const auto& [i1, i2] : pairs) sequential.merge(i1, i2);
+  bool same = true;
+  for (size_t i = 0; i < n; i++) {
+    same = same && dsf.sameSet(i, expected.find(i)) &&
+           dsf.find(i) == sequential.find(i);
+    for (size_t j : {size_t(0), i / 2})
+      same = same &&
+             dsf.sameSet(i, j) == (expected.find(i) == expected.find(j));
+  }
+  EXPECT(same);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -54,7 +54,14 @@ DiscreteValues DiscreteBayesNet::sample() const {
   return sample(result);
 }
 
+/* ************************************************************************* */
 DiscreteValues DiscreteBayesNet::sample(DiscreteValues result) const {
+  return sample(result, nullptr);
+}
+
+/* ************************************************************************* */
+DiscreteValues DiscreteBayesNet::sample(DiscreteValues result,
+                                        std::mt19937_64* rng) const {
   // sample each node in turn in topological sort order (parents first)
   for (auto it = std::make_reverse_iterator(end());
        it != std::make_reverse_iterator(begin()); ++it) {
@@ -62,7 +69,10 @@ DiscreteValues DiscreteBayesNet::sample(DiscreteValues result) const {
     // Sample the conditional only if value for j not already in result
     const Key j = conditional->firstFrontalKey();
     if (result.count(j) == 0) {
-      conditional->sampleInPlace(&result);
+      if (rng)
+        conditional->sampleInPlace(&result, rng);
+      else
+        conditional->sampleInPlace(&result);
     }
   }
   return result;
@@ -124,6 +124,16 @@ class GTSAM_EXPORT DiscreteBayesNet: public BayesNet<DiscreteConditional> {
      */
     DiscreteValues sample(DiscreteValues given) const;
 
+    /**
+     * @brief do ancestral sampling, given certain variables, using the given
+     * random number generator.
+     *
+     * @param rng random number generator, or nullptr to use the default one of
+     * DiscreteConditional::sample, as sample(given) does.
+     * @return given values extended with sampled value for all other variables.
+     */
+    DiscreteValues sample(DiscreteValues given, std::mt19937_64* rng) const;
+
     ///@}
     /// @name Wrapper support
     /// @{
@@ -0,0 +1,293 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteBranchAndBound.cpp
+ * @brief Anytime branch-and-bound MPE solver with mini-bucket heuristics
+ * @date October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+#include <gtsam/discrete/DiscreteBranchAndBound.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+namespace gtsam {
+
+namespace {
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+// Depth marker for messages without scope, which count from the root on.
+constexpr size_t kRoot = std::numeric_limits<size_t>::max();
+
+// Scale f to a maximum of 1 and return the log of the scale.
+double Normalize(DecisionTreeFactor* f) {
+  const double max = static_cast<const AlgebraicDecisionTree<Key>&>(*f).max();
+  if (max > 0 && max != 1.0)
+    *f = f->apply([max](const double& x) { return x / max; });
+  return std::log(max);
+}
+}  // namespace
+
+/* ************************************************************************ */
+DiscreteBranchAndBound::DiscreteBranchAndBound(const DiscreteFactorGraph& graph,
+                                               const Parameters& params)
+    : params_(params) {
+  gttic(DiscreteBranchAndBound_MiniBuckets);
+  // Search order is the reverse of the elimination order.
+  if (params.ordering) {
+    order_.assign(params.ordering->begin(), params.ordering->end());
+  } else {
+    const Ordering elimination = Ordering::Colamd(graph);
+    order_.assign(elimination.rbegin(), elimination.rend());
+  }
+  const size_t n = order_.size();
+  std::map<Key, size_t> position;
+  for (size_t i = 0; i < n; i++) position[order_[i]] = i;
+  cardinalities_.resize(n);
+  for (const DiscreteKey& dkey : graph.discreteKeys())
+    cardinalities_[position.at(dkey.first)] = dkey.second;
+
+  // Depth after which all keys of f are assigned, or kRoot if none.
+  auto lastPosition = [&](const DecisionTreeFactor& f) {
+    size_t last = kRoot;
+    for (Key key : f.keys()) {
+      const size_t p = position.at(key);
+      if (last == kRoot || p > last) last = p;
+    }
+    return last;
+  };
+
+  // Place the input factors in the bucket of their last variable.
+  std::vector<std::vector<Function>> buckets(n);
+  for (const auto& factor : graph) {
+    if (!factor) continue;
+    Function f{factor->toDecisionTreeFactor(), 0.0, kRoot, kRoot};
+    f.logScale = Normalize(&f.factor);
+    f.evaluatedAt = lastPosition(f.factor);
+    if (f.evaluatedAt == kRoot) {
+      constant_ += f.logScale;
+    } else {
+      buckets[f.evaluatedAt].push_back(f);
+      factors_.push_back(f);
+    }
+  }
+
+  // Mini-bucket elimination from the last variable in the search order.
+  for (size_t j = n; j-- > 0;) {
+    std::vector<Function>& bucket = buckets[j];
+    std::sort(bucket.begin(), bucket.end(),
+              [](const Function& a, const Function& b) {
+                return a.factor.size() > b.factor.size();
+              });
+    // Greedily partition into mini-buckets with at most iBound variables.
+    std::vector<std::pair<KeySet, std::vector<const Function*>>> miniBuckets;
+    for (const Function& f : bucket) {
+      bool placed = false;
+      for (auto& [scope, functions] : miniBuckets) {
+        KeySet merged = scope;
+        merged.insert(f.factor.keys().begin(), f.factor.keys().end());
+        if (merged.size() <= params.iBound) {
+          scope = merged;
+          functions.push_back(&f);
+          placed = true;
+          break;
+        }
+      }
+      if (!placed)
+        miniBuckets.emplace_back(
+            KeySet(f.factor.keys().begin(), f.factor.keys().end()),
+            std::vector<const Function*>{&f});
+    }
+
+    // Maximize every mini-bucket over the bucket variable.
+    for (const auto& [scope, functions] : miniBuckets) {
+      DecisionTreeFactor product = functions.front()->factor;
+      double logScale = functions.front()->logScale;
+      for (size_t k = 1; k < functions.size(); k++) {
+        product = product * functions[k]->factor;
+        logScale += functions[k]->logScale;
+      }
+      Function message{
+          product.max(Ordering{order_[j]})->toDecisionTreeFactor(), 0.0,
+          kRoot, j};
+      message.logScale = logScale + Normalize(&message.factor);
+      message.evaluatedAt = lastPosition(message.factor);
+      if (message.evaluatedAt != kRoot)
+        buckets[message.evaluatedAt].push_back(message);
+      messages_.push_back(message);
+    }
+  }
+
+  // Index what changes in the bound when the variable at a depth is assigned.
+  factorsAt_.resize(n);
+  addedAt_.resize(n);
+  removedAt_.resize(n);
+  for (size_t i = 0; i < factors_.size(); i++)
+    factorsAt_[factors_[i].evaluatedAt].push_back(i);
+  for (size_t i = 0; i < messages_.size(); i++) {
+    if (messages_[i].evaluatedAt != kRoot)
+      addedAt_[messages_[i].evaluatedAt].push_back(i);
+    removedAt_[messages_[i].removedAt].push_back(i);
+  }
+}
+
+/* ************************************************************************ */
+double DiscreteBranchAndBound::upperBound() const {
+  double bound = constant_;
+  for (const Function& message : messages_)
+    if (message.evaluatedAt == kRoot) bound += message.logScale;
+  return bound;
+}
+
+/* ************************************************************************ */
+double DiscreteBranchAndBound::delta(size_t depth,
+                                     const DiscreteValues& x) const {
+  auto logValue = [&x](const Function& f) {
+    return std::log(f.factor(x)) + f.logScale;
+  };
+  double result = 0.0;
+  for (size_t i : factorsAt_[depth]) result += logValue(factors_[i]);
+  for (size_t i : addedAt_[depth]) result += logValue(messages_[i]);
+  // The mini-bucket estimate of this variable is replaced by exact values.
+  for (size_t i : removedAt_[depth]) result -= logValue(messages_[i]);
+  return result;
+}
+
+/* ************************************************************************ */
+// Search state shared by all threads.
+struct DiscreteBranchAndBound::Search {
+  const DiscreteBranchAndBound& bb;
+  const std::chrono::steady_clock::time_point deadline;
+  const bool hasDeadline;
+
+  std::atomic<double> best{-kInfinity};
+  std::mutex mutex;  // protects incumbent
+  DiscreteValues incumbent;
+  std::atomic<size_t> nrExpanded{0};
+  std::atomic<bool> stopped{false};
+
+  explicit Search(const DiscreteBranchAndBound& bb)
+      : bb(bb),
+        deadline(std::chrono::steady_clock::now() +
+                 std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                     std::chrono::duration<double>(bb.params_.timeBudget))),
+        hasDeadline(bb.params_.timeBudget > 0) {}
+
+  // Check the clock every so often.
+  bool timeUp(size_t expanded) {
+    if (stopped) return true;
+    if (hasDeadline && expanded % 256 == 0 &&
+        std::chrono::steady_clock::now() > deadline)
+      stopped = true;
+    return stopped;
+  }
+
+  void offer(const DiscreteValues& x, double logProbability) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (logProbability > best) {
+      best = logProbability;
+      incumbent = x;
+    }
+  }
+
+  // Children of a node with their bounds, best first, without dead ends.
+  std::vector<std::pair<double, size_t>> children(size_t depth,
+                                                  DiscreteValues* x,
+                                                  double bound) const {
+    const Key key = bb.order_[depth];
+    std::vector<std::pair<double, size_t>> result;
+    for (size_t v = 0; v < bb.cardinalities_[depth]; v++) {
+      (*x)[key] = v;
+      const double b = bound + bb.delta(depth, *x);
+      if (b > -kInfinity) result.emplace_back(b, v);
+    }
+    x->erase(key);
+    std::sort(result.begin(), result.end(),
+              [](const std::pair<double, size_t>& a,
+                 const std::pair<double, size_t>& b) { return a.first > b.first; });
+    return result;
+  }
+
+  // Depth-first search below a node with the given bound.
+  void expand(size_t depth, DiscreteValues* x, double bound) {
+    if (bound <= best || timeUp(++nrExpanded)) return;
+    if (depth == bb.order_.size()) {
+      offer(*x, bound);  // bound is exact for complete assignments
+      return;
+    }
+    const Key key = bb.order_[depth];
+    for (auto&& [b, v] : children(depth, x, bound)) {
+      if (b <= best) break;  // children are sorted, none of the rest can win
+      (*x)[key] = v;
+      expand(depth + 1, x, b);
+      if (stopped) break;
+    }
+    x->erase(key);
+  }
+};
+
+/* ************************************************************************ */
+DiscreteBranchAndBound::Result DiscreteBranchAndBound::solve() const {
+  gttic(DiscreteBranchAndBound_solve);
+  Search search(*this);
+  const size_t n = order_.size();
+
+  // Split the search tree breadth-first into subproblems.
+  struct Node {
+    DiscreteValues x;
+    double bound;
+  };
+  std::vector<Node> frontier{{DiscreteValues(), upperBound()}};
+  size_t depth = 0;
+  while (depth < n && frontier.size() < params_.nrSubproblems &&
+         !frontier.empty()) {
+    std::vector<Node> next;
+    for (Node& node : frontier) {
+      for (auto&& [b, v] : search.children(depth, &node.x, node.bound)) {
+        Node child{node.x, b};
+        child.x[order_[depth]] = v;
+        next.push_back(std::move(child));
+      }
+    }
+    frontier = std::move(next);
+    ++depth;
+  }
+  std::sort(frontier.begin(), frontier.end(),
+            [](const Node& a, const Node& b) { return a.bound > b.bound; });
+
+  // Search below all subproblems, most promising first.
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, frontier.size(), 1),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      for (size_t i = range.begin(); i != range.end(); ++i) {
+                        DiscreteValues x = frontier[i].x;
+                        search.expand(depth, &x, frontier[i].bound);
+                      }
+                    });
+#else
+  for (Node& node : frontier) search.expand(depth, &node.x, node.bound);
+#endif
+
+  return {search.incumbent, search.best, upperBound(), !search.stopped,
+          search.nrExpanded};
+}
+
+}  // namespace gtsam
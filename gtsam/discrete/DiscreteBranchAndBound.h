@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteBranchAndBound.h
+ * @brief Anytime branch-and-bound MPE solver with mini-bucket heuristics
+ * @date October 2026
+ */
+
+#pragma once
+
+#include <gtsam/discrete/DecisionTreeFactor.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/discrete/DiscreteValues.h>
+#include <gtsam/inference/Ordering.h>
+
+#include <optional>
+#include <vector>
+
+namespace gtsam {
+
+/// Parameters for DiscreteBranchAndBound.
+struct GTSAM_EXPORT DiscreteBranchAndBoundParameters {
+  /// Maximum number of variables in a mini-bucket.
+  size_t iBound = 6;
+  /// Time budget in seconds, 0 means search until optimality is proven.
+  double timeBudget = 0.0;
+  /// Search order, defaults to the reverse of a COLAMD elimination ordering.
+  std::optional<Ordering> ordering;
+  /// Number of parallel subproblems to aim for, 0 means sequential search.
+  size_t nrSubproblems = 64;
+};
+
+/**
+ * @brief Depth-first branch-and-bound search for the most probable
+ * explanation (MPE) of a DiscreteFactorGraph.
+ *
+ * DiscreteFactorGraph::optimize does exact max-product elimination, which
+ * needs tables exponential in the tree width. This solver instead searches
+ * over assignments, and prunes partial assignments whose upper bound on the
+ * probability cannot beat the best solution found so far. The bounds come
+ * from mini-bucket elimination (MBE): every bucket is split into mini-buckets
+ * of at most `iBound` variables, which are maximized separately. With a large
+ * enough `iBound` MBE is exact and the search needs no backtracking.
+ *
+ * The search is anytime: it returns the best assignment found when the time
+ * budget runs out, and reports whether that assignment is provably optimal.
+ * When GTSAM is built with TBB, the subtrees below the first few variables
+ * are searched in parallel, sharing the incumbent solution.
+ *
+ * Example:
+ *   DiscreteBranchAndBound::Parameters params;
+ *   params.timeBudget = 0.05;  // seconds
+ *   auto result = DiscreteBranchAndBound(graph, params).solve();
+ *
+ * @ingroup discrete
+ */
+class GTSAM_EXPORT DiscreteBranchAndBound {
+ public:
+  using Parameters = DiscreteBranchAndBoundParameters;
+
+  /// Result of the search.
+  struct Result {
+    DiscreteValues assignment;  ///< best assignment found
+    double logProbability;      ///< log of the unnormalized probability
+    double upperBound;          ///< log upper bound from mini-buckets
+    bool optimal;               ///< true if the search space was exhausted
+    size_t nrExpanded;          ///< number of search nodes expanded
+  };
+
+ private:
+  /// A table in the search, either an input factor or a mini-bucket message.
+  struct Function {
+    DecisionTreeFactor factor;  ///< normalized table
+    double logScale;            ///< log of the factor's normalization
+    size_t evaluatedAt;         ///< depth at which the scope is assigned
+    size_t removedAt;           ///< depth at which the message expires
+  };
+
+  Parameters params_;
+  KeyVector order_;                   ///< search order
+  std::vector<size_t> cardinalities_; ///< cardinality per search depth
+  std::vector<Function> factors_;     ///< input factors
+  std::vector<Function> messages_;    ///< mini-bucket messages
+  double constant_ = 0.0;             ///< messages with empty scope
+
+  /// Per depth, indices into factors_ and messages_ that change the bound.
+  std::vector<std::vector<size_t>> factorsAt_, addedAt_, removedAt_;
+
+ public:
+  /// Construct from a factor graph, runs mini-bucket elimination.
+  DiscreteBranchAndBound(const DiscreteFactorGraph& graph,
+                         const Parameters& params = Parameters());
+
+  /// Log upper bound on the probability of the MPE, from mini-buckets.
+  double upperBound() const;
+
+  /// Run the search.
+  Result solve() const;
+
+ private:
+  struct Search;  // search state, defined in the .cpp file
+
+  /// Change in log bound when the variable at `depth` is assigned.
+  double delta(size_t depth, const DiscreteValues& x) const;
+};
+
+}  // namespace gtsam
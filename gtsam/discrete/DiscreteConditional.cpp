@@ -261,27 +261,9 @@ size_t DiscreteConditional::argmax(const DiscreteValues& parentsValues) const {
 }
 
 /* ************************************************************************** */
-void DiscreteConditional::sampleInPlace(DiscreteValues* values) const {
-  // throw if more than one frontal:
-  if (nrFrontals() != 1) {
-    throw std::invalid_argument(
-        "DiscreteConditional::sampleInPlace can only be called on single "
-        "variable conditionals");
-  }
-  Key j = firstFrontalKey();
-  // throw if values already contains j:
-  if (values->count(j) > 0) {
-    throw std::invalid_argument(
-        "DiscreteConditional::sampleInPlace: values already contains j");
-  }
-  size_t sampled = sample(*values);  // Sample variable given parents
-  (*values)[j] = sampled;            // store result in partial solution
-}
-
-/* ************************************************************************** */
-size_t DiscreteConditional::sample(const DiscreteValues& parentsValues) const {
-  static mt19937 rng(2);  // random number generator
-
+template <class RNG>
+size_t DiscreteConditional::sampleWith(const DiscreteValues& parentsValues,
+                                       RNG& rng) const {
   // Get the correct conditional distribution
   ADT pFS = choose(parentsValues, true);  // P(F|S=parentsValues)
 
@@ -306,6 +288,51 @@ size_t DiscreteConditional::sample(const DiscreteValues& parentsValues) const {
   return distribution(rng);
 }
 
+/* ************************************************************************** */
+// The single frontal key to sample in place, which must not be in values yet.
+static Key sampleInPlaceKey(const DiscreteConditional& conditional,
+                            const DiscreteValues& values) {
+  // throw if more than one frontal:
+  if (conditional.nrFrontals() != 1) {
+    throw std::invalid_argument(
+        "DiscreteConditional::sampleInPlace can only be called on single "
+        "variable conditionals");
+  }
+  Key j = conditional.firstFrontalKey();
+  // throw if values already contains j:
+  if (values.count(j) > 0) {
+    throw std::invalid_argument(
+        "DiscreteConditional::sampleInPlace: values already contains j");
+  }
+  return j;
+}
+
+/* ************************************************************************** */
+void DiscreteConditional::sampleInPlace(DiscreteValues* values) const {
+  Key j = sampleInPlaceKey(*this, *values);
+  size_t sampled = sample(*values);  // Sample variable given parents
+  (*values)[j] = sampled;            // store result in partial solution
+}
+
+/* ************************************************************************** */
+void DiscreteConditional::sampleInPlace(DiscreteValues* values,
+                                        std::mt19937_64* rng) const {
+  Key j = sampleInPlaceKey(*this, *values);
+  (*values)[j] = sample(*values, rng);
+}
+
+/* ************************************************************************** */
+size_t DiscreteConditional::sample(const DiscreteValues& parentsValues) const {
+  static mt19937 rng(2);  // random number generator
+  return sampleWith(parentsValues, rng);
+}
+
+/* ************************************************************************** */
+size_t DiscreteConditional::sample(const DiscreteValues& parentsValues,
+                                   std::mt19937_64* rng) const {
+  return sampleWith(parentsValues, *rng);
+}
+
 /* ************************************************************************** */
 size_t DiscreteConditional::sample(size_t parent_value) const {
   if (nrParents() != 1)
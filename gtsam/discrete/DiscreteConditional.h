@@ -23,6 +23,7 @@
 #include <gtsam/inference/Conditional-inst.h>
 
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -201,6 +202,15 @@ class GTSAM_EXPORT DiscreteConditional
    */
   size_t sample(const DiscreteValues& parentsValues) const;
 
+  /**
+   * sample using the given random number generator
+   * @param parentsValues Known values of the parents
+   * @param rng random number generator
+   * @return sample from conditional
+   */
+  size_t sample(const DiscreteValues& parentsValues,
+                std::mt19937_64* rng) const;
+
   /// Single parent version.
   size_t sample(size_t parent_value) const;
 
@@ -221,6 +231,9 @@ class GTSAM_EXPORT DiscreteConditional
   /// sample in place, stores result in partial solution
   void sampleInPlace(DiscreteValues* parentsValues) const;
 
+  /// sample in place with given random number generator
+  void sampleInPlace(DiscreteValues* parentsValues, std::mt19937_64* rng) const;
+
   /// Return all assignments for frontal variables.
   std::vector<DiscreteValues> frontalAssignments() const;
 
@@ -274,6 +287,10 @@ class GTSAM_EXPORT DiscreteConditional
   DiscreteConditional::ADT choose(const DiscreteValues& given,
                                   bool forceComplete) const;
 
+  /// Internal version of sample, templated on the random number engine.
+  template <class RNG>
+  size_t sampleWith(const DiscreteValues& parentsValues, RNG& rng) const;
+
  private:
 #if GTSAM_ENABLE_BOOST_SERIALIZATION
   /** Serialization function */
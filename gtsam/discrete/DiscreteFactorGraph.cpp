@@ -23,6 +23,7 @@
 #include <gtsam/discrete/DiscreteFactorGraph.h>
 #include <gtsam/discrete/DiscreteJunctionTree.h>
 #include <gtsam/discrete/DiscreteLookupDAG.h>
+#include <gtsam/discrete/TableFactor.h>
 #include <gtsam/inference/EliminateableFactorGraph-inst.h>
 #include <gtsam/inference/FactorGraph-inst.h>
 
@@ -247,6 +248,59 @@ namespace gtsam {
     return {conditional, sum};
   }
 
+  /* ************************************************************************ */
+  /**
+   * @brief Multiply all the `factors` as TableFactors, and normalize.
+   *
+   * @param factors The factors to multiply as a DiscreteFactorGraph.
+   * @return TableFactor
+   */
+  static TableFactor TableProduct(const DiscreteFactorGraph& factors) {
+    gttic(product);
+    TableFactor product;
+    for (auto&& factor : factors) {
+      if (!factor) continue;
+      if (auto tf = std::dynamic_pointer_cast<TableFactor>(factor)) {
+        product = product * (*tf);
+      } else {
+        product = product * TableFactor(factor->toDecisionTreeFactor());
+      }
+    }
+    gttoc(product);
+
+    // Normalize the product factor to prevent underflow.
+    auto denominator = product.combine(product.size(), Ring::max);
+    return product / (*denominator);
+  }
+
+  /* ************************************************************************ */
+  std::pair<DiscreteConditional::shared_ptr, DiscreteFactor::shared_ptr>  //
+  EliminateDiscreteTable(const DiscreteFactorGraph& factors,
+                         const Ordering& frontalKeys) {
+    const TableFactor product = TableProduct(factors);
+
+    // sum out frontals, this is the factor on the separator
+    gttic(sum);
+    TableFactor::shared_ptr sum = product.combine(frontalKeys, Ring::add);
+    gttoc(sum);
+
+    // Ordering keys for the conditional so that frontalKeys are really in front
+    DiscreteKeys orderedKeys;
+    for (auto&& key : frontalKeys)
+      orderedKeys.emplace_back(key, product.cardinality(key));
+    for (auto&& key : sum->keys())
+      orderedKeys.emplace_back(key, product.cardinality(key));
+
+    // now divide product/sum to get conditional, still sparse
+    gttic(divide);
+    const TableFactor quotient = product / (*sum);
+    auto conditional = std::make_shared<DiscreteConditional>(
+        frontalKeys.size(), orderedKeys, quotient.toDecisionTreeFactor());
+    gttoc(divide);
+
+    return {conditional, sum};
+  }
+
   /* ************************************************************************ */
   string DiscreteFactorGraph::markdown(
       const KeyFormatter& keyFormatter,
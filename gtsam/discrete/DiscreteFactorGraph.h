@@ -66,6 +66,26 @@ std::pair<DiscreteConditional::shared_ptr, DiscreteFactor::shared_ptr>
 EliminateForMPE(const DiscreteFactorGraph& factors,
                 const Ordering& frontalKeys);
 
+/**
+ * @brief Elimination function that keeps all intermediate factors sparse.
+ *
+ * The product, the marginalization and the normalization are done on
+ * TableFactors, and the separator factor is returned as a TableFactor so that
+ * the next elimination steps stay sparse as well. Only the conditional is
+ * converted to a decision tree. On problems where most assignments have zero
+ * probability, e.g., constraint satisfaction problems, this is much faster
+ * than EliminateDiscrete.
+ *
+ * @param factors The factor graph to eliminate.
+ * @param frontalKeys An ordering for which variables to eliminate.
+ * @return A pair of the resulting conditional and the separator TableFactor.
+ * @ingroup discrete
+ */
+GTSAM_EXPORT
+std::pair<DiscreteConditional::shared_ptr, DiscreteFactor::shared_ptr>
+EliminateDiscreteTable(const DiscreteFactorGraph& factors,
+                       const Ordering& frontalKeys);
+
 template<> struct EliminationTraits<DiscreteFactorGraph>
 {
   typedef DiscreteFactor FactorType;                   ///< Type of factors in factor graph
@@ -22,6 +22,7 @@
 #include <gtsam/discrete/TableFactor.h>
 #include <gtsam/hybrid/HybridValues.h>
 
+#include <numeric>
 #include <utility>
 
 using namespace std;
@@ -251,7 +252,8 @@ double TableFactor::error(const HybridValues& values) const {
 
 /* ************************************************************************ */
 DecisionTreeFactor TableFactor::operator*(const DecisionTreeFactor& f) const {
-  return toDecisionTreeFactor() * f;
+  // Multiply sparsely, and only convert the product.
+  return apply(TableFactor(f), Ring::mul).toDecisionTreeFactor();
 }
 
 /* ************************************************************************ */
@@ -434,31 +436,85 @@ TableFactor TableFactor::apply(const TableFactor& f, Binary op) const {
     return f;
   else if (f.keys_.empty() && f.sparse_table_.nonZeros() == 0)
     return *this;
-  // 1. Identify keys for contract and free modes.
+  // 1. Identify keys for contract and union modes.
   DiscreteKeys contract_dkeys = contractDkeys(f);
   DiscreteKeys f_free_dkeys = f.freeDkeys(*this);
   DiscreteKeys union_dkeys = unionDkeys(f);
-  // 2. Create hash table for input factor f
-  unordered_map<uint64_t, AssignValList> map_f =
-      f.createMap(contract_dkeys, f_free_dkeys);
-  // 3. Initialize multiplied factor.
+  // 2. Index every nonzero by its contract assignment (the join key) and by
+  // its contribution to the index in the result. The contract modes are
+  // accounted for by this factor only.
+  const Strides contract_strides = ComputeStrides(contract_dkeys);
+  const Strides union_strides = ComputeStrides(union_dkeys);
+  Strides this_out_strides, f_out_strides;
+  for (auto&& [key, stride] : union_strides) {
+    if (cardinalities_.count(key)) this_out_strides.emplace_back(key, stride);
+  }
+  for (auto&& dkey : f_free_dkeys) {
+    auto it = std::find_if(
+        union_strides.begin(), union_strides.end(),
+        [&](const std::pair<Key, uint64_t>& ks) { return ks.first == dkey.first; });
+    f_out_strides.push_back(*it);
+  }
+  const vector<uint64_t> this_join = projectIndices(contract_strides),
+                         this_out = projectIndices(this_out_strides),
+                         f_join = f.projectIndices(contract_strides),
+                         f_out = f.projectIndices(f_out_strides);
+  // 3. Sort both sides on the join key.
+  auto sortedOrder = [](const vector<uint64_t>& join) {
+    vector<size_t> order(join.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t i, size_t j) { return join[i] < join[j]; });
+    return order;
+  };
+  const vector<size_t> this_order = sortedOrder(this_join),
+                       f_order = sortedOrder(f_join);
+  const double* this_values = sparse_table_.valuePtr();
+  const double* f_values = f.sparse_table_.valuePtr();
+  // 4. Merge join: combine every pair of entries that agree on the contract
+  // modes.
+  vector<pair<uint64_t, double>> entries;
+  entries.reserve(std::max(this_order.size(), f_order.size()));
+  size_t i = 0, j = 0;
+  while (i < this_order.size() && j < f_order.size()) {
+    const uint64_t this_key = this_join[this_order[i]],
+                   f_key = f_join[f_order[j]];
+    if (this_key < f_key) {
+      ++i;
+    } else if (f_key < this_key) {
+      ++j;
+    } else {
+      // Find the end of both runs with the same join key.
+      size_t i_end = i, j_end = j;
+      while (i_end < this_order.size() && this_join[this_order[i_end]] == this_key)
+        ++i_end;
+      while (j_end < f_order.size() && f_join[f_order[j_end]] == f_key) ++j_end;
+      for (size_t ii = i; ii < i_end; ++ii) {
+        const size_t a = this_order[ii];
+        for (size_t jj = j; jj < j_end; ++jj) {
+          const size_t b = f_order[jj];
+          entries.emplace_back(this_out[a] + f_out[b],
+                               op(this_values[a], f_values[b]));
+        }
+      }
+      i = i_end;
+      j = j_end;
+    }
+  }
+  // 5. Build the result in index order.
+  std::sort(entries.begin(), entries.end(),
+            [](const pair<uint64_t, double>& x, const pair<uint64_t, double>& y) {
+              return x.first < y.first;
+            });
   uint64_t card = 1;
   for (auto u_dkey : union_dkeys) card *= u_dkey.second;
   Eigen::SparseVector<double> mult_sparse_table(card);
-  mult_sparse_table.reserve(card);
-  // 3. Multiply.
-  for (SparseIt it(sparse_table_); it; ++it) {
-    uint64_t contract_unique = uniqueRep(contract_dkeys, it.index());
-    if (map_f.find(contract_unique) == map_f.end()) continue;
-    for (auto assignVal : map_f[contract_unique]) {
-      uint64_t union_idx = unionRep(union_dkeys, assignVal.first, it.index());
-      mult_sparse_table.insert(union_idx) = op(it.value(), assignVal.second);
-    }
-  }
-  // 4. Free unused memory.
+  mult_sparse_table.reserve(entries.size());
+  for (auto&& [idx, value] : entries) mult_sparse_table.insertBack(idx) = value;
+  // 6. Free unused memory.
   mult_sparse_table.pruned();
   mult_sparse_table.data().squeeze();
-  // 5. Create union keys and return.
+  // 7. Create union keys and return.
   return TableFactor(union_dkeys, mult_sparse_table);
 }
 
@@ -573,24 +629,10 @@ TableFactor::shared_ptr TableFactor::combine(size_t nrFrontals,
   }
   // Find remaining keys.
   DiscreteKeys remain_dkeys;
-  uint64_t card = 1;
   for (auto i = nrFrontals; i < keys_.size(); i++) {
     remain_dkeys.push_back(discreteKey(i));
-    card *= cardinality(keys_[i]);
   }
-  // Create combined table.
-  Eigen::SparseVector<double> combined_table(card);
-  combined_table.reserve(sparse_table_.nonZeros());
-  // Populate combined table.
-  for (SparseIt it(sparse_table_); it; ++it) {
-    uint64_t idx = uniqueRep(remain_dkeys, it.index());
-    double new_val = op(combined_table.coeff(idx), it.value());
-    combined_table.coeffRef(idx) = new_val;
-  }
-  // Free unused memory.
-  combined_table.pruned();
-  combined_table.data().squeeze();
-  return std::make_shared<TableFactor>(remain_dkeys, combined_table);
+  return reduce(remain_dkeys, op);
 }
 
 /* ************************************************************************ */
@@ -605,22 +647,38 @@ TableFactor::shared_ptr TableFactor::combine(const Ordering& frontalKeys,
   }
   // Find remaining keys.
   DiscreteKeys remain_dkeys;
-  uint64_t card = 1;
   for (Key key : keys_) {
     if (std::find(frontalKeys.begin(), frontalKeys.end(), key) ==
         frontalKeys.end()) {
       remain_dkeys.emplace_back(key, cardinality(key));
-      card *= cardinality(key);
     }
   }
-  // Create combined table.
+  return reduce(remain_dkeys, op);
+}
+
+/* ************************************************************************ */
+TableFactor::shared_ptr TableFactor::reduce(const DiscreteKeys& remain_dkeys,
+                                            Binary op) const {
+  uint64_t card = 1;
+  for (const DiscreteKey& dkey : remain_dkeys) card *= dkey.second;
+  // Project every nonzero onto the remaining keys, and sort by the result.
+  const vector<uint64_t> projected =
+      projectIndices(ComputeStrides(remain_dkeys));
+  vector<size_t> order(projected.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+    return projected[i] < projected[j];
+  });
+  // Stream over the sorted entries, combining runs with the same index.
   Eigen::SparseVector<double> combined_table(card);
-  combined_table.reserve(sparse_table_.nonZeros());
-  // Populate combined table.
-  for (SparseIt it(sparse_table_); it; ++it) {
-    uint64_t idx = uniqueRep(remain_dkeys, it.index());
-    double new_val = op(combined_table.coeff(idx), it.value());
-    combined_table.coeffRef(idx) = new_val;
+  combined_table.reserve(order.size());
+  const double* values = sparse_table_.valuePtr();
+  for (size_t i = 0; i < order.size();) {
+    const uint64_t idx = projected[order[i]];
+    double combined = 0.0;
+    for (; i < order.size() && projected[order[i]] == idx; ++i)
+      combined = op(combined, values[order[i]]);
+    combined_table.insertBack(idx) = combined;
   }
   // Free unused memory.
   combined_table.pruned();
@@ -628,6 +686,40 @@ TableFactor::shared_ptr TableFactor::combine(const Ordering& frontalKeys,
   return std::make_shared<TableFactor>(remain_dkeys, combined_table);
 }
 
+/* ************************************************************************ */
+TableFactor::Strides TableFactor::ComputeStrides(const DiscreteKeys& dkeys) {
+  Strides strides(dkeys.size());
+  uint64_t stride = 1;
+  for (size_t i = dkeys.size(); i-- > 0;) {
+    strides[i] = {dkeys[i].first, stride};
+    stride *= dkeys[i].second;
+  }
+  return strides;
+}
+
+/* ************************************************************************ */
+vector<uint64_t> TableFactor::projectIndices(const Strides& strides) const {
+  // Look up denominator and cardinality of every key once.
+  struct Mode {
+    uint64_t denominator, cardinality, stride;
+  };
+  vector<Mode> modes;
+  modes.reserve(strides.size());
+  for (auto&& [key, stride] : strides)
+    modes.push_back({denominators_.at(key), cardinality(key), stride});
+
+  vector<uint64_t> projected;
+  projected.reserve(sparse_table_.nonZeros());
+  for (SparseIt it(sparse_table_); it; ++it) {
+    const uint64_t index = it.index();
+    uint64_t result = 0;
+    for (const Mode& mode : modes)
+      result += ((index / mode.denominator) % mode.cardinality) * mode.stride;
+    projected.push_back(result);
+  }
+  return projected;
+}
+
 /* ************************************************************************ */
 size_t TableFactor::keyValueForIndex(Key target_key, uint64_t index) const {
   // http://phrogz.net/lazy-cartesian-product
@@ -252,6 +252,9 @@ class GTSAM_EXPORT TableFactor : public DiscreteFactor {
 
   /**
    * Apply binary operator (*this) "op" f
+   *
+   * Only entries that are nonzero in both factors are combined, using a
+   * sort-merge join on the assignment of the shared keys.
    * @param f the second argument for op
    * @param op a binary operator that operates on TableFactor
    */
@@ -378,6 +381,31 @@ class GTSAM_EXPORT TableFactor : public DiscreteFactor {
   /// @}
 
  private:
+  /// Pairs of keys and their strides in a (possibly different) table.
+  typedef std::vector<std::pair<Key, uint64_t>> Strides;
+
+  /**
+   * @brief Compute the strides of `dkeys` in a table indexed with the last key
+   * varying fastest, i.e., the layout used by the sparse table.
+   */
+  static Strides ComputeStrides(const DiscreteKeys& dkeys);
+
+  /**
+   * @brief Re-index all nonzero entries: for entry `idx`, compute
+   * sum_k keyValueForIndex(k, idx) * stride_k over the given strides.
+   * Keys are looked up only once, which makes this much cheaper than calling
+   * uniqueRep for every entry.
+   * @param strides keys of this factor and their strides in the target table.
+   * @return new index of every nonzero, in storage order.
+   */
+  std::vector<uint64_t> projectIndices(const Strides& strides) const;
+
+  /**
+   * @brief Reduce all entries with the same assignment to `remaining` with
+   * `op`, by sorting projected indices and combining consecutive runs.
+   */
+  shared_ptr reduce(const DiscreteKeys& remaining, Binary op) const;
+
 #if GTSAM_ENABLE_BOOST_SERIALIZATION
   /** Serialization function */
   friend class boost::serialization::access;
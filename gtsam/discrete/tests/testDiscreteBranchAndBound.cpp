@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/*
+ * @file testDiscreteBranchAndBound.cpp
+ * @date October 2026
+ * @brief Unit tests for the branch-and-bound MPE solver
+ */
+
+#include <CppUnitLite/TestHarness.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/discrete/DiscreteBranchAndBound.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+
+#include <cmath>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// Grid of binary and ternary variables with random pairwise factors,
+// including some zeros so that some assignments are infeasible.
+static DiscreteFactorGraph RandomGrid(size_t rows, size_t cols) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  auto key = [cols](size_t r, size_t c) {
+    return DiscreteKey(r * cols + c, 2 + (r + c) % 2);
+  };
+  auto table = [&](size_t n) {
+    vector<double> t(n);
+    for (auto& v : t) v = uniform(rng) < 0.1 ? 0.0 : uniform(rng);
+    return t;
+  };
+
+  DiscreteFactorGraph graph;
+  for (size_t r = 0; r < rows; r++) {
+    for (size_t c = 0; c < cols; c++) {
+      const DiscreteKey k = key(r, c);
+      graph.add(k, table(k.second));
+      if (r + 1 < rows) {
+        const DiscreteKey down = key(r + 1, c);
+        graph.add(k & down, table(k.second * down.second));
+      }
+      if (c + 1 < cols) {
+        const DiscreteKey right = key(r, c + 1);
+        graph.add(k & right, table(k.second * right.second));
+      }
+    }
+  }
+  return graph;
+}
+
+/* ************************************************************************* */
+TEST(DiscreteBranchAndBound, Small) {
+  DiscreteKey C(0, 2), A(1, 2), B(2, 2);
+  DiscreteFactorGraph graph;
+  graph.add(C & A, "0.2 0.8 0.3 0.7");
+  graph.add(C & B, "0.1 0.9 0.4 0.6");
+
+  const auto result = DiscreteBranchAndBound(graph).solve();
+  const DiscreteValues mpe{{0, 0}, {1, 1}, {2, 1}};
+  EXPECT(assert_equal(mpe, result.assignment));
+  EXPECT_DOUBLES_EQUAL(std::log(graph(mpe)), result.logProbability, 1e-9);
+  EXPECT(result.optimal);
+  // Large enough i-bound, so mini-bucket elimination is exact.
+  EXPECT_DOUBLES_EQUAL(result.logProbability, result.upperBound, 1e-9);
+}
+
+/* ************************************************************************* */
+// Compare with max-product for several i-bounds.
+TEST(DiscreteBranchAndBound, Grid) {
+  const DiscreteFactorGraph graph = RandomGrid(5, 5);
+  const DiscreteValues mpe = graph.optimize();
+
+  for (size_t iBound : {1, 2, 3, 5}) {
+    DiscreteBranchAndBound::Parameters params;
+    params.iBound = iBound;
+    for (size_t nrSubproblems : {0, 16}) {
+      params.nrSubproblems = nrSubproblems;
+      const auto result = DiscreteBranchAndBound(graph, params).solve();
+      EXPECT(result.optimal);
+      EXPECT_DOUBLES_EQUAL(std::log(graph(mpe)), result.logProbability, 1e-9);
+      EXPECT_DOUBLES_EQUAL(std::log(graph(result.assignment)),
+                           result.logProbability, 1e-9);
+      EXPECT(result.upperBound >= result.logProbability - 1e-9);
+    }
+  }
+}
+
+/* ************************************************************************* */
+// With a tiny time budget we still get a consistent anytime answer.
+TEST(DiscreteBranchAndBound, TimeBudget) {
+  const DiscreteFactorGraph graph = RandomGrid(8, 8);
+
+  DiscreteBranchAndBound::Parameters params;
+  params.iBound = 1;
+  params.timeBudget = 1e-9;
+  const auto result = DiscreteBranchAndBound(graph, params).solve();
+  EXPECT(result.upperBound >= result.logProbability);
+  if (!result.assignment.empty())
+    EXPECT_DOUBLES_EQUAL(std::log(graph(result.assignment)),
+                         result.logProbability, 1e-9);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
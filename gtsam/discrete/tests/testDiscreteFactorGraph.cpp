@@ -21,6 +21,7 @@
 #include <gtsam/discrete/DiscreteEliminationTree.h>
 #include <gtsam/discrete/DiscreteFactor.h>
 #include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/discrete/TableFactor.h>
 #include <gtsam/inference/BayesNet.h>
 #include <gtsam/inference/Symbol.h>
 
@@ -175,6 +176,60 @@ TEST(DiscreteFactorGraph, test) {
   }
 }
 
+/* ************************************************************************* */
+// Check that sparse elimination agrees with the decision tree version.
+TEST(DiscreteFactorGraph, EliminateDiscreteTable) {
+  DiscreteKey C(0, 2), B(1, 2), A(2, 2);
+
+  DiscreteFactorGraph graph;
+  graph.add(A & C, "3 1 1 3");
+  graph.push_back(std::make_shared<TableFactor>(C & B, "3 1 1 3"));
+
+  const Ordering frontalKeys{0};
+  const auto [conditional, newFactor] =
+      EliminateDiscreteTable(graph, frontalKeys);
+
+  Signature signature((C | B, A) = "9/1 1/1 1/1 1/9");
+  EXPECT(assert_equal(DiscreteConditional(signature), *conditional));
+
+  // Separator stays sparse, and is the same as with decision trees
+  auto table = std::dynamic_pointer_cast<TableFactor>(newFactor);
+  CHECK(table);
+  const auto expectedFactor = EliminateDiscrete(graph, frontalKeys).second;
+  EXPECT(assert_equal(expectedFactor->toDecisionTreeFactor(),
+                      table->toDecisionTreeFactor()));
+
+  // Full elimination
+  const Ordering ordering{0, 1, 2};
+  DiscreteBayesNet expectedBayesNet;
+  expectedBayesNet.add(signature);
+  expectedBayesNet.add(B | A = "5/3 3/5");
+  expectedBayesNet.add(A % "1/1");
+  auto actual = graph.eliminateSequential(ordering, EliminateDiscreteTable);
+  EXPECT(assert_equal(expectedBayesNet, *actual));
+}
+
+/* ************************************************************************* */
+// Sparse elimination on a small constraint satisfaction problem with zeros.
+TEST(DiscreteFactorGraph, EliminateDiscreteTableCSP) {
+  DiscreteKey A(0, 3), B(1, 3), C(2, 3);
+
+  // All different, plus a preference on A.
+  DiscreteFactorGraph graph;
+  graph.add(A & B, "0 1 1  1 0 1  1 1 0");
+  graph.add(B & C, "0 1 1  1 0 1  1 1 0");
+  graph.add(A & C, "0 1 1  1 0 1  1 1 0");
+  graph.add(A, "1 2 3");
+
+  const Ordering ordering{0, 1, 2};
+  auto expected = graph.eliminateSequential(ordering, EliminateDiscrete);
+  auto actual = graph.eliminateSequential(ordering, EliminateDiscreteTable);
+  EXPECT(assert_equal(*expected, *actual));
+
+  DiscreteValues x{{0, 2}, {1, 0}, {2, 1}};
+  EXPECT_DOUBLES_EQUAL(expected->evaluate(x), actual->evaluate(x), 1e-9);
+}
+
 /* ************************************************************************* */
 TEST_UNSAFE(DiscreteFactorGraph, testMaxProduct) {
   // Declare a bunch of keys
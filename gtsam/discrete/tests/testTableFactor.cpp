@@ -235,6 +235,36 @@ TEST(TableFactor, multiplication) {
   CHECK(assert_equal(expected3, actual_zeros));
 }
 
+/* ************************************************************************* */
+// Check product, sum and max against DecisionTreeFactor on sparse tables,
+// including factors whose keys are not given in sorted order.
+TEST(TableFactor, SparseAgreesWithDecisionTree) {
+  DiscreteKey A(0, 3), B(1, 2), C(2, 4), D(3, 2);
+  const vector<double> t1{0, 1, 0, 0, 2, 0, 3, 0, 0, 4, 0, 5,
+                          0, 0, 6, 0, 0, 0, 7, 0, 8, 0, 0, 9};
+  const vector<double> t2{1, 0, 0, 2, 0, 3, 4, 0};
+  const DiscreteKeys keys1{C, A, B}, keys2{D, C};
+  TableFactor f1(keys1, t1), f2(keys2, t2);
+  DecisionTreeFactor d1(keys1, t1), d2(keys2, t2);
+
+  const TableFactor product = f1 * f2;
+  const DecisionTreeFactor expected = d1 * d2;
+  for (auto&& [assignment, value] : expected.enumerate())
+    EXPECT_DOUBLES_EQUAL(value, product(assignment), 1e-9);
+  EXPECT(assert_equal(expected, f1 * d2));
+
+  // Marginalize out frontals and explicit keys
+  EXPECT(assert_equal(d1.sum(2)->toDecisionTreeFactor(),
+                      f1.sum(2)->toDecisionTreeFactor()));
+  EXPECT(assert_equal(d1.max(1)->toDecisionTreeFactor(),
+                      f1.max(1)->toDecisionTreeFactor()));
+  const Ordering frontals{0, 3};
+  EXPECT(assert_equal(expected.sum(frontals)->toDecisionTreeFactor(),
+                      product.sum(frontals)->toDecisionTreeFactor()));
+  EXPECT(assert_equal(expected.max(frontals)->toDecisionTreeFactor(),
+                      product.max(frontals)->toDecisionTreeFactor()));
+}
+
 /* ************************************************************************* */
 // Benchmark which compares runtime of multiplication of two TableFactors
 // and two DecisionTreeFactors given sparsity from dense to 90% sparsity.
@@ -0,0 +1,474 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file BatchProjection.h
+ * @date October 2026
+ * @brief Projection of many points into many cameras at once, with Jacobians,
+ * computed on structure-of-arrays data.
+ */
+
+#pragma once
+
+#include <gtsam/base/Matrix.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Cal3Fisheye.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/geometry/Point2.h>
+#include <gtsam/geometry/Point3.h>
+#include <gtsam/geometry/Pose3.h>
+
+#include <cmath>
+#include <type_traits>
+
+namespace gtsam {
+
+template <class CALIBRATION>
+class PinholeCamera;
+template <class CALIBRATION>
+class PinholePose;
+
+namespace internal {
+
+/**
+ * Calibration models in structure-of-arrays form: Gather copies the
+ * parameters of one observation into row k of an n*P matrix, and Uncalibrate
+ * computes pixel coordinates u, v of n intrinsic coordinates x, y, the 2*2
+ * Jacobians Dp (stored row-major in n*4 columns), and optionally the 2*DimK
+ * Jacobians Dcal (row-major in n*(2*DimK) columns). The loops only access
+ * contiguous columns, so the compiler can vectorize them.
+ * Only specialized for the calibrations below, see HasBatchCalibration.
+ */
+template <class CALIBRATION>
+struct BatchCalibration;
+
+/// Whether BatchCalibration is specialized for CALIBRATION.
+template <class CALIBRATION, class = void>
+struct HasBatchCalibration : std::false_type {};
+
+template <class CALIBRATION>
+struct HasBatchCalibration<
+    CALIBRATION, std::void_t<decltype(BatchCalibration<CALIBRATION>::P)>>
+    : std::true_type {};
+
+/// Cal3_S2: u = fx x + s y + u0, v = fy y + v0.
+template <>
+struct BatchCalibration<Cal3_S2> {
+  static constexpr int P = 5;  // fx, fy, s, u0, v0
+
+  static void Gather(const Cal3_S2& K, size_t k, Matrix* parameters) {
+    parameters->row(k) << K.fx(), K.fy(), K.skew(), K.px(), K.py();
+  }
+
+  static void Uncalibrate(size_t n, const Matrix& parameters, const double* x,
+                          const double* y, double* u, double* v, Matrix* Dp,
+                          Matrix* Dcal) {
+    const double *fx = parameters.col(0).data(), *fy = parameters.col(1).data(),
+                 *s = parameters.col(2).data(), *u0 = parameters.col(3).data(),
+                 *v0 = parameters.col(4).data();
+    double *a = Dp->col(0).data(), *b = Dp->col(1).data(),
+           *c = Dp->col(2).data(), *d = Dp->col(3).data();
+    for (size_t k = 0; k < n; k++) {
+      u[k] = fx[k] * x[k] + s[k] * y[k] + u0[k];
+      v[k] = fy[k] * y[k] + v0[k];
+      a[k] = fx[k];
+      b[k] = s[k];
+      c[k] = 0.0;
+      d[k] = fy[k];
+    }
+    if (!Dcal) return;
+    Dcal->setZero();
+    Dcal->col(0) = Eigen::Map<const Vector>(x, n);
+    Dcal->col(2) = Eigen::Map<const Vector>(y, n);
+    Dcal->col(3).setOnes();
+    Dcal->col(6) = Eigen::Map<const Vector>(y, n);
+    Dcal->col(9).setOnes();
+  }
+};
+
+/// Cal3Bundler: radial distortion g = 1 + k1 r + k2 r^2, with r = x^2 + y^2.
+template <>
+struct BatchCalibration<Cal3Bundler> {
+  static constexpr int P = 5;  // f, k1, k2, u0, v0
+
+  static void Gather(const Cal3Bundler& K, size_t k, Matrix* parameters) {
+    parameters->row(k) << K.fx(), K.k1(), K.k2(), K.px(), K.py();
+  }
+
+  static void Uncalibrate(size_t n, const Matrix& parameters, const double* x,
+                          const double* y, double* u, double* v, Matrix* Dp,
+                          Matrix* Dcal) {
+    const double *f = parameters.col(0).data(), *k1 = parameters.col(1).data(),
+                 *k2 = parameters.col(2).data(), *u0 = parameters.col(3).data(),
+                 *v0 = parameters.col(4).data();
+    double *a = Dp->col(0).data(), *b = Dp->col(1).data(),
+           *c = Dp->col(2).data(), *d = Dp->col(3).data();
+    for (size_t k = 0; k < n; k++) {
+      const double r = x[k] * x[k] + y[k] * y[k];
+      const double g = 1. + (k1[k] + k2[k] * r) * r;
+      const double e = 2. * (k1[k] + 2. * k2[k] * r);
+      u[k] = u0[k] + f[k] * g * x[k];
+      v[k] = v0[k] + f[k] * g * y[k];
+      a[k] = f[k] * (g + e * x[k] * x[k]);
+      b[k] = f[k] * e * x[k] * y[k];
+      c[k] = b[k];
+      d[k] = f[k] * (g + e * y[k] * y[k]);
+    }
+    if (!Dcal) return;
+    double *D0 = Dcal->col(0).data(), *D1 = Dcal->col(1).data(),
+           *D2 = Dcal->col(2).data(), *D3 = Dcal->col(3).data(),
+           *D4 = Dcal->col(4).data(), *D5 = Dcal->col(5).data();
+    for (size_t k = 0; k < n; k++) {
+      const double r = x[k] * x[k] + y[k] * y[k];
+      const double g = 1. + (k1[k] + k2[k] * r) * r;
+      const double rx = r * x[k], ry = r * y[k];
+      D0[k] = g * x[k];
+      D1[k] = f[k] * rx;
+      D2[k] = f[k] * r * rx;
+      D3[k] = g * y[k];
+      D4[k] = f[k] * ry;
+      D5[k] = f[k] * r * ry;
+    }
+  }
+};
+
+/// Cal3DS2: radial distortion k1, k2 and tangential distortion p1, p2.
+template <>
+struct BatchCalibration<Cal3DS2> {
+  static constexpr int P = 9;  // fx, fy, s, u0, v0, k1, k2, p1, p2
+
+  static void Gather(const Cal3DS2& K, size_t k, Matrix* parameters) {
+    parameters->row(k) = K.vector().transpose();
+  }
+
+  static void Uncalibrate(size_t n, const Matrix& parameters, const double* x,
+                          const double* y, double* u, double* v, Matrix* Dp,
+                          Matrix* Dcal) {
+    const double *fx = parameters.col(0).data(), *fy = parameters.col(1).data(),
+                 *s = parameters.col(2).data(), *u0 = parameters.col(3).data(),
+                 *v0 = parameters.col(4).data(), *k1 = parameters.col(5).data(),
+                 *k2 = parameters.col(6).data(), *p1 = parameters.col(7).data(),
+                 *p2 = parameters.col(8).data();
+    double *a = Dp->col(0).data(), *b = Dp->col(1).data(),
+           *c = Dp->col(2).data(), *d = Dp->col(3).data();
+    for (size_t k = 0; k < n; k++) {
+      const double xk = x[k], yk = y[k], xy = xk * yk, xx = xk * xk,
+                   yy = yk * yk, rr = xx + yy, r4 = rr * rr;
+      const double g = 1. + k1[k] * rr + k2[k] * r4;
+      const double pnx = g * xk + 2. * p1[k] * xy + p2[k] * (rr + 2. * xx);
+      const double pny = g * yk + 2. * p2[k] * xy + p1[k] * (rr + 2. * yy);
+      u[k] = fx[k] * pnx + s[k] * pny + u0[k];
+      v[k] = fy[k] * pny + v0[k];
+
+      // Jacobian of the distorted point, as in Cal3DS2_Base, times K.
+      const double dgdx = 2. * xk * (k1[k] + 2. * k2[k] * rr);
+      const double dgdy = 2. * yk * (k1[k] + 2. * k2[k] * rr);
+      const double R00 = g + xk * dgdx + 2. * p1[k] * yk + 6. * p2[k] * xk;
+      const double R01 = xk * dgdy + 2. * p1[k] * xk + 2. * p2[k] * yk;
+      const double R10 = yk * dgdx + 2. * p2[k] * yk + 2. * p1[k] * xk;
+      const double R11 = g + yk * dgdy + 2. * p2[k] * xk + 6. * p1[k] * yk;
+      a[k] = fx[k] * R00 + s[k] * R10;
+      b[k] = fx[k] * R01 + s[k] * R11;
+      c[k] = fy[k] * R10;
+      d[k] = fy[k] * R11;
+    }
+    if (!Dcal) return;
+    for (size_t k = 0; k < n; k++) {
+      const double xk = x[k], yk = y[k], xy = xk * yk, xx = xk * xk,
+                   yy = yk * yk, rr = xx + yy, r4 = rr * rr;
+      const double g = 1. + k1[k] * rr + k2[k] * r4;
+      const double pnx = g * xk + 2. * p1[k] * xy + p2[k] * (rr + 2. * xx);
+      const double pny = g * yk + 2. * p2[k] * xy + p1[k] * (rr + 2. * yy);
+      Eigen::Matrix<double, 2, 9> D;
+      const double R0[4] = {xk * rr, xk * r4, 2 * xy, rr + 2 * xx};
+      const double R1[4] = {yk * rr, yk * r4, rr + 2 * yy, 2 * xy};
+      D << pnx, 0.0, pny, 1.0, 0.0,                            //
+          fx[k] * R0[0] + s[k] * R1[0], fx[k] * R0[1] + s[k] * R1[1],
+          fx[k] * R0[2] + s[k] * R1[2], fx[k] * R0[3] + s[k] * R1[3],  //
+          0.0, pny, 0.0, 0.0, 1.0,                              //
+          fy[k] * R1[0], fy[k] * R1[1], fy[k] * R1[2], fy[k] * R1[3];
+      Dcal->row(k) = Eigen::Map<const Eigen::Matrix<double, 1, 18>>(
+          Eigen::Matrix<double, 2, 9, Eigen::RowMajor>(D).data());
+    }
+  }
+};
+
+/// Cal3Fisheye: equidistant model, distorted angle t (1 + k1 t^2 + ... ).
+template <>
+struct BatchCalibration<Cal3Fisheye> {
+  static constexpr int P = 9;  // fx, fy, s, u0, v0, k1, k2, k3, k4
+
+  static void Gather(const Cal3Fisheye& K, size_t k, Matrix* parameters) {
+    parameters->row(k) = K.vector().transpose();
+  }
+
+  static void Uncalibrate(size_t n, const Matrix& parameters, const double* x,
+                          const double* y, double* u, double* v, Matrix* Dp,
+                          Matrix* Dcal) {
+    const double *fx = parameters.col(0).data(), *fy = parameters.col(1).data(),
+                 *s = parameters.col(2).data(), *u0 = parameters.col(3).data(),
+                 *v0 = parameters.col(4).data(), *k1 = parameters.col(5).data(),
+                 *k2 = parameters.col(6).data(), *k3 = parameters.col(7).data(),
+                 *k4 = parameters.col(8).data();
+    double *a = Dp->col(0).data(), *b = Dp->col(1).data(),
+           *c = Dp->col(2).data(), *d = Dp->col(3).data();
+    if (Dcal) Dcal->setZero();
+    for (size_t k = 0; k < n; k++) {
+      const double xi = x[k], yi = y[k];
+      const double r2 = xi * xi + yi * yi, r = std::sqrt(r2);
+      const double t = std::atan2(r, 1.0);
+      const double t2 = t * t, t4 = t2 * t2, t6 = t2 * t4, t8 = t4 * t4;
+      const double scaling = Cal3Fisheye::Scaling(r);
+      const double td = 1 + k1[k] * t2 + k2[k] * t4 + k3[k] * t6 + k4[k] * t8;
+      const double sd = scaling * td;
+      const double xd = sd * xi, yd = sd * yi;
+      u[k] = fx[k] * xd + s[k] * yd + u0[k];
+      v[k] = fy[k] * yd + v0[k];
+
+      // Jacobian in intrinsic coordinates, as in Cal3Fisheye::uncalibrate.
+      double R00 = 1, R01 = 0, R11 = 1;
+      if (r2 != 0) {
+        const double dtd_dt = 1 + 3 * k1[k] * t2 + 5 * k2[k] * t4 +
+                              7 * k3[k] * t6 + 9 * k4[k] * t8;
+        const double dtd_dr = dtd_dt / (r2 + 1);
+        const double c2 = xi * xi / r2, s2 = yi * yi / r2, cs = xi * yi / r2;
+        R00 = dtd_dr * c2 + sd * (1 - c2);
+        R01 = (dtd_dr - sd) * cs;
+        R11 = dtd_dr * s2 + sd * (1 - s2);
+      }
+      a[k] = fx[k] * R00 + s[k] * R01;
+      b[k] = fx[k] * R01 + s[k] * R11;
+      c[k] = fy[k] * R01;
+      d[k] = fy[k] * R11;
+
+      if (Dcal) {
+        double* D = Dcal->data();
+        const size_t m = Dcal->rows();
+        // Row 0: xd, 0, yd, 1, 0, [fx s] * scaling * [xi; yi] * T
+        // Row 1: 0, yd, 0, 0, 1, fy * scaling * yi * T
+        const double T[4] = {t2, t4, t6, t8};
+        D[0 * m + k] = xd;
+        D[2 * m + k] = yd;
+        D[3 * m + k] = 1.0;
+        D[10 * m + k] = yd;
+        D[13 * m + k] = 1.0;
+        for (size_t j = 0; j < 4; j++) {
+          D[(5 + j) * m + k] = (fx[k] * xi + s[k] * yi) * scaling * T[j];
+          D[(14 + j) * m + k] = fy[k] * yi * scaling * T[j];
+        }
+      }
+    }
+  }
+};
+
+/**
+ * Whether CameraSet<CAMERA>::project2 of a POINT can use BatchProjection, and
+ * with which calibration. kCalibration says whether the camera Jacobian
+ * includes the calibration, as for PinholeCamera, or not, as for PinholePose.
+ */
+template <class CAMERA, class POINT>
+struct CameraBatch : std::false_type {};
+
+template <class CALIBRATION>
+struct CameraBatch<PinholePose<CALIBRATION>, Point3>
+    : HasBatchCalibration<CALIBRATION> {
+  using Calibration = CALIBRATION;
+  static constexpr bool kCalibration = false;
+};
+
+template <class CALIBRATION>
+struct CameraBatch<PinholeCamera<CALIBRATION>, Point3>
+    : HasBatchCalibration<CALIBRATION> {
+  using Calibration = CALIBRATION;
+  static constexpr bool kCalibration = true;
+};
+
+}  // namespace internal
+
+/**
+ * Projection of n points into n (not necessarily different) cameras at once,
+ * with the same results as PinholeCamera::project2 and PinholePose::project2,
+ * for the calibration models for which internal::BatchCalibration is
+ * specialized: Cal3_S2, Cal3Bundler, Cal3DS2 and Cal3Fisheye.
+ *
+ * Observation k is the projection of a point into a camera with the given
+ * pose and calibration. The inputs are stored as a structure of arrays, and
+ * all outputs are computed in a few loops over contiguous columns, rather
+ * than as a sequence of fixed-size matrix products with temporaries per
+ * observation. This lets the compiler vectorize the loops, in particular
+ * when building with GTSAM_BUILD_WITH_MARCH_NATIVE.
+ *
+ * Typical usage:
+ *   BatchProjection<Cal3Bundler> batch(n);
+ *   for (size_t k = 0; k < n; k++) batch.set(k, pose[k], K[k], point[k]);
+ *   batch.project();
+ *   ... batch.uv(k), batch.Dpose(k), batch.Dpoint(k), batch.Dcal(k)
+ */
+template <class CALIBRATION>
+class BatchProjection {
+  static_assert(internal::HasBatchCalibration<CALIBRATION>::value,
+                "BatchProjection: unsupported calibration model");
+  using Calibration = internal::BatchCalibration<CALIBRATION>;
+
+ public:
+  inline constexpr static int DimK = traits<CALIBRATION>::dimension;
+  using MatrixK = Eigen::Matrix<double, 2, DimK>;
+
+ private:
+  size_t n_ = 0;
+  Matrix inputs_;      ///< n*15: rotation (column-major), translation, point
+  Matrix parameters_;  ///< n*P: calibration parameters
+  Matrix outputs_;     ///< n*21: u, v, depth, Dpose (2*6), Dpoint (2*3)
+  Matrix Dp_;          ///< n*4: Jacobians of uncalibrate in intrinsic coords
+  Matrix intrinsic_;   ///< n*3: intrinsic coordinates x, y, and 1/depth
+  Matrix Dcal_;        ///< n*(2*DimK): Jacobians in calibration
+
+  enum { U = 0, V = 1, DEPTH = 2, DPOSE = 3, DPOINT = 15 };
+
+ public:
+  /// Construct for n observations.
+  explicit BatchProjection(size_t n = 0) { resize(n); }
+
+  /// Number of observations.
+  size_t size() const { return n_; }
+
+  /// Change the number of observations, which must all be set again.
+  void resize(size_t n) {
+    n_ = n;
+    inputs_.resize(n, 15);
+    parameters_.resize(n, Calibration::P);
+    outputs_.resize(n, 21);
+    Dp_.resize(n, 4);
+    intrinsic_.resize(n, 3);
+  }
+
+  /// Set observation k.
+  void set(size_t k, const Pose3& pose, const CALIBRATION& K,
+           const Point3& point) {
+    const Matrix3 R = pose.rotation().matrix();
+    const Point3& t = pose.translation();
+    inputs_.row(k) << R(0, 0), R(1, 0), R(2, 0), R(0, 1), R(1, 1), R(2, 1),
+        R(0, 2), R(1, 2), R(2, 2), t.x(), t.y(), t.z(), point.x(), point.y(),
+        point.z();
+    Calibration::Gather(K, k, &parameters_);
+  }
+
+  /**
+   * Project all observations.
+   * @param derivatives whether to compute Dpose and Dpoint
+   * @param calibrationDerivatives whether to compute Dcal
+   */
+  void project(bool derivatives = true, bool calibrationDerivatives = false) {
+    const size_t n = n_;
+    auto in = [this](int j) { return inputs_.col(j).data(); };
+    auto out = [this](int j) { return outputs_.col(j).data(); };
+
+    // Transform to the camera frame, q = R' (p - t), and project.
+    const double *r00 = in(0), *r10 = in(1), *r20 = in(2), *r01 = in(3),
+                 *r11 = in(4), *r21 = in(5), *r02 = in(6), *r12 = in(7),
+                 *r22 = in(8), *tx = in(9), *ty = in(10), *tz = in(11),
+                 *px = in(12), *py = in(13), *pz = in(14);
+    double *x = intrinsic_.col(0).data(), *y = intrinsic_.col(1).data(),
+           *invd = intrinsic_.col(2).data(), *depth = out(DEPTH);
+    for (size_t k = 0; k < n; k++) {
+      const double dx = px[k] - tx[k], dy = py[k] - ty[k], dz = pz[k] - tz[k];
+      const double qx = r00[k] * dx + r10[k] * dy + r20[k] * dz;
+      const double qy = r01[k] * dx + r11[k] * dy + r21[k] * dz;
+      const double qz = r02[k] * dx + r12[k] * dy + r22[k] * dz;
+      depth[k] = qz;
+      invd[k] = 1.0 / qz;
+      x[k] = qx * invd[k];
+      y[k] = qy * invd[k];
+    }
+
+    // Uncalibrate.
+    if (calibrationDerivatives) Dcal_.resize(n, 2 * DimK);
+    Calibration::Uncalibrate(n, parameters_, x, y, out(U), out(V), &Dp_,
+                             calibrationDerivatives ? &Dcal_ : nullptr);
+    if (!derivatives) return;
+
+    // Dpose = Dp * PinholeBase::Dpose(pn, d) and
+    // Dpoint = Dp * PinholeBase::Dpoint(pn, d, R'), with Dp = [a b; c e].
+    const double *a = Dp_.col(0).data(), *b = Dp_.col(1).data(),
+                 *c = Dp_.col(2).data(), *e = Dp_.col(3).data();
+    double* H[12];
+    for (int j = 0; j < 12; j++) H[j] = out(DPOSE + j);
+    double* G[6];
+    for (int j = 0; j < 6; j++) G[j] = out(DPOINT + j);
+    for (size_t k = 0; k < n; k++) {
+      const double u = x[k], v = y[k], d = invd[k];
+      const double uv = u * v, uu = u * u, vv = v * v;
+      // Rows of PinholeBase::Dpose
+      const double P0[6] = {uv, -1 - uu, v, -d, 0.0, d * u};
+      const double P1[6] = {1 + vv, -uv, -u, 0.0, -d, d * v};
+      for (int j = 0; j < 6; j++) {
+        H[j][k] = a[k] * P0[j] + b[k] * P1[j];
+        H[6 + j][k] = c[k] * P0[j] + e[k] * P1[j];
+      }
+      // Rows of PinholeBase::Dpoint, with R'(i, j) = R(j, i)
+      const double Q0[3] = {d * (r00[k] - u * r02[k]), d * (r10[k] - u * r12[k]),
+                            d * (r20[k] - u * r22[k])};
+      const double Q1[3] = {d * (r01[k] - v * r02[k]), d * (r11[k] - v * r12[k]),
+                            d * (r21[k] - v * r22[k])};
+      for (int j = 0; j < 3; j++) {
+        G[j][k] = a[k] * Q0[j] + b[k] * Q1[j];
+        G[3 + j][k] = c[k] * Q0[j] + e[k] * Q1[j];
+      }
+    }
+  }
+
+  /// Projection of observation k, in pixels.
+  Point2 uv(size_t k) const {
+    return Point2(outputs_(k, U), outputs_(k, V));
+  }
+
+  /// Whether the point of observation k is in front of its camera.
+  bool inFront(size_t k) const { return outputs_(k, DEPTH) > 0; }
+
+  /// Whether all points are in front of their cameras.
+  bool allInFront() const {
+    return n_ == 0 || outputs_.col(DEPTH).minCoeff() > 0;
+  }
+
+  /// Jacobian of observation k with respect to the camera pose.
+  Matrix26 Dpose(size_t k) const {
+    Matrix26 H;
+    for (int j = 0; j < 6; j++) {
+      H(0, j) = outputs_(k, DPOSE + j);
+      H(1, j) = outputs_(k, DPOSE + 6 + j);
+    }
+    return H;
+  }
+
+  /// Jacobian of observation k with respect to the point.
+  Matrix23 Dpoint(size_t k) const {
+    Matrix23 H;
+    for (int j = 0; j < 3; j++) {
+      H(0, j) = outputs_(k, DPOINT + j);
+      H(1, j) = outputs_(k, DPOINT + 3 + j);
+    }
+    return H;
+  }
+
+  /// Jacobian of observation k with respect to the calibration, only
+  /// available if project was called with calibrationDerivatives.
+  MatrixK Dcal(size_t k) const {
+    MatrixK H;
+    for (int j = 0; j < DimK; j++) {
+      H(0, j) = Dcal_(k, j);
+      H(1, j) = Dcal_(k, DimK + j);
+    }
+    return H;
+  }
+};
+
+}  // namespace gtsam
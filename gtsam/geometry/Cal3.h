@@ -23,6 +23,9 @@
 
 #include <gtsam/geometry/Point2.h>
 
+#include <type_traits>
+#include <utility>
+
 namespace gtsam {
 
 /**
@@ -61,6 +64,36 @@ void calibrateJacobians(const Cal& calibration, const Point2& pn,
   }
 }
 
+namespace internal {
+/// Whether CALIBRATION has a batch calibrate(const Point2Vector&).
+template <class CALIBRATION, class = void>
+struct HasBatchCalibrate : std::false_type {};
+
+template <class CALIBRATION>
+struct HasBatchCalibrate<
+    CALIBRATION,
+    std::void_t<decltype(std::declval<const CALIBRATION&>().calibrate(
+        std::declval<const Point2Vector&>()))>> : std::true_type {};
+}  // namespace internal
+
+/**
+ * Convert many image coordinates to intrinsic coordinates, with the batch
+ * calibrate of the calibration model if it has one, e.g., Cal3DS2 or
+ * Cal3Fisheye, and point by point otherwise.
+ */
+template <class CALIBRATION>
+Point2Vector calibratePoints(const CALIBRATION& calibration,
+                             const Point2Vector& pixels) {
+  if constexpr (internal::HasBatchCalibrate<CALIBRATION>::value) {
+    return calibration.calibrate(pixels);
+  } else {
+    Point2Vector result;
+    result.reserve(pixels.size());
+    for (const Point2& p : pixels) result.push_back(calibration.calibrate(p));
+    return result;
+  }
+}
+
 /**
  * @brief Common base class for all calibration models.
  * @ingroup geometry
@@ -165,6 +165,57 @@ Point2 Cal3DS2_Base::calibrate(const Point2& pi, OptionalJacobian<2, 9> Dcal,
   return pn;
 }
 
+/* ************************************************************************* */
+Point2Vector Cal3DS2_Base::calibrate(const Point2Vector& pixels) const {
+  const size_t n = pixels.size();
+
+  // inv(K)*pi, and the current estimate pn, as structure of arrays
+  Vector kx(n), ky(n), x(n), y(n);
+  for (size_t k = 0; k < n; k++) {
+    ky[k] = (pixels[k].y() - v0_) / fy_;
+    kx[k] = (pixels[k].x() - u0_ - s_ * ky[k]) / fx_;
+  }
+  x = kx;
+  y = ky;
+
+  // Same fixed point iteration as calibrate, on all points at once. Each pass
+  // first checks the pixel error of every active point, and as in calibrate a
+  // point that has converged is no longer updated.
+  const double tol2 = tol_ * tol_;
+  const int maxIterations = 10;
+  std::vector<size_t> active(n);
+  for (size_t k = 0; k < n; k++) active[k] = k;
+  int iteration;
+  for (iteration = 0; iteration < maxIterations; ++iteration) {
+    size_t nrActive = 0;
+    for (size_t k : active) {
+      const double px = x[k], py = y[k], xy = px * py, xx = px * px,
+                   yy = py * py;
+      const double rr = xx + yy;
+      const double g = (1 + k1_ * rr + k2_ * rr * rr);
+      const double dx = 2 * p1_ * xy + p2_ * (rr + 2 * xx);
+      const double dy = 2 * p2_ * xy + p1_ * (rr + 2 * yy);
+      const double pnx = g * px + dx, pny = g * py + dy;
+      const double ex = fx_ * (pnx - kx[k]) + s_ * (pny - ky[k]);
+      const double ey = fy_ * (pny - ky[k]);
+      if (ex * ex + ey * ey <= tol2) continue;
+      x[k] = (kx[k] - dx) / g;
+      y[k] = (ky[k] - dy) / g;
+      active[nrActive++] = k;
+    }
+    active.resize(nrActive);
+    if (active.empty()) break;
+  }
+
+  if (iteration >= maxIterations)
+    throw std::runtime_error(
+        "Cal3DS2::calibrate fails to converge. need a better initialization");
+
+  Point2Vector result(n);
+  for (size_t k = 0; k < n; k++) result[k] = Point2(x[k], y[k]);
+  return result;
+}
+
 /* ************************************************************************* */
 Matrix2 Cal3DS2_Base::D2d_intrinsic(const Point2& p) const {
   const double x = p.x(), y = p.y(), xx = x * x, yy = y * y;
@@ -129,6 +129,14 @@ class GTSAM_EXPORT Cal3DS2_Base : public Cal3 {
   Point2 calibrate(const Point2& p, OptionalJacobian<2, 9> Dcal = {},
                    OptionalJacobian<2, 2> Dp = {}) const;
 
+  /**
+   * Convert many image coordinates to intrinsic coordinates at once. Runs the
+   * fixed point iteration of calibrate on all points together, on
+   * structure-of-arrays data the compiler can vectorize, until all converged.
+   * Throws like calibrate if any point does not converge.
+   */
+  Point2Vector calibrate(const Point2Vector& pixels) const;
+
   /// Derivative of uncalibrate wrpt intrinsic coordinates
   Matrix2 D2d_intrinsic(const Point2& p) const;
 
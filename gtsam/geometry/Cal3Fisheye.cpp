@@ -22,6 +22,9 @@
 #include <gtsam/geometry/Point2.h>
 #include <gtsam/geometry/Point3.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace gtsam {
 
 /* ************************************************************************* */
@@ -153,6 +156,68 @@ Point2 Cal3Fisheye::calibrate(const Point2& uv, OptionalJacobian<2, 9> Dcal,
   return pi;
 }
 
+/* ************************************************************************* */
+Point2Vector Cal3Fisheye::calibrate(const Point2Vector& pixels) const {
+  const size_t n = pixels.size();
+
+  // Angular coordinates (xd, yd) and their radius theta_d, as in calibrate,
+  // with theta_d as initial guess for theta.
+  Vector xd(n), yd(n), td(n), t(n), pixelScale(n);
+  for (size_t k = 0; k < n; k++) {
+    yd[k] = (pixels[k].y() - v0_) / fy_;
+    xd[k] = (pixels[k].x() - s_ * yd[k] - u0_) / fx_;
+    td[k] = std::sqrt(xd[k] * xd[k] + yd[k] * yd[k]);
+    // An error e in theta_d moves the pixel by e * K * (xd, yd) / theta_d, so
+    // the pixel error is |e| times the norm of that direction under K.
+    const double cx = (td[k] > 0) ? xd[k] / td[k] : 0.0,
+                 cy = (td[k] > 0) ? yd[k] / td[k] : 0.0;
+    pixelScale[k] = std::hypot(fx_ * cx + s_ * cy, fy_ * cy);
+  }
+  t = td;
+
+  // Newton's method on f(t) = t (1 + k1 t^2 + k2 t^4 + k3 t^6 + k4 t^8) - td.
+  // As in calibrate, each point is checked against the pixel tolerance before
+  // it is updated, and is no longer updated once it has converged. A NaN
+  // residual never converges.
+  std::vector<size_t> active(n);
+  for (size_t k = 0; k < n; k++) active[k] = k;
+  const int maxIterations = 10;
+  int iteration;
+  for (iteration = 0; iteration < maxIterations; ++iteration) {
+    size_t nrActive = 0;
+    for (size_t k : active) {
+      const double t2 = t[k] * t[k], t4 = t2 * t2, t6 = t2 * t4, t8 = t4 * t4;
+      const double f =
+          t[k] * (1 + k1_ * t2 + k2_ * t4 + k3_ * t6 + k4_ * t8) - td[k];
+      if (std::isfinite(f) && std::abs(f) * pixelScale[k] < tol_) continue;
+      const double df =
+          1 + 3 * k1_ * t2 + 5 * k2_ * t4 + 7 * k3_ * t6 + 9 * k4_ * t8;
+      t[k] -= f / df;
+      active[nrActive++] = k;
+    }
+    active.resize(nrActive);
+    if (active.empty()) break;
+  }
+
+  // Only a theta in [0, pi/2) is in front of the camera; a root outside of it,
+  // such as the mirrored point at -theta, is not a solution.
+  bool valid = iteration < maxIterations;
+  for (size_t k = 0; valid && k < n; k++)
+    valid = std::isfinite(t[k]) && t[k] >= 0 && t[k] < M_PI_2;
+  if (!valid)
+    throw std::runtime_error(
+        "Cal3Fisheye::calibrate fails to converge. need a better "
+        "initialization");
+
+  // Back to the focal plane: r = tan(theta), along the direction of (xd, yd).
+  Point2Vector result(n);
+  for (size_t k = 0; k < n; k++) {
+    const double scale = (td[k] > 0) ? std::tan(t[k]) / td[k] : 1.0;
+    result[k] = Point2(scale * xd[k], scale * yd[k]);
+  }
+  return result;
+}
+
 /* ************************************************************************* */
 std::ostream& operator<<(std::ostream& os, const Cal3Fisheye& cal) {
   os << (Cal3&)cal;
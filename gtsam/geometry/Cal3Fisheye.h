@@ -135,6 +135,18 @@ class GTSAM_EXPORT Cal3Fisheye : public Cal3 {
   Point2 calibrate(const Point2& p, OptionalJacobian<2, 9> Dcal = {},
                    OptionalJacobian<2, 2> Dp = {}) const;
 
+  /**
+   * Convert many image coordinates to intrinsic coordinates at once.
+   * Rather than Newton's method in 2D, this inverts the distortion of the
+   * angle, theta_d = theta (1 + k1 theta^2 + ... + k4 theta^8), with a 1D
+   * Newton iteration that is run for all points together until all are
+   * within tol_ pixels, after which x_i = tan(theta) * x_d / theta_d.
+   * Throws like calibrate if any point does not converge, and also if it
+   * converges to a theta outside [0, pi/2), which calibrate may return as a
+   * mirrored point.
+   */
+  Point2Vector calibrate(const Point2Vector& pixels) const;
+
   /// @}
   /// @name Testable
   /// @{
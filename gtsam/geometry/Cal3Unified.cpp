@@ -112,6 +112,13 @@ Point2 Cal3Unified::calibrate(const Point2& pi, OptionalJacobian<2, 10> Dcal,
 
   return pn;
 }
+/* ************************************************************************* */
+Point2Vector Cal3Unified::calibrate(const Point2Vector& pixels) const {
+  Point2Vector pn = Base::calibrate(pixels);
+  for (Point2& p : pn) p = nPlaneToSpace(p);
+  return pn;
+}
+
 /* ************************************************************************* */
 Point2 Cal3Unified::nPlaneToSpace(const Point2& p) const {
   const double x = p.x(), y = p.y();
@@ -113,6 +113,10 @@ class GTSAM_EXPORT Cal3Unified : public Cal3DS2_Base {
   Point2 calibrate(const Point2& p, OptionalJacobian<2, 10> Dcal = {},
                    OptionalJacobian<2, 2> Dp = {}) const;
 
+  /// Convert many pixel coordinates to ideal coordinates at once, see
+  /// Cal3DS2_Base::calibrate(const Point2Vector&).
+  Point2Vector calibrate(const Point2Vector& pixels) const;
+
   /// Convert a 3D point to normalized unit plane
   Point2 spaceToNPlane(const Point2& p) const;
 
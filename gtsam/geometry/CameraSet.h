@@ -21,6 +21,7 @@
 #include <gtsam/base/FastMap.h>
 #include <gtsam/base/SymmetricBlockMatrix.h>
 #include <gtsam/base/Testable.h>
+#include <gtsam/geometry/BatchProjection.h>
 #include <gtsam/geometry/CalibratedCamera.h>  // for Cheirality exception
 #include <gtsam/geometry/Point3.h>
 #include <gtsam/inference/Key.h>
@@ -111,6 +112,12 @@ class CameraSet : public std::vector<CAMERA, Eigen::aligned_allocator<CAMERA>> {
                    Matrix* E = nullptr) const {
     static const int N = FixedDimension<POINT>::value;
 
+    // Pinhole cameras with common calibrations project all at once, unless
+    // there are so few that projecting one by one is faster.
+    if constexpr (internal::CameraBatch<CAMERA, POINT>::value) {
+      if (this->size() >= 4) return projectBatch(point, Fs, E);
+    }
+
     // Allocate result
     size_t m = this->size();
     ZVector z;
@@ -132,6 +139,37 @@ class CameraSet : public std::vector<CAMERA, Eigen::aligned_allocator<CAMERA>> {
     return z;
   }
 
+ private:
+  /// project2 with BatchProjection, see internal::CameraBatch.
+  ZVector projectBatch(const Point3& point, FBlocks* Fs, Matrix* E) const {
+    using Batch = internal::CameraBatch<CAMERA, Point3>;
+    const size_t m = this->size();
+    BatchProjection<typename Batch::Calibration> batch(m);
+    for (size_t i = 0; i < m; i++)
+      batch.set(i, this->at(i).pose(), this->at(i).calibration(), point);
+    batch.project(Fs || E, Fs && Batch::kCalibration);
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+    if (!batch.allInFront()) throw CheiralityException();
+#endif
+
+    ZVector z;
+    z.reserve(m);
+    if (E) E->resize(ZDim * m, 3);
+    if (Fs) Fs->resize(m);
+    for (size_t i = 0; i < m; i++) {
+      z.push_back(batch.uv(i));
+      if (Fs) {
+        if constexpr (Batch::kCalibration)
+          (*Fs)[i] << batch.Dpose(i), batch.Dcal(i);
+        else
+          (*Fs)[i] = batch.Dpose(i);
+      }
+      if (E) E->block<ZDim, 3>(ZDim * i, 0) = batch.Dpoint(i);
+    }
+    return z;
+  }
+
+ public:
   /** An overload of the project2 function to accept
    * full matrices and vectors and pass it to the pointer
    * version of the function.
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file UndistortionGrid.h
+ * @date October 2026
+ * @brief Precomputed lookup grid for calibrate of distorted camera models.
+ */
+
+#pragma once
+
+#include <gtsam/base/Vector.h>
+#include <gtsam/geometry/Cal3.h>
+#include <gtsam/geometry/Point2.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Lookup grid for the undistortion of one calibration: calibrate is computed
+ * once at the nodes of a regular grid of pixels covering the image, after
+ * which calibrate of a pixel is a bilinear interpolation of the four nodes
+ * around it, without any iteration. Pixels outside of the grid are
+ * calibrated with the calibration itself.
+ *
+ * The interpolation error grows with the square of the grid step and with the
+ * curvature of the distortion, so the step should be chosen for the required
+ * accuracy, e.g., with maxError. Construction throws if calibrate does not
+ * converge at one of the nodes.
+ * @ingroup geometry
+ */
+template <class CALIBRATION>
+class UndistortionGrid {
+  CALIBRATION calibration_;
+  double step_;     ///< distance between nodes, in pixels
+  size_t nx_, ny_;  ///< number of nodes in u and v
+  Vector x_, y_;    ///< intrinsic coordinates of the nodes, row by row
+
+  /// Number of nodes to cover [0, length], at least 2 to form a cell.
+  static size_t NrNodes(size_t length, double step) {
+    if (!(step > 0))
+      throw std::invalid_argument("UndistortionGrid: step must be positive");
+    const size_t n = static_cast<size_t>(std::ceil(length / step)) + 1;
+    if (n < 2)
+      throw std::invalid_argument(
+          "UndistortionGrid: width and height must be positive");
+    return n;
+  }
+
+ public:
+  /**
+   * Construct the grid.
+   * @param calibration the calibration to undistort with
+   * @param width image width, the grid covers u in [0, width]
+   * @param height image height, the grid covers v in [0, height]
+   * @param step distance between nodes, in pixels
+   * Throws std::invalid_argument if width, height, or step is not positive,
+   * as the grid needs at least two nodes in u and v.
+   */
+  UndistortionGrid(const CALIBRATION& calibration, size_t width,
+                   size_t height, double step = 4.0)
+      : calibration_(calibration),
+        step_(step),
+        nx_(NrNodes(width, step)),
+        ny_(NrNodes(height, step)) {
+    Point2Vector nodes;
+    nodes.reserve(nx_ * ny_);
+    for (size_t j = 0; j < ny_; j++)
+      for (size_t i = 0; i < nx_; i++) nodes.emplace_back(i * step, j * step);
+    const Point2Vector pn = calibratePoints(calibration_, nodes);
+    x_.resize(pn.size());
+    y_.resize(pn.size());
+    for (size_t k = 0; k < pn.size(); k++) {
+      x_[k] = pn[k].x();
+      y_[k] = pn[k].y();
+    }
+  }
+
+  /// The calibration.
+  const CALIBRATION& calibration() const { return calibration_; }
+
+  /// Distance between nodes, in pixels.
+  double step() const { return step_; }
+
+  /// Whether pixel p is covered by the grid.
+  bool contains(const Point2& p) const {
+    return p.x() >= 0 && p.y() >= 0 && p.x() <= (nx_ - 1) * step_ &&
+           p.y() <= (ny_ - 1) * step_;
+  }
+
+  /// Convert image coordinates to intrinsic coordinates.
+  Point2 calibrate(const Point2& p) const {
+    if (!contains(p)) return calibration_.calibrate(p);
+    const double u = p.x() / step_, v = p.y() / step_;
+    const size_t i = std::min(static_cast<size_t>(u), nx_ - 2),
+                 j = std::min(static_cast<size_t>(v), ny_ - 2);
+    const double a = u - i, b = v - j;
+    const size_t k = j * nx_ + i;
+    const double w00 = (1 - a) * (1 - b), w01 = a * (1 - b),
+                 w10 = (1 - a) * b, w11 = a * b;
+    const size_t l = k + nx_;  // node below k
+    return Point2(w00 * x_[k] + w01 * x_[k + 1] + w10 * x_[l] + w11 * x_[l + 1],
+                  w00 * y_[k] + w01 * y_[k + 1] + w10 * y_[l] + w11 * y_[l + 1]);
+  }
+
+  /// Convert many image coordinates to intrinsic coordinates.
+  Point2Vector calibrate(const Point2Vector& pixels) const {
+    Point2Vector result(pixels.size()), outside;
+    std::vector<size_t> outsideIndices;
+    for (size_t k = 0; k < pixels.size(); k++) {
+      if (contains(pixels[k])) {
+        result[k] = calibrate(pixels[k]);
+      } else {
+        outside.push_back(pixels[k]);
+        outsideIndices.push_back(k);
+      }
+    }
+    if (!outside.empty()) {
+      const Point2Vector pn = calibratePoints(calibration_, outside);
+      for (size_t k = 0; k < pn.size(); k++) result[outsideIndices[k]] = pn[k];
+    }
+    return result;
+  }
+
+  /**
+   * Largest distance, in pixels, between a pixel and uncalibrate of its
+   * interpolated intrinsic coordinates, over the centers of all grid cells,
+   * where the interpolation error is largest.
+   */
+  double maxError() const {
+    double error = 0;
+    for (size_t j = 0; j + 1 < ny_; j++) {
+      for (size_t i = 0; i + 1 < nx_; i++) {
+        const Point2 p((i + 0.5) * step_, (j + 0.5) * step_);
+        error = std::max(
+            error, distance2(calibration_.uncalibrate(calibrate(p)), p));
+      }
+    }
+    return error;
+  }
+};
+
+}  // namespace gtsam
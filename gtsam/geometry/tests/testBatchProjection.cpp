@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testBatchProjection.cpp
+ * @date October 2026
+ * @brief unit tests for BatchProjection, against PinholeCamera::project2
+ */
+
+#include <gtsam/geometry/BatchProjection.h>
+#include <gtsam/geometry/CameraSet.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/PinholePose.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Random cameras looking at the origin, and random points near it.
+template <class CALIBRATION>
+void RandomProblem(const CALIBRATION& K, size_t n,
+                   vector<PinholeCamera<CALIBRATION>>* cameras,
+                   vector<Point3>* points) {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> uniform(-1, 1);
+  for (size_t k = 0; k < n; k++) {
+    const Point3 position(10 * uniform(rng), 10 * uniform(rng),
+                          -10 + uniform(rng));
+    const Pose3 pose = PinholeCamera<CALIBRATION>::LookatPose(
+        position, Point3(0, 0, 0), Point3(0, 1, 0));
+    cameras->emplace_back(pose, K);
+    points->emplace_back(uniform(rng), uniform(rng), uniform(rng));
+  }
+}
+
+// Compare all outputs of BatchProjection to PinholeCamera::project2.
+template <class CALIBRATION>
+bool CheckBatch(const CALIBRATION& K) {
+  using Camera = PinholeCamera<CALIBRATION>;
+  vector<Camera> cameras;
+  vector<Point3> points;
+  RandomProblem(K, 13, &cameras, &points);
+
+  BatchProjection<CALIBRATION> batch(cameras.size());
+  for (size_t k = 0; k < cameras.size(); k++)
+    batch.set(k, cameras[k].pose(), cameras[k].calibration(), points[k]);
+  batch.project(true, true);
+  bool ok = batch.allInFront();
+
+  for (size_t k = 0; k < cameras.size(); k++) {
+    Eigen::Matrix<double, 2, Camera::dimension> Dcamera;
+    Matrix23 Dpoint;
+    const Point2 expected = cameras[k].project2(points[k], Dcamera, Dpoint);
+    ok &= assert_equal(expected, batch.uv(k), 1e-9);
+    ok &= assert_equal(Matrix(Dcamera.template leftCols<6>()),
+                       Matrix(batch.Dpose(k)), 1e-8);
+    ok &= assert_equal(Matrix(Dcamera.template rightCols<Camera::dimension -
+                                                          6>()),
+                       Matrix(batch.Dcal(k)), 1e-8);
+    ok &= assert_equal(Matrix(Dpoint), Matrix(batch.Dpoint(k)), 1e-8);
+  }
+  return ok;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3_S2) {
+  EXPECT(CheckBatch(Cal3_S2(500, 480, 0.1, 320, 240)));
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3Bundler) {
+  EXPECT(CheckBatch(Cal3Bundler(500, 1e-2, 1e-3, 320, 240)));
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3DS2) {
+  EXPECT(CheckBatch(Cal3DS2(500, 480, 0.1, 320, 240, 1e-2, 1e-3, 1e-3, 2e-3)));
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3Fisheye) {
+  EXPECT(
+      CheckBatch(Cal3Fisheye(500, 480, 0.1, 320, 240, 1e-2, 1e-3, 1e-3, 2e-4)));
+}
+
+/* ************************************************************************* */
+// CameraSet::project2 uses the batch for pinhole cameras, compare with the
+// cameras projecting one by one.
+TEST(BatchProjection, CameraSet) {
+  const Cal3DS2 K(500, 480, 0.1, 320, 240, 1e-2, 1e-3, 1e-3, 2e-3);
+  vector<PinholeCamera<Cal3DS2>> cameras;
+  vector<Point3> points;
+  RandomProblem(K, 5, &cameras, &points);
+  const Point3& point = points[0];
+
+  CameraSet<PinholeCamera<Cal3DS2>> set;
+  CameraSet<PinholePose<Cal3DS2>> poseSet;
+  for (const auto& camera : cameras) {
+    set.push_back(camera);
+    poseSet.emplace_back(camera.pose(), std::make_shared<Cal3DS2>(K));
+  }
+
+  CameraSet<PinholeCamera<Cal3DS2>>::FBlocks Fs;
+  CameraSet<PinholePose<Cal3DS2>>::FBlocks poseFs;
+  Matrix E, poseE;
+  const auto z = set.project2(point, &Fs, &E);
+  const auto poseZ = poseSet.project2(point, &poseFs, &poseE);
+  EXPECT_LONGS_EQUAL(5, z.size());
+  EXPECT_LONGS_EQUAL(5, Fs.size());
+  for (size_t i = 0; i < cameras.size(); i++) {
+    Eigen::Matrix<double, 2, 15> F;
+    Matrix23 Ei;
+    const Point2 expected = cameras[i].project2(point, F, Ei);
+    EXPECT(assert_equal(expected, z[i], 1e-9));
+    EXPECT(assert_equal(expected, poseZ[i], 1e-9));
+    EXPECT(assert_equal(Matrix(F), Matrix(Fs[i]), 1e-8));
+    EXPECT(assert_equal(Matrix(F.leftCols<6>()), Matrix(poseFs[i]), 1e-8));
+    EXPECT(assert_equal(Matrix(Ei), Matrix(E.block<2, 3>(2 * i, 0)), 1e-8));
+    EXPECT(assert_equal(Matrix(Ei), Matrix(poseE.block<2, 3>(2 * i, 0)), 1e-8));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
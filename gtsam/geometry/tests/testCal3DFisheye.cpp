@@ -186,6 +186,53 @@ TEST(Cal3Fisheye, calibrate3) {
   CHECK(assert_equal(xi_hat, xi));
 }
 
+/* ************************************************************************* */
+// The batch version inverts the distortion of the angle, with the same result.
+TEST(Cal3Fisheye, calibrateBatch) {
+  const Point2Vector pis{Point2(0.5, 0.5), Point2(-0.7, -1.2), Point2(-3, 5),
+                         Point2(7, -12), Point2(0, 0), Point2(0.01, -0.02)};
+  Point2Vector uvs;
+  for (const Point2& pi : pis) uvs.push_back(K.uncalibrate(pi));
+  const Point2Vector actual = K.calibrate(uvs);
+  CHECK(actual.size() == pis.size());
+  for (size_t k = 0; k < pis.size(); k++) {
+    EXPECT(assert_equal(K.calibrate(uvs[k]), actual[k], 1e-5));
+    EXPECT(assert_equal(uvs[k], K.uncalibrate(actual[k]), 1e-5));
+  }
+}
+
+/* ************************************************************************* */
+// With strong distortion, theta_d has a maximum, and pixels beyond it have no
+// undistorted point. The batch version must then throw like calibrate does,
+// rather than return the mirrored point Newton's method runs off to.
+TEST(Cal3Fisheye, calibrateBatchStrongDistortion) {
+  const Cal3Fisheye K2(500, 500, 0, 320, 240, -0.5, 0.05, 0, -0.2);
+  const Point2Vector uvs{Point2(320, 240),    Point2(370, 240),
+                         Point2(420, 290),    Point2(320, 490),
+                         Point2(570, 240),    Point2(609.71, 240),
+                         Point2(320, 529.71)};
+  for (const Point2& uv : uvs) {
+    bool throws = false;
+    Point2 expected;
+    try {
+      expected = K2.calibrate(uv);
+    } catch (const std::runtime_error&) {
+      throws = true;
+    }
+    if (throws) {
+      CHECK_EXCEPTION(K2.calibrate(Point2Vector{uv}), std::runtime_error);
+    } else {
+      const Point2Vector actual = K2.calibrate(Point2Vector{uv});
+      EXPECT(assert_equal(expected, actual[0], 1e-5));
+      EXPECT(assert_equal(uv, K2.uncalibrate(actual[0]), 1e-5));
+    }
+  }
+  // One point without a solution fails the whole batch.
+  CHECK_EXCEPTION(K2.calibrate(Point2Vector{Point2(370, 240),
+                                            Point2(609.71, 240)}),
+                  std::runtime_error);
+}
+
 Point2 calibrate_(const Cal3Fisheye& k, const Point2& pt) {
   return k.calibrate(pt);
 }
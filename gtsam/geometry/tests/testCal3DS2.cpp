@@ -50,6 +50,18 @@ TEST(Cal3DS2, Calibrate) {
   CHECK(traits<Point2>::Equals(pn, pn_hat, 1e-5));
 }
 
+/* ************************************************************************* */
+TEST(Cal3DS2, CalibrateBatch) {
+  Point2Vector pixels;
+  for (double x = -0.6; x <= 0.6; x += 0.2)
+    for (double y = -0.4; y <= 0.4; y += 0.2)
+      pixels.push_back(K.uncalibrate(Point2(x, y)));
+  const Point2Vector actual = K.calibrate(pixels);
+  CHECK(actual.size() == pixels.size());
+  for (size_t k = 0; k < pixels.size(); k++)
+    EXPECT(assert_equal(K.calibrate(pixels[k]), actual[k], 1e-12));
+}
+
 Point2 uncalibrate_(const Cal3DS2& k, const Point2& pt) {
   return k.uncalibrate(pt);
 }
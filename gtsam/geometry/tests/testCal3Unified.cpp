@@ -61,6 +61,16 @@ TEST(Cal3Unified, Calibrate) {
   CHECK(traits<Point2>::Equals(p, pn_hat, 1e-8));
 }
 
+/* ************************************************************************* */
+TEST(Cal3Unified, CalibrateBatch) {
+  const Point2Vector pixels{K.uncalibrate(p), K.uncalibrate(Point2(-0.3, 0.1)),
+                            K.uncalibrate(Point2(0, 0))};
+  const Point2Vector actual = K.calibrate(pixels);
+  CHECK(actual.size() == 3);
+  for (size_t k = 0; k < 3; k++)
+    EXPECT(assert_equal(K.calibrate(pixels[k]), actual[k], 1e-7));
+}
+
 Point2 uncalibrate_(const Cal3Unified& k, const Point2& pt) {
   return k.uncalibrate(pt);
 }
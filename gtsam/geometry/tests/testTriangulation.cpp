@@ -30,6 +30,8 @@
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
 #include <gtsam/slam/StereoFactor.h>
 
+#include <random>
+
 using namespace std;
 using namespace gtsam;
 
@@ -853,6 +855,128 @@ TEST(triangulation, reprojectionError_cameraComparison) {
   EXPECT(assert_equal(expectedErrorSpherical, actualErrorSpherical, 1e-7));
 }
 
+//******************************************************************************
+namespace {
+using CameraDS2 = PinholeCamera<Cal3DS2>;
+
+// Cameras on a circle looking at the origin, and noisy tracks of random
+// landmarks seen by 2 to 6 of them.
+CameraSet<CameraDS2> TrackCameras() {
+  const Cal3DS2 K(500, 480, 0.0, 320, 240, -0.1, 0.02, 1e-3, -5e-4);
+  CameraSet<CameraDS2> cameras;
+  for (size_t i = 0; i < 8; i++) {
+    const double theta = 2 * M_PI * i / 8;
+    const Point3 eye(10 * cos(theta), 10 * sin(theta), 1);
+    cameras.push_back(CameraDS2::Lookat(eye, Point3(0, 0, 0), Point3(0, 0, 1), K));
+  }
+  return cameras;
+}
+
+std::vector<TriangulationTrack> RandomTracks(const CameraSet<CameraDS2>& cameras,
+                                             size_t n) {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<double> uniform(-2, 2);
+  std::normal_distribution<double> noise(0, 0.5);
+  std::vector<TriangulationTrack> tracks(n);
+  for (size_t t = 0; t < n; t++) {
+    const Point3 landmark(uniform(rng), uniform(rng), uniform(rng));
+    const size_t first = rng() % 8, length = 2 + t % 5;
+    for (size_t k = 0; k < length; k++) {
+      const size_t i = (first + k) % 8;
+      tracks[t].emplace_back(
+          i, cameras[i].project(landmark) + Point2(noise(rng), noise(rng)));
+    }
+  }
+  return tracks;
+}
+
+// Check triangulateTracks against triangulateSafe, track by track.
+bool CompareTriangulateSafe(const CameraSet<CameraDS2>& cameras,
+                            const std::vector<TriangulationTrack>& tracks,
+                            const TriangulationParameters& params, double tol) {
+  const auto actual = triangulateTracks(cameras, tracks, params);
+  if (actual.size() != tracks.size()) return false;
+  for (size_t t = 0; t < tracks.size(); t++) {
+    CameraSet<CameraDS2> trackCameras;
+    Point2Vector measured;
+    for (const auto& [i, z] : tracks[t]) {
+      trackCameras.push_back(cameras[i]);
+      measured.push_back(z);
+    }
+    const auto expected = triangulateSafe(trackCameras, measured, params);
+    if (expected.status != actual[t].status) return false;
+    if (expected && !assert_equal(*expected, *actual[t], tol)) return false;
+  }
+  return true;
+}
+}  // namespace
+
+//******************************************************************************
+TEST(triangulation, triangulateTracks) {
+  const auto cameras = TrackCameras();
+  const auto tracks = RandomTracks(cameras, 50);
+
+  TriangulationParameters params(1e-9);
+  EXPECT(CompareTriangulateSafe(cameras, tracks, params, 1e-6));
+  params.useLOST = true;
+  EXPECT(CompareTriangulateSafe(cameras, tracks, params, 1e-6));
+
+  // A repeated first view gives q_i = 0 for the next camera, so LOST pairs
+  // the first camera with the one after it, as triangulateLOST does.
+  auto repeated = tracks;
+  for (auto& track : repeated) track.insert(track.begin(), track.front());
+  EXPECT(CompareTriangulateSafe(cameras, repeated, params, 1e-6));
+
+  // Refinement: Gauss-Newton should find the same minimum as LM.
+  params.useLOST = false;
+  params.enableEPI = true;
+  params.noiseModel = noiseModel::Isotropic::Sigma(2, 0.5);
+  EXPECT(CompareTriangulateSafe(cameras, tracks, params, 1e-5));
+
+  // Robust noise models fall back on triangulateNonlinear.
+  params.noiseModel = noiseModel::Robust::Create(
+      noiseModel::mEstimator::Huber::Create(1.0), params.noiseModel);
+  EXPECT(CompareTriangulateSafe(cameras, tracks, params, 1e-9));
+}
+
+//******************************************************************************
+TEST(triangulation, triangulateTracksStatus) {
+  const auto cameras = TrackCameras();
+  auto tracks = RandomTracks(cameras, 3);
+  tracks[0].resize(1);                        // single view
+  tracks[1][1].second += Point2(50, -50);     // outlier
+  // A point far behind cameras 0 and 1, with its (unchecked) projections
+  const Point3 behind = 5 * (cameras[0].pose().translation() +
+                             cameras[1].pose().translation());
+  TriangulationTrack track;
+  for (size_t i : {0, 1}) {
+    const Point2 pn = PinholeBase::Project(cameras[i].pose().transformTo(behind));
+    track.emplace_back(i, cameras[i].calibration().uncalibrate(pn));
+  }
+  tracks.push_back(track);
+  tracks.push_back({{0, Point2(320, 240)}, {0, Point2(320, 240)}});  // same view
+
+  TriangulationParameters params(1.0, false, 100.0, 5.0);
+  const auto results = triangulateTracks(cameras, tracks, params);
+  EXPECT_LONGS_EQUAL(5, results.size());
+  EXPECT(results[0].degenerate());
+  EXPECT(results[1].outlier());
+  EXPECT(results[2].valid());
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+  EXPECT(results[3].behindCamera());
+#endif
+  EXPECT(results[4].degenerate());
+
+  params.landmarkDistanceThreshold = 5.0;
+  EXPECT(triangulateTracks(cameras, tracks, params)[2].farPoint());
+  EXPECT(CompareTriangulateSafe(cameras, tracks, params, 1e-6));
+
+  // Camera indices are checked before any track is triangulated
+  tracks.push_back({{0, Point2(320, 240)}, {cameras.size(), Point2(320, 240)}});
+  CHECK_EXCEPTION(triangulateTracks(cameras, tracks, params),
+                  std::invalid_argument);
+}
+
 //******************************************************************************
 int main() {
   TestResult tr;
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testUndistortionGrid.cpp
+ * @date October 2026
+ * @brief unit tests for UndistortionGrid
+ */
+
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Cal3Fisheye.h>
+#include <gtsam/geometry/UndistortionGrid.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+static const Cal3DS2 kDS2(500, 480, 0.1, 320, 240, -0.1, 0.01, 1e-3, 2e-3);
+static const Cal3Fisheye kFisheye(400, 410, 0.1, 320, 240, -0.0137, 0.0023,
+                                  -1e-4, 1e-5);
+
+/* ************************************************************************* */
+// At the nodes, the grid is exact, up to the tolerance of calibrate.
+TEST(UndistortionGrid, Nodes) {
+  const UndistortionGrid<Cal3DS2> grid(kDS2, 640, 480, 8.0);
+  for (const Point2 p : {Point2(0, 0), Point2(320, 240), Point2(640, 480),
+                         Point2(8, 472)}) {
+    EXPECT(grid.contains(p));
+    EXPECT(assert_equal(kDS2.calibrate(p), grid.calibrate(p), 1e-7));
+  }
+}
+
+/* ************************************************************************* */
+// Between nodes, the interpolation error shrinks with the grid step.
+TEST(UndistortionGrid, Interpolation) {
+  const UndistortionGrid<Cal3DS2> coarse(kDS2, 640, 480, 16.0),
+      fine(kDS2, 640, 480, 4.0);
+  EXPECT(fine.maxError() < 0.01);
+  EXPECT(fine.maxError() < coarse.maxError() / 8);
+
+  const UndistortionGrid<Cal3Fisheye> fisheye(kFisheye, 640, 480, 4.0);
+  EXPECT(fisheye.maxError() < 0.02);
+  const Point2 p(101.3, 377.9);
+  EXPECT(assert_equal(kFisheye.calibrate(p), fisheye.calibrate(p), 1e-4));
+}
+
+/* ************************************************************************* */
+// Pixels outside of the grid are calibrated with the calibration itself.
+TEST(UndistortionGrid, Batch) {
+  const UndistortionGrid<Cal3DS2> grid(kDS2, 320, 240, 4.0);
+  const Point2Vector pixels{Point2(10.5, 20.5), Point2(400, 300),
+                            Point2(-5, 10), Point2(100.1, 200.7)};
+  EXPECT(!grid.contains(pixels[1]));
+  const Point2Vector actual = grid.calibrate(pixels);
+  CHECK(actual.size() == 4);
+  for (size_t k = 0; k < 4; k++)
+    EXPECT(assert_equal(grid.calibrate(pixels[k]), actual[k], 1e-7));
+  EXPECT(assert_equal(kDS2.calibrate(pixels[1]), actual[1], 1e-7));
+  EXPECT(assert_equal(kDS2.calibrate(pixels[0]), actual[0], 1e-4));
+}
+
+/* ************************************************************************* */
+// A grid needs at least one cell, i.e., two nodes in u and v.
+TEST(UndistortionGrid, Degenerate) {
+  CHECK_EXCEPTION(UndistortionGrid<Cal3DS2>(kDS2, 0, 480),
+                  std::invalid_argument);
+  CHECK_EXCEPTION(UndistortionGrid<Cal3DS2>(kDS2, 640, 0),
+                  std::invalid_argument);
+  CHECK_EXCEPTION(UndistortionGrid<Cal3DS2>(kDS2, 640, 480, 0.0),
+                  std::invalid_argument);
+
+  // A single cell, larger than the image, is fine.
+  const UndistortionGrid<Cal3DS2> grid(kDS2, 1, 1, 4.0);
+  const Point2 p(0.5, 0.5);
+  EXPECT(grid.contains(p));
+  EXPECT(assert_equal(kDS2.calibrate(p), grid.calibrate(p), 1e-4));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -24,6 +24,104 @@
 
 namespace gtsam {
 
+namespace {
+// Add a row to the upper triangular factor R of the rows added so far, with
+// Givens rotations, such that R'R stays equal to A'A.
+void addRow(Matrix4* R, Vector4 row) {
+  for (int j = 0; j < 4; j++) {
+    if (row[j] == 0) continue;
+    const double r = std::sqrt((*R)(j, j) * (*R)(j, j) + row[j] * row[j]);
+    const double c = (*R)(j, j) / r, s = row[j] / r;
+    (*R)(j, j) = r;
+    for (int k = j + 1; k < 4; k++) {
+      const double rk = (*R)(j, k);
+      (*R)(j, k) = c * rk + s * row[k];
+      row[k] = c * row[k] - s * rk;
+    }
+  }
+}
+
+// The weight q_i of camera i in LOST, times the noise sigma. Camera i is paired
+// with camera j = i + 1, or if that gives q_i = 0 (or NaN), which arises if the
+// measurement vectors wZi and wZj coincide (or the baseline vector coincides
+// with the jth measurement vector), with the next camera that does not.
+// TODO(akshay-krishnan): are there better ways to select j?
+double lostWeight(const std::vector<Pose3>& poses,
+                  const Point3Vector& calibratedMeasurements, size_t i) {
+  const size_t m = poses.size();
+  const Pose3& wTi = poses[i];
+  const Point3 wZi = wTi.rotation().rotate(calibratedMeasurements[i]);
+  for (size_t k = 1; k < m; k++) {
+    const size_t j = (i + k) % m;
+    const Pose3& wTj = poses[j];
+    const Point3 d_ij = wTj.translation() - wTi.translation();
+    const Point3 wZj = wTj.rotation().rotate(calibratedMeasurements[j]);
+    const double num_i = wZi.cross(wZj).norm();
+    const double den_i = d_ij.cross(wZj).norm();
+    if (num_i > 0 && den_i > 0) return num_i / den_i;
+  }
+  throw(TriangulationUnderconstrainedException());
+}
+}  // namespace
+
+namespace internal {
+
+/* ************************************************************************* */
+Point3 triangulateDLTFixed(
+    const std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>>&
+        projection_matrices,
+    const Point2Vector& measurements, double rank_tol) {
+  Matrix4 R = Matrix4::Zero();
+  for (size_t i = 0; i < projection_matrices.size(); i++) {
+    const Matrix34& projection = projection_matrices[i];
+    const Point2& p = measurements[i];
+    addRow(&R, p.x() * projection.row(2) - projection.row(0));
+    addRow(&R, p.y() * projection.row(2) - projection.row(1));
+  }
+
+  // R has the singular values and right singular vectors of the DLT matrix.
+  const Eigen::JacobiSVD<Matrix4> svd(R, Eigen::ComputeFullV);
+  const Vector4 s = svd.singularValues();
+  const int rank = (s.array() > rank_tol).count();
+  if (rank < 3) throw(TriangulationUnderconstrainedException());
+
+  const Vector4 v = svd.matrixV().col(3);
+  return Point3(v.head<3>() / v[3]);
+}
+
+/* ************************************************************************* */
+Point3 triangulateLOSTFixed(const std::vector<Pose3>& poses,
+                            const Point3Vector& calibratedMeasurements,
+                            double rank_tol) {
+  // Rows [A b] of the LOST system, see triangulateLOST. The isotropic noise
+  // sigma scales all rows equally, and is left out.
+  Matrix4 R = Matrix4::Zero();
+  for (size_t i = 0; i < poses.size(); i++) {
+    const Pose3& wTi = poses[i];
+    const double q_i = lostWeight(poses, calibratedMeasurements, i);
+    const Matrix23 coefficientMat =
+        q_i * skewSymmetric(calibratedMeasurements[i]).topLeftCorner(2, 3) *
+        wTi.rotation().matrix().transpose();
+    const Vector2 b = coefficientMat * wTi.translation();
+    for (int k = 0; k < 2; k++) {
+      Vector4 row;
+      row << coefficientMat.row(k).transpose(), b[k];
+      addRow(&R, row);
+    }
+  }
+
+  // Least-squares solution of the triangular system, with the rank relative to
+  // the largest singular value, like the pivots of ColPivHouseholderQR.
+  const Matrix3 R3 = R.topLeftCorner<3, 3>();
+  const Vector3 s = Eigen::JacobiSVD<Matrix3>(R3).singularValues();
+  if (!(s[2] > rank_tol * s[0]))
+    throw(TriangulationUnderconstrainedException());
+  return R3.triangularView<Eigen::Upper>().solve(R.col(3).head<3>());
+}
+
+}  // namespace internal
+
+/* ************************************************************************* */
 Vector4 triangulateHomogeneousDLT(
     const std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>>&
         projection_matrices,
@@ -96,39 +194,9 @@ Point3 triangulateLOST(const std::vector<Pose3>& poses,
 
   for (size_t i = 0; i < m; i++) {
     const Pose3& wTi = poses[i];
-    // TODO(akshay-krishnan): are there better ways to select j?
-    int j = (i + 1) % m;
-    const Pose3& wTj = poses[j];
-
-    Point3 d_ij = wTj.translation() - wTi.translation();
-    Point3 wZi = wTi.rotation().rotate(calibratedMeasurements[i]);
-    Point3 wZj = wTj.rotation().rotate(calibratedMeasurements[j]);
-    double num_i = wZi.cross(wZj).norm();
-    double den_i = d_ij.cross(wZj).norm();
-
-    // Handle q_i = 0 (or NaN), which arises if the measurement vectors, wZi and 
-    // wZj, coincide (or the baseline vector coincides with the jth measurement 
-    // vector).
-    if (num_i == 0 || den_i == 0) {
-      bool success = false;
-      for (size_t k = 2; k < m; k++) {
-        j = (i + k) % m;
-        const Pose3& wTj = poses[j];
-
-        d_ij = wTj.translation() - wTi.translation();
-        wZj = wTj.rotation().rotate(calibratedMeasurements[j]);
-        num_i = wZi.cross(wZj).norm();
-        den_i = d_ij.cross(wZj).norm();
-        if (num_i > 0 && den_i > 0) {
-          success = true;
-          break;
-        }
-      }
-      if (!success) throw(TriangulationUnderconstrainedException());
-    }
-
     // Note: Setting q_i = 1.0 gives same results as DLT.
-    const double q_i = num_i / (measurementNoise->sigma() * den_i);
+    const double q_i = lostWeight(poses, calibratedMeasurements, i) /
+                       measurementNoise->sigma();
 
     const Matrix23 coefficientMat =
         q_i * skewSymmetric(calibratedMeasurements[i]).topLeftCorner(2, 3) *
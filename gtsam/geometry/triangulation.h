@@ -33,6 +33,12 @@
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/slam/TriangulationFactor.h>
+#include <gtsam/config.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #include <optional>
 
@@ -282,15 +288,11 @@ template <class CALIBRATION>
 Point2Vector undistortMeasurements(const CALIBRATION& cal,
                                    const Point2Vector& measurements) {
   Cal3_S2 pinholeCalibration = createPinholeCalibration(cal);
-  Point2Vector undistortedMeasurements;
   // Calibrate with cal and uncalibrate with pinhole version of cal so that
   // measurements are undistorted.
-  std::transform(measurements.begin(), measurements.end(),
-                 std::back_inserter(undistortedMeasurements),
-                 [&cal, &pinholeCalibration](const Point2& measurement) {
-                   return undistortMeasurementInternal<CALIBRATION>(
-                       cal, measurement, pinholeCalibration);
-                 });
+  Point2Vector undistortedMeasurements = calibratePoints(cal, measurements);
+  for (Point2& measurement : undistortedMeasurements)
+    measurement = pinholeCalibration.uncalibrate(measurement);
   return undistortedMeasurements;
 }
 
@@ -360,16 +362,10 @@ inline SphericalCamera::MeasurementVector undistortMeasurements(
 template <class CALIBRATION>
 inline Point3Vector calibrateMeasurementsShared(
     const CALIBRATION& cal, const Point2Vector& measurements) {
-  Point3Vector calibratedMeasurements;
-  // Calibrate with cal and uncalibrate with pinhole version of cal so that
-  // measurements are undistorted.
-  std::transform(measurements.begin(), measurements.end(),
-                 std::back_inserter(calibratedMeasurements),
-                 [&cal](const Point2& measurement) {
-                   Point3 p;
-                   p << cal.calibrate(measurement), 1.0;
-                   return p;
-                 });
+  const Point2Vector pn = calibratePoints(cal, measurements);
+  Point3Vector calibratedMeasurements(pn.size());
+  for (size_t k = 0; k < pn.size(); k++)
+    calibratedMeasurements[k] << pn[k], 1.0;
   return calibratedMeasurements;
 }
 
@@ -757,6 +753,255 @@ TriangulationResult triangulateSafe(const CameraSet<CAMERA>& cameras,
     }
 }
 
+/// Measurements of one landmark, as pairs of camera index and measurement.
+using TriangulationTrack = std::vector<std::pair<size_t, Point2>>;
+
+namespace internal {
+
+/**
+ * Same as triangulateDLT, but the rows of the DLT matrix are reduced to a 4*4
+ * triangular factor with Givens rotations as they are formed, so that only a
+ * fixed-size SVD is needed, and no dynamic matrix is allocated.
+ */
+GTSAM_EXPORT Point3 triangulateDLTFixed(
+    const std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>>&
+        projection_matrices,
+    const Point2Vector& measurements, double rank_tol);
+
+/**
+ * Same as triangulateLOST, with fixed-size matrices as triangulateDLTFixed.
+ * The rank is that of the 3*3 factor, relative to its largest singular value.
+ */
+GTSAM_EXPORT Point3 triangulateLOSTFixed(
+    const std::vector<Pose3>& poses, const Point3Vector& calibratedMeasurements,
+    double rank_tol);
+
+/**
+ * Refine a triangulated point with Gauss-Newton on the whitened reprojection
+ * errors, i.e., the same cost as triangulateNonlinear, but on Point3 directly
+ * with 3*3 normal equations. Steps that increase the error are halved.
+ * @param W square root information matrix of the measurements
+ */
+template <class CAMERA>
+Point3 refineTriangulation(const CameraSet<CAMERA>& cameras,
+                           const TriangulationTrack& track,
+                           const Point3& initial, const Matrix2& W,
+                           size_t maxIterations = 10) {
+  // Whitened error, and optionally its normal equations
+  auto linearize = [&](const Point3& point, Matrix3* H, Vector3* g) {
+    double error = 0;
+    if (H) H->setZero();
+    if (g) g->setZero();
+    for (const auto& [i, z] : track) {
+      Matrix23 D;
+      const Vector2 e = W * (cameras[i].project2(point, {}, H ? &D : nullptr) - z);
+      error += e.squaredNorm();
+      if (H) {
+        const Matrix23 J = W * D;
+        *H += J.transpose() * J;
+        *g += J.transpose() * e;
+      }
+    }
+    return 0.5 * error;
+  };
+
+  Point3 point = initial;
+  try {
+    Matrix3 H;
+    Vector3 g;
+    double error = linearize(point, &H, &g);
+    for (size_t iteration = 0; iteration < maxIterations; iteration++) {
+      const Eigen::LDLT<Matrix3> ldlt(H);
+      if (ldlt.info() != Eigen::Success || !ldlt.isPositive()) break;
+      Vector3 delta = -ldlt.solve(g);
+      double newError = linearize(point + delta, nullptr, nullptr);
+      for (int k = 0; k < 5 && newError > error; k++) {
+        delta *= 0.5;
+        newError = linearize(point + delta, nullptr, nullptr);
+      }
+      if (newError > error) break;
+      point += delta;
+      const bool converged = error - newError <= 1e-10 * error ||
+                             delta.norm() <= 1e-10 * (1 + point.norm());
+      if (converged) break;
+      error = linearize(point, &H, &g);
+    }
+  } catch (CheiralityException&) {
+    // Keep the last point, the checks in triangulateTracks handle it.
+  }
+  return point;
+}
+
+/// Scratch space of triangulateTracks, reused for all tracks of one thread.
+struct TriangulationBuffers {
+  std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>> projections;
+  Point2Vector measurements;
+  std::vector<Pose3> poses;
+  Point3Vector calibrated;
+};
+
+/// triangulateSafe for one track of triangulateTracks.
+template <class CAMERA>
+TriangulationResult triangulateTrack(
+    const CameraSet<CAMERA>& cameras,
+    const std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>>&
+        projections,
+    const std::vector<Cal3_S2>& pinholeCalibrations,
+    const TriangulationTrack& track, const TriangulationParameters& params,
+    const Matrix2* W, TriangulationBuffers* buffers) {
+  using Calibration = typename CAMERA::CalibrationType;
+  if (track.size() < 2) return TriangulationResult::Degenerate();
+
+  Point3 point;
+  try {
+    if (params.useLOST) {
+      buffers->poses.clear();
+      buffers->calibrated.clear();
+      for (const auto& [i, z] : track) {
+        buffers->poses.push_back(cameras[i].pose());
+        Point3 p;
+        p << cameras[i].calibration().calibrate(z), 1.0;
+        buffers->calibrated.push_back(p);
+      }
+      point = triangulateLOSTFixed(buffers->poses, buffers->calibrated,
+                                   params.rankTolerance);
+    } else {
+      buffers->projections.clear();
+      buffers->measurements.clear();
+      for (const auto& [i, z] : track) {
+        buffers->projections.push_back(projections[i]);
+        if constexpr (std::is_same_v<Calibration, Cal3_S2>) {
+          buffers->measurements.push_back(z);
+        } else {
+          buffers->measurements.push_back(undistortMeasurementInternal(
+              cameras[i].calibration(), z, pinholeCalibrations[i]));
+        }
+      }
+      point = triangulateDLTFixed(buffers->projections, buffers->measurements,
+                                  params.rankTolerance);
+    }
+  } catch (TriangulationUnderconstrainedException&) {
+    return TriangulationResult::Degenerate();
+  }
+
+  if (params.enableEPI) {
+    if (W) {
+      point = refineTriangulation(cameras, track, point, *W);
+    } else {
+      // Non-Gaussian (e.g., robust) noise models use the factor graph.
+      CameraSet<CAMERA> trackCameras;
+      Point2Vector measured;
+      for (const auto& [i, z] : track) {
+        trackCameras.push_back(cameras[i]);
+        measured.push_back(z);
+      }
+      point = triangulateNonlinear<CAMERA>(trackCameras, measured, point,
+                                           params.noiseModel);
+    }
+  }
+
+  // Same checks as triangulatePoint3 and triangulateSafe
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+  for (const auto& [i, z] : track) {
+    if (cameras[i].pose().transformTo(point).z() <= 0)
+      return TriangulationResult::BehindCamera();
+  }
+#endif
+  double maxReprojError = 0.0;
+  for (const auto& [i, z] : track) {
+    if (params.landmarkDistanceThreshold > 0 &&
+        distance3(cameras[i].pose().translation(), point) >
+            params.landmarkDistanceThreshold)
+      return TriangulationResult::FarPoint();
+    if (params.dynamicOutlierRejectionThreshold > 0) {
+      maxReprojError = std::max(
+          maxReprojError, cameras[i].reprojectionError(point, z).norm());
+    }
+  }
+  if (params.dynamicOutlierRejectionThreshold > 0 &&
+      maxReprojError > params.dynamicOutlierRejectionThreshold)
+    return TriangulationResult::Outlier();
+  return TriangulationResult(point);
+}
+
+}  // namespace internal
+
+/**
+ * Triangulate many landmarks at once, e.g., in the inner loop of an
+ * incremental mapper. Each track is triangulated as by triangulateSafe with
+ * the cameras and measurements of that track, with two differences that
+ * make it faster, so results agree up to round-off:
+ *  - DLT and LOST use fixed-size matrices, see triangulateDLTFixed. LOST
+ *    pairs the cameras of a track as triangulateLOST does, but decides the
+ *    rank from singular values, so tracks within round-off of rank_tol can
+ *    be degenerate in one and not in the other.
+ *  - If params.enableEPI, the point is refined with Gauss-Newton on Point3
+ *    rather than with Levenberg-Marquardt on a factor graph. This applies to
+ *    Gaussian noise models; other ones still use triangulateNonlinear.
+ * Tracks are triangulated in parallel if TBB is enabled.
+ * @param cameras all cameras, indexed by the tracks
+ * @param tracks for each landmark, its camera indices and measurements
+ * @param params triangulation parameters, as in triangulateSafe
+ * @return one TriangulationResult per track
+ * @throws std::invalid_argument if a track has a camera index out of range
+ */
+template <class CAMERA>
+std::vector<TriangulationResult> triangulateTracks(
+    const CameraSet<CAMERA>& cameras,
+    const std::vector<TriangulationTrack>& tracks,
+    const TriangulationParameters& params) {
+  static_assert(std::is_same_v<typename CAMERA::Measurement, Point2>,
+                "triangulateTracks: only for cameras with Point2 measurements");
+  for (const TriangulationTrack& track : tracks) {
+    for (const auto& [i, z] : track) {
+      if (i >= cameras.size())
+        throw std::invalid_argument(
+            "triangulateTracks: camera index " + std::to_string(i) +
+            " out of range for " + std::to_string(cameras.size()) +
+            " cameras");
+    }
+  }
+
+  // Projection matrices and pinhole calibrations of all cameras, once
+  std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>> projections;
+  std::vector<Cal3_S2> pinholeCalibrations;
+  projections.reserve(cameras.size());
+  pinholeCalibrations.reserve(cameras.size());
+  for (const CAMERA& camera : cameras) {
+    projections.push_back(camera.cameraProjectionMatrix());
+    pinholeCalibrations.push_back(
+        createPinholeCalibration(camera.calibration()));
+  }
+
+  // Square root information matrix for Gauss-Newton refinement
+  std::optional<Matrix2> W;
+  if (!params.noiseModel) {
+    W = Matrix2::Identity();
+  } else if (auto gaussian = std::dynamic_pointer_cast<noiseModel::Gaussian>(
+                 params.noiseModel)) {
+    W = gaussian->R();
+  }
+
+  std::vector<TriangulationResult> results(tracks.size());
+  auto triangulateRange = [&](size_t begin, size_t end) {
+    internal::TriangulationBuffers buffers;
+    for (size_t t = begin; t < end; t++) {
+      results[t] = internal::triangulateTrack(
+          cameras, projections, pinholeCalibrations, tracks[t], params,
+          W ? &*W : nullptr, &buffers);
+    }
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, tracks.size()),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      triangulateRange(range.begin(), range.end());
+                    });
+#else
+  triangulateRange(0, tracks.size());
+#endif
+  return results;
+}
+
 // Vector of Cameras - used by the Python/MATLAB wrapper
 using CameraSetCal3Bundler = CameraSet<PinholeCamera<Cal3Bundler>>;
 using CameraSetCal3_S2 = CameraSet<PinholeCamera<Cal3_S2>>;
@@ -16,12 +16,18 @@
  * @date   January 2022
  */
 
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/discrete/DiscreteBayesNet.h>
 #include <gtsam/discrete/DiscreteConditional.h>
 #include <gtsam/discrete/DiscreteFactorGraph.h>
 #include <gtsam/hybrid/HybridBayesNet.h>
 #include <gtsam/hybrid/HybridValues.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <map>
 #include <memory>
 
 // In Wrappers we have no access to this so have a default ready
@@ -184,6 +190,70 @@ HybridValues HybridBayesNet::sample() const {
   return sample(&kRandomNumberGenerator);
 }
 
+/* ************************************************************************* */
+std::pair<Matrix, std::vector<DiscreteValues>> HybridBayesNet::sampleBatch(
+    const HybridValues &given, size_t nrSamples,
+    std::uint_fast64_t seed) const {
+  // Same chunking as GaussianBayesNet::sampleBatch, for reproducibility.
+  constexpr size_t kChunkSize = 1024;
+
+  DiscreteBayesNet dbn;
+  for (auto &&conditional : *this) {
+    if (conditional->isDiscrete()) dbn.push_back(conditional->asDiscrete());
+  }
+
+  // Sample all discrete assignments.
+  std::vector<DiscreteValues> assignments(nrSamples);
+  const size_t nrChunks = (nrSamples + kChunkSize - 1) / kChunkSize;
+  auto sampleChunk = [&](size_t chunk) {
+    std::seed_seq seq{static_cast<std::uint64_t>(seed),
+                      static_cast<std::uint64_t>(chunk)};
+    std::mt19937_64 rng(seq);
+    const size_t end = std::min(nrSamples, (chunk + 1) * kChunkSize);
+    for (size_t i = chunk * kChunkSize; i < end; ++i)
+      assignments[i] = dbn.sample(given.discrete(), &rng);
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, nrChunks),
+                    [&](const tbb::blocked_range<size_t> &range) {
+                      for (size_t c = range.begin(); c != range.end(); ++c)
+                        sampleChunk(c);
+                    });
+#else
+  for (size_t c = 0; c < nrChunks; ++c) sampleChunk(c);
+#endif
+
+  // Group samples by assignment, in a deterministic order.
+  std::map<DiscreteValues, std::vector<size_t>> groups;
+  for (size_t i = 0; i < nrSamples; ++i) groups[assignments[i]].push_back(i);
+
+  // Sample the continuous variables of each group as one batch.
+  Matrix samples;
+  std::mt19937_64 seeds(seed);
+  for (auto &&[assignment, indices] : groups) {
+    const GaussianBayesNet gbn = choose(assignment);
+    const Matrix X =
+        gbn.sampleBatch(given.continuous(), indices.size(), seeds());
+    if (samples.size() == 0) {
+      samples.resize(nrSamples, X.cols());
+    } else if (X.cols() != samples.cols()) {
+      throw std::runtime_error(
+          "HybridBayesNet::sampleBatch: continuous dimension depends on the "
+          "discrete assignment");
+    }
+    for (size_t k = 0; k < indices.size(); ++k)
+      samples.row(indices[k]) = X.row(k);
+  }
+  return {samples, assignments};
+}
+
+/* ************************************************************************* */
+std::pair<Matrix, std::vector<DiscreteValues>> HybridBayesNet::sampleBatch(
+    size_t nrSamples, std::uint_fast64_t seed) const {
+  HybridValues given;
+  return sampleBatch(given, nrSamples, seed);
+}
+
 /* ************************************************************************* */
 AlgebraicDecisionTree<Key> HybridBayesNet::errorTree(
     const VectorValues &continuousValues) const {
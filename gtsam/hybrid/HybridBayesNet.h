@@ -205,6 +205,29 @@ class GTSAM_EXPORT HybridBayesNet : public BayesNet<HybridConditional> {
    */
   HybridValues sample() const;
 
+  /**
+   * @brief Draw many samples at once using batched ancestral sampling.
+   *
+   * Discrete assignments are sampled first, in chunks with independent
+   * random number streams. Samples that share an assignment are then drawn
+   * together with GaussianBayesNet::sampleBatch on the selected Bayes net.
+   * The result only depends on `seed`, not on the number of threads.
+   *
+   * @param given Values of missing variables.
+   * @param nrSamples number of samples to draw.
+   * @param seed seed for the random number streams.
+   * @return nrSamples x n matrix of continuous samples, one per row, with
+   * columns following the continuous frontal variables in Bayes net order,
+   * and the discrete assignment of every sample.
+   */
+  std::pair<Matrix, std::vector<DiscreteValues>> sampleBatch(
+      const HybridValues &given, size_t nrSamples,
+      std::uint_fast64_t seed = 42u) const;
+
+  /// Draw many samples at once from a complete Bayes net, see above.
+  std::pair<Matrix, std::vector<DiscreteValues>> sampleBatch(
+      size_t nrSamples, std::uint_fast64_t seed = 42u) const;
+
   /**
    * @brief Prune the Bayes Net such that we have at most maxNrLeaves leaves.
    *
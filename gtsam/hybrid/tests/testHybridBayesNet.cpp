@@ -565,6 +565,33 @@ TEST(HybridBayesNet, Sampling) {
   // num_samples)));
 }
 
+/* ****************************************************************************/
+// Test batch sampling on the tiny Bayes net P(z|x,mode)P(x)P(mode).
+TEST(HybridBayesNet, SampleBatch) {
+  auto bayesNet = tiny::createHybridBayesNet();
+
+  constexpr size_t N = 20000;
+  const auto [samples, assignments] = bayesNet.sampleBatch(N, 3);
+  EXPECT_LONGS_EQUAL(N, samples.rows());
+  EXPECT_LONGS_EQUAL(2, samples.cols());  // columns are z, x
+  EXPECT_LONGS_EQUAL(N, assignments.size());
+
+  // P(mode=1) is 0.6
+  size_t ones = 0;
+  for (const DiscreteValues& assignment : assignments)
+    ones += assignment.at(M(0));
+  EXPECT_DOUBLES_EQUAL(0.6, double(ones) / N, 0.02);
+
+  // Both z and x have mean 5
+  EXPECT(assert_equal(Vector2(5.0, 5.0), Vector(samples.colwise().mean()),
+                      0.1));
+
+  // Reproducible for a given seed
+  const auto [again, againAssignments] = bayesNet.sampleBatch(N, 3);
+  EXPECT(assert_equal(samples, again));
+  EXPECT(assignments == againAssignments);
+}
+
 /* ****************************************************************************/
 // Test hybrid gaussian factor graph errorTree when
 // there is a HybridConditional in the graph
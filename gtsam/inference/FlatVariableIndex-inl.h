@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FlatVariableIndex-inl.h
+ * @brief   Template methods of FlatVariableIndex
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/timing.h>
+#include <gtsam/inference/FlatVariableIndex.h>
+
+#include <algorithm>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+template <class FG>
+void FlatVariableIndex::augment(const FG& factors,
+                                const FactorIndices* newFactorIndices) {
+  gttic(FlatVariableIndex_augment);
+
+  for (size_t i = 0; i < factors.size(); ++i) {
+    if (factors[i]) {
+      const size_t globalI =
+          newFactorIndices ? (*newFactorIndices)[i] : nFactors_;
+      for (const Key key : *factors[i]) {
+        factorsOf(key).push_back(globalI);
+        ++nEntries_;
+      }
+    }
+
+    // Increment factor count even if factors are null, to keep indices
+    // consistent
+    if (newFactorIndices) {
+      if ((*newFactorIndices)[i] >= nFactors_)
+        nFactors_ = (*newFactorIndices)[i] + 1;
+    } else {
+      ++nFactors_;
+    }
+  }
+}
+
+/* ************************************************************************* */
+template <typename ITERATOR, class FG>
+void FlatVariableIndex::remove(ITERATOR firstFactor, ITERATOR lastFactor,
+                               const FG& factors) {
+  gttic(FlatVariableIndex_remove);
+
+  // As in VariableIndex, nFactors_ is intentionally not decremented.
+  ITERATOR factorIndex = firstFactor;
+  size_t i = 0;
+  for (; factorIndex != lastFactor; ++factorIndex, ++i) {
+    if (i >= factors.size())
+      throw std::invalid_argument(
+          "Internal error, requested inconsistent number of factor indices and "
+          "factors in FlatVariableIndex::remove");
+    if (factors[i]) {
+      for (Key j : *factors[i]) {
+        auto item = findMutable(j);
+        FactorIndices::iterator entry;
+        if (item != entries_.end())
+          entry = std::find(item->second.begin(), item->second.end(),
+                            *factorIndex);
+        if (item == entries_.end() || entry == item->second.end())
+          throw std::invalid_argument(
+              "Internal error, indices and factors passed into "
+              "FlatVariableIndex::remove are not consistent with the existing "
+              "variable index");
+        item->second.erase(entry);
+        --nEntries_;
+      }
+    }
+  }
+}
+
+/* ************************************************************************* */
+template <typename ITERATOR>
+void FlatVariableIndex::removeUnusedVariables(ITERATOR firstKey,
+                                              ITERATOR lastKey) {
+  // Check all keys first, so the index is unchanged if one is still used.
+  for (ITERATOR key = firstKey; key != lastKey; ++key) {
+    const_iterator entry = find(*key);
+    if (entry == end() || !entry->second.empty())
+      throw std::invalid_argument(
+          "Asking to remove variables from the variable index that are not "
+          "unused");
+  }
+  for (ITERATOR key = firstKey; key != lastKey; ++key) erase(*key);
+}
+
+}  // namespace gtsam
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FlatVariableIndex.cpp
+ * @brief   VariableIndex stored in flat arrays with a hash table instead of a tree
+ * @date    October 2026
+ */
+
+#include <gtsam/inference/FlatVariableIndex.h>
+
+#include <algorithm>
+#include <iostream>
+
+namespace gtsam {
+
+using namespace std;
+
+namespace {
+/// Mix the bits of a key, as consecutive keys only differ in their low bits.
+size_t hashKey(Key key) {
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  return key;
+}
+}  // namespace
+
+/* ************************************************************************* */
+FlatVariableIndex::FlatVariableIndex(const VariableIndex& variableIndex)
+    : nFactors_(variableIndex.nFactors()),
+      nEntries_(variableIndex.nEntries()) {
+  entries_.reserve(variableIndex.size());
+  for (const auto& [key, factors] : variableIndex)
+    factorsOf(key) = factors;
+}
+
+/* ************************************************************************* */
+size_t FlatVariableIndex::findSlot(Key key) const {
+  const size_t mask = slots_.size() - 1;
+  size_t slot = hashKey(key) & mask;
+  while (slots_[slot] != 0 && entries_[slots_[slot] - 1].first != key)
+    slot = (slot + 1) & mask;
+  return slot;
+}
+
+/* ************************************************************************* */
+FlatVariableIndex::const_iterator FlatVariableIndex::find(Key key) const {
+  if (slots_.empty()) return entries_.end();
+  const size_t position = slots_[findSlot(key)];
+  return position ? entries_.begin() + (position - 1) : entries_.end();
+}
+
+/* ************************************************************************* */
+FlatVariableIndex::Entries::iterator FlatVariableIndex::findMutable(Key key) {
+  if (slots_.empty()) return entries_.end();
+  const size_t position = slots_[findSlot(key)];
+  return position ? entries_.begin() + (position - 1) : entries_.end();
+}
+
+/* ************************************************************************* */
+FactorIndices& FlatVariableIndex::factorsOf(Key key) {
+  // Keep the table at most half full, so probes stay short.
+  if (2 * (entries_.size() + 1) > slots_.size())
+    rehash(std::max<size_t>(16, 2 * slots_.size()));
+  size_t& position = slots_[findSlot(key)];
+  if (position == 0) {
+    entries_.emplace_back(key, FactorIndices());
+    position = entries_.size();
+  }
+  return entries_[position - 1].second;
+}
+
+/* ************************************************************************* */
+void FlatVariableIndex::rehash(size_t nrSlots) {
+  slots_.assign(nrSlots, 0);
+  for (size_t i = 0; i < entries_.size(); ++i)
+    slots_[findSlot(entries_[i].first)] = i + 1;
+}
+
+/* ************************************************************************* */
+void FlatVariableIndex::erase(Key key) {
+  if (slots_.empty()) return;
+  size_t hole = findSlot(key);
+  const size_t position = slots_[hole];
+  if (position == 0) return;
+
+  // Move the last entry into the place of the removed one.
+  if (position != entries_.size()) {
+    slots_[findSlot(entries_.back().first)] = position;
+    entries_[position - 1] = std::move(entries_.back());
+  }
+  entries_.pop_back();
+
+  // Shift later slots of the probe sequence back into the hole, so that every
+  // key can still be reached from its home slot without tombstones.
+  const size_t mask = slots_.size() - 1;
+  slots_[hole] = 0;
+  for (size_t slot = (hole + 1) & mask; slots_[slot] != 0;
+       slot = (slot + 1) & mask) {
+    const size_t home = hashKey(entries_[slots_[slot] - 1].first) & mask;
+    if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+      slots_[hole] = slots_[slot];
+      slots_[slot] = 0;
+      hole = slot;
+    }
+  }
+}
+
+/* ************************************************************************* */
+bool FlatVariableIndex::equals(const FlatVariableIndex& other,
+                               double tol) const {
+  if (this->nEntries_ != other.nEntries_ ||
+      this->nFactors_ != other.nFactors_ ||
+      this->entries_.size() != other.entries_.size())
+    return false;
+  // The entries are in the order they were added, so compare them by key.
+  for (const value_type& key_factors : entries_) {
+    const const_iterator entry = other.find(key_factors.first);
+    if (entry == other.end() || entry->second != key_factors.second)
+      return false;
+  }
+  return true;
+}
+
+/* ************************************************************************* */
+void FlatVariableIndex::print(const string& str,
+                              const KeyFormatter& keyFormatter) const {
+  cout << str;
+  cout << "nEntries = " << nEntries() << ", nFactors = " << nFactors() << "\n";
+  for (const value_type& key_factors : entries_) {
+    cout << "var " << keyFormatter(key_factors.first) << ":";
+    for (const auto index : key_factors.second) cout << " " << index;
+    cout << "\n";
+  }
+  cout.flush();
+}
+
+/* ************************************************************************* */
+void FlatVariableIndex::augmentExistingFactor(const FactorIndex factorIndex,
+                                              const KeySet& newKeys) {
+  gttic(FlatVariableIndex_augmentExistingFactor);
+
+  for (const Key key : newKeys) {
+    factorsOf(key).push_back(factorIndex);
+    ++nEntries_;
+  }
+
+  gttoc(FlatVariableIndex_augmentExistingFactor);
+}
+
+}  // namespace gtsam
@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    FlatVariableIndex.h
+ * @brief   VariableIndex stored in flat arrays with a hash table instead of a tree
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/inference/Factor.h>
+#include <gtsam/inference/Key.h>
+#include <gtsam/inference/VariableIndex.h>
+#include <gtsam/dllexport.h>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A drop-in alternative to VariableIndex that keeps the (key, factors) entries
+ * in one vector, in the order the keys were added, instead of in a FastMap
+ * with a node per key. Entries are found through an open-addressing hash
+ * table of their positions, so a lookup is a hash and a short linear probe,
+ * and a new key is appended to the vector wherever it falls in the key range.
+ *
+ * The entries are not sorted: iteration visits the variables in the order
+ * they were added, and removeUnusedVariables moves the last entry into the
+ * place of a removed one. Use VariableIndex where the order matters, e.g. to
+ * compute a COLAMD ordering.
+ *
+ * The interface mirrors VariableIndex: augment, augmentExistingFactor, remove,
+ * removeUnusedVariables, operator[], find, and iteration over entries.
+ * \nosubgrouping
+ */
+class GTSAM_EXPORT FlatVariableIndex {
+ public:
+  typedef std::shared_ptr<FlatVariableIndex> shared_ptr;
+  typedef std::pair<Key, FactorIndices> value_type;
+
+ protected:
+  typedef std::vector<value_type> Entries;
+  Entries entries_;            // in the order the keys were added
+  std::vector<size_t> slots_;  // hash table of entry positions + 1, 0 if empty
+  size_t nFactors_;  // Number of factors in the original factor graph.
+  size_t nEntries_;  // Sum of involved variable counts of each factor.
+
+ public:
+  typedef Entries::const_iterator const_iterator;
+  typedef Entries::const_iterator iterator;
+
+  /// @name Standard Constructors
+  /// @{
+
+  /// Default constructor, creates an empty FlatVariableIndex
+  FlatVariableIndex() : nFactors_(0), nEntries_(0) {}
+
+  /// Create from a factor graph.
+  template <class FG>
+  explicit FlatVariableIndex(const FG& factorGraph)
+      : nFactors_(0), nEntries_(0) {
+    augment(factorGraph);
+  }
+
+  /// Create from a VariableIndex.
+  explicit FlatVariableIndex(const VariableIndex& variableIndex);
+
+  /// @}
+  /// @name Standard Interface
+  /// @{
+
+  /// The number of variable entries.
+  size_t size() const { return entries_.size(); }
+
+  /// The number of factors in the original factor graph
+  size_t nFactors() const { return nFactors_; }
+
+  /// The number of nonzero blocks, i.e. the number of variable-factor entries
+  size_t nEntries() const { return nEntries_; }
+
+  /// Access a list of factors by variable
+  const FactorIndices& operator[](Key variable) const {
+    const_iterator item = find(variable);
+    if (item == end())
+      throw std::invalid_argument("Requested non-existent variable '" +
+                                  DefaultKeyFormatter(variable) +
+                                  "' from FlatVariableIndex");
+    return item->second;
+  }
+
+  /// Return true if no factors associated with a variable
+  bool empty(Key variable) const { return (*this)[variable].empty(); }
+
+  /// @}
+  /// @name Testable
+  /// @{
+
+  /// Test for equality (for unit tests and debug assertions).
+  bool equals(const FlatVariableIndex& other, double tol = 0.0) const;
+
+  /// Print the variable index (for unit tests and debugging).
+  void print(const std::string& str = "FlatVariableIndex: ",
+             const KeyFormatter& keyFormatter = DefaultKeyFormatter) const;
+
+  /// @}
+  /// @name Advanced Interface
+  /// @{
+
+  /// Augment the variable index with new factors, see VariableIndex::augment.
+  template <class FG>
+  void augment(const FG& factors,
+               const FactorIndices* newFactorIndices = nullptr);
+
+  /// An overload of augment() that takes an l-value reference to indices.
+  template <class FG>
+  void augment(const FG& factors, const FactorIndices& newFactorIndices) {
+    augment(factors, &newFactorIndices);
+  }
+
+  /// Augment after an existing factor now involves more variable Keys.
+  void augmentExistingFactor(const FactorIndex factorIndex,
+                             const KeySet& newKeys);
+
+  /// Remove entries corresponding to the specified factors, see
+  /// VariableIndex::remove.
+  template <typename ITERATOR, class FG>
+  void remove(ITERATOR firstFactor, ITERATOR lastFactor, const FG& factors);
+
+  /// Remove unused empty variables, in a single pass over the array.
+  template <typename ITERATOR>
+  void removeUnusedVariables(ITERATOR firstKey, ITERATOR lastKey);
+
+  /// Iterator to the first variable entry
+  const_iterator begin() const { return entries_.begin(); }
+
+  /// Iterator to the end of the variable entries
+  const_iterator end() const { return entries_.end(); }
+
+  /// Find the iterator for the requested variable entry
+  const_iterator find(Key key) const;
+
+ protected:
+  /// Mutable version of find, returns entries_.end() if not found.
+  Entries::iterator findMutable(Key key);
+
+  /// The factors of a variable, appending an empty entry if it is new.
+  FactorIndices& factorsOf(Key key);
+
+  /// The slot of a key in the hash table, or the empty slot it would go in.
+  size_t findSlot(Key key) const;
+
+  /// Rebuild the hash table with the given power-of-two number of slots.
+  void rehash(size_t nrSlots);
+
+  /// Remove the entry of a variable, if there is one.
+  void erase(Key key);
+
+  /// @}
+};
+
+/// traits
+template <>
+struct traits<FlatVariableIndex> : public Testable<FlatVariableIndex> {};
+
+}  // namespace gtsam
+
+#include <gtsam/inference/FlatVariableIndex-inl.h>
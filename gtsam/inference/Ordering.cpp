@@ -19,6 +19,8 @@
 #include <vector>
 #include <limits>
 #include <cassert>
+#include <algorithm>
+#include <map>
 
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/3rdparty/CCOLAMD/Include/ccolamd.h>
@@ -255,6 +257,66 @@ Ordering Ordering::Metis(const MetisIndex& met) {
 #endif
 }
 
+/* ************************************************************************* */
+Ordering Ordering::MetisConstrained(const VariableIndex& variableIndex,
+    const FastMap<Key, int>& groups) {
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+  gttic(Ordering_METISConstrained);
+
+  // The variables of each group, and the variables of each factor
+  map<int, KeyVector> members;
+  vector<KeyVector> factorKeys;
+  for (const auto& [key, factors] : variableIndex) {
+    const auto group = groups.find(key);
+    members[group == groups.end() ? 0 : group->second].push_back(key);
+    for (const size_t factor : factors) {
+      if (factor >= factorKeys.size()) factorKeys.resize(factor + 1);
+      factorKeys[factor].push_back(key);
+    }
+  }
+
+  Ordering result;
+  result.reserve(variableIndex.size());
+  for (const auto& [group, keys] : members) {
+    idx_t size = keys.size();
+    if (size == 1) {
+      result.push_back(keys.front());
+      continue;
+    }
+
+    // Adjacency of the graph induced by the variables of this group
+    FastMap<Key, idx_t> indices;
+    for (idx_t i = 0; i < size; ++i) indices.emplace(keys[i], i);
+    vector<idx_t> xadj(1, 0), adj, neighbors;
+    for (const Key key : keys) {
+      neighbors.clear();
+      for (const size_t factor : variableIndex[key]) {
+        for (const Key other : factorKeys[factor]) {
+          const auto index = indices.find(other);
+          if (other != key && index != indices.end())
+            neighbors.push_back(index->second);
+        }
+      }
+      sort(neighbors.begin(), neighbors.end());
+      adj.insert(adj.end(), neighbors.begin(),
+                 unique(neighbors.begin(), neighbors.end()));
+      xadj.push_back(adj.size());
+    }
+
+    vector<idx_t> perm(size), iperm(size);
+    const int outputError = METIS_NodeND(&size, xadj.data(), adj.data(),
+        nullptr, nullptr, perm.data(), iperm.data());
+    if (outputError != METIS_OK)
+      throw runtime_error("METIS failed during nested dissection ordering");
+    for (const idx_t i : perm) result.push_back(keys[i]);
+  }
+  return result;
+#else
+  throw runtime_error("GTSAM was built without support for Metis-based "
+                      "nested dissection");
+#endif
+}
+
 /* ************************************************************************* */
 void Ordering::print(const std::string& str,
     const KeyFormatter& keyFormatter) const {
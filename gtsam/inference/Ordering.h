@@ -208,6 +208,26 @@ public:
       return Metis(MetisIndex(graph));
   }
 
+  /// Compute a nested dissection ordering using METIS from a VariableIndex, with groups as in
+  /// ColamdConstrained: the variables of each group appear in the ordering in group index
+  /// order, and variables not present in \c groups are assigned to group 0. The variables of
+  /// each group are ordered by nested dissection of the graph they induce. As the later groups
+  /// separate the earlier ones from the rest of the graph, eliminating them yields a balanced
+  /// tree below the later groups, where CCOLAMD tends to produce a deep and thin one.
+  static Ordering MetisConstrained(const VariableIndex& variableIndex,
+      const FastMap<Key, int>& groups);
+
+  /// Compute a constrained nested dissection ordering using METIS from a factor graph, see
+  /// MetisConstrained(const VariableIndex&, const FastMap<Key, int>&).
+  template<class FACTOR_GRAPH>
+  static Ordering MetisConstrained(const FACTOR_GRAPH& graph,
+      const FastMap<Key, int>& groups) {
+    if (graph.empty())
+      return Ordering();
+    else
+      return MetisConstrained(VariableIndex(graph), groups);
+  }
+
   /// @}
 
   /// @name Named Constructors
@@ -17,6 +17,7 @@
 
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/symbolic/SymbolicFactorGraph.h>
+#include <gtsam/symbolic/SymbolicBayesTree.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/inference/MetisIndex.h>
 #include <gtsam/base/TestableAssertions.h>
@@ -359,6 +360,47 @@ TEST(Ordering, MetisSingleNode) {
 }
 #endif
 /* ************************************************************************* */
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+TEST(Ordering, MetisConstrained) {
+  // A chain of 1000 variables, with the first and last variables in group 1,
+  // which do not share a factor, and a variable in the middle in group 2
+  SymbolicFactorGraph symbolicGraph;
+  for (Key j = 0; j + 1 < 1000; ++j) symbolicGraph.push_factor(j, j + 1);
+  FastMap<Key, int> groups;
+  groups[0] = 1;
+  groups[999] = 1;
+  groups[500] = 2;
+
+  const Ordering actual = Ordering::MetisConstrained(symbolicGraph, groups);
+  EXPECT_LONGS_EQUAL(1000, actual.size());
+  EXPECT(KeySet(actual.begin(), actual.end()).size() == 1000);
+  EXPECT_LONGS_EQUAL(500, actual[999]);
+  EXPECT((KeySet(actual.begin() + 997, actual.begin() + 999) ==
+          KeySet{0, 999}));
+
+  // Nested dissection splits the two halves of the chain recursively, so the
+  // Bayes tree is much shallower than with CCOLAMD
+  const auto height = [](const SymbolicBayesTree& bayesTree) {
+    size_t maxDepth = 0;
+    vector<pair<SymbolicBayesTree::sharedClique, size_t>> stack;
+    for (const auto& root : bayesTree.roots()) stack.emplace_back(root, 1);
+    while (!stack.empty()) {
+      const auto [clique, depth] = stack.back();
+      stack.pop_back();
+      maxDepth = max(maxDepth, depth);
+      for (const auto& child : clique->children)
+        stack.emplace_back(child, depth + 1);
+    }
+    return maxDepth;
+  };
+  const size_t metisHeight =
+      height(*symbolicGraph.eliminateMultifrontal(actual));
+  const size_t colamdHeight = height(*symbolicGraph.eliminateMultifrontal(
+      Ordering::ColamdConstrained(symbolicGraph, groups)));
+  EXPECT(metisHeight * 4 < colamdHeight);
+}
+#endif
+/* ************************************************************************* */
 TEST(Ordering, Create) {
 
   // create chain graph
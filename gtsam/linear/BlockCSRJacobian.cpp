@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BlockCSRJacobian.cpp
+ * @brief   Whitened Jacobian of a GaussianFactorGraph packed in block-CSR form
+ * @date    October 2026
+ */
+
+#include <gtsam/config.h>
+#include <gtsam/linear/BlockCSRJacobian.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/linear/JacobianFactor.h>
+
+#include <numeric>
+#include <stdexcept>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace gtsam {
+
+namespace {
+using ConstMatrixMap = Eigen::Map<const Matrix>;
+
+/// Call f(i) for i in [0, n), in parallel if TBB is available.
+template <class F>
+void ParallelFor(size_t n, const F& f) {
+#ifdef GTSAM_USE_TBB
+  // Block rows and variables are small, so process them in chunks
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n, 256),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      for (size_t i = range.begin(); i != range.end(); ++i)
+                        f(i);
+                    });
+#else
+  for (size_t i = 0; i < n; ++i) f(i);
+#endif
+}
+}  // namespace
+
+/* ************************************************************************* */
+BlockCSRJacobian::BlockCSRJacobian(const GaussianFactorGraph& gfg,
+                                   const KeyInfo& keyInfo) {
+  const size_t nrVariables = keyInfo.size();
+  columnOffsets_.resize(nrVariables + 1);
+  for (const KeyInfo::value_type& item : keyInfo)
+    columnOffsets_[item.second.index] = item.second.start;
+  columnOffsets_[nrVariables] = keyInfo.numCols();
+
+  std::vector<double> b;
+  std::vector<size_t> blockVariables;  // variable of each block
+  rowOffsets_.push_back(0);
+  rowBlocks_.push_back(0);
+  for (const GaussianFactor::shared_ptr& factor : gfg) {
+    if (!factor) continue;
+    auto jacobian = std::dynamic_pointer_cast<JacobianFactor>(factor);
+    if (!jacobian) {
+      const auto hessian = std::dynamic_pointer_cast<HessianFactor>(factor);
+      if (!hessian)
+        throw std::invalid_argument(
+            "BlockCSRJacobian: only JacobianFactors and HessianFactors are "
+            "supported");
+      jacobian = std::make_shared<JacobianFactor>(*hessian);
+    }
+    if (jacobian->rows() == 0) continue;
+
+    // Copy the whitened blocks, which are contiguous in the column-major Ab
+    const Matrix Ab = jacobian->augmentedJacobian();
+    const size_t m = Ab.rows();
+    DenseIndex column = 0;
+    for (auto it = jacobian->begin(); it != jacobian->end(); ++it) {
+      const KeyInfoEntry& info = keyInfo.at(*it);
+      const size_t d = jacobian->getDim(it);
+      blocks_.push_back({values_.size(), info.start, d});
+      blockVariables.push_back(info.index);
+      const double* data = Ab.col(column).data();
+      values_.insert(values_.end(), data, data + m * d);
+      column += d;
+    }
+    const double* data = Ab.col(column).data();
+    b.insert(b.end(), data, data + m);
+    rowOffsets_.push_back(rowOffsets_.back() + m);
+    rowBlocks_.push_back(blocks_.size());
+  }
+  b_ = Eigen::Map<const Vector>(b.data(), b.size());
+
+  // Transposed index: sort the blocks by variable, keeping block row order
+  columnEntries_.assign(nrVariables + 1, 0);
+  for (size_t variable : blockVariables) ++columnEntries_[variable + 1];
+  std::partial_sum(columnEntries_.begin(), columnEntries_.end(),
+                   columnEntries_.begin());
+  std::vector<size_t> next(columnEntries_.begin(), columnEntries_.end() - 1);
+  entries_.resize(blocks_.size());
+  for (size_t r = 0; r < nrBlockRows(); ++r)
+    for (size_t k = rowBlocks_[r]; k < rowBlocks_[r + 1]; ++k)
+      entries_[next[blockVariables[k]]++] = {k, r};
+}
+
+/* ************************************************************************* */
+void BlockCSRJacobian::multiply(const Vector& x, Vector& Ax) const {
+  Ax.resize(rows());
+  ParallelFor(nrBlockRows(), [&](size_t r) {
+    const size_t row = rowOffsets_[r], m = rowOffsets_[r + 1] - row;
+    auto y = Ax.segment(row, m);
+    y.setZero();
+    for (size_t k = rowBlocks_[r]; k < rowBlocks_[r + 1]; ++k) {
+      const Block& block = blocks_[k];
+      y.noalias() +=
+          ConstMatrixMap(values_.data() + block.value, m, block.cols) *
+          x.segment(block.column, block.cols);
+    }
+  });
+}
+
+/* ************************************************************************* */
+void BlockCSRJacobian::transposeMultiply(const Vector& e, Vector& Ate) const {
+  Ate.resize(cols());
+  ParallelFor(columnOffsets_.size() - 1, [&](size_t j) {
+    const size_t column = columnOffsets_[j],
+                 d = columnOffsets_[j + 1] - column;
+    auto y = Ate.segment(column, d);
+    y.setZero();
+    for (size_t k = columnEntries_[j]; k < columnEntries_[j + 1]; ++k) {
+      const Entry& entry = entries_[k];
+      const size_t row = rowOffsets_[entry.blockRow],
+                   m = rowOffsets_[entry.blockRow + 1] - row;
+      y.noalias() += ConstMatrixMap(values_.data() + blocks_[entry.block].value,
+                                    m, d).transpose() *
+                     e.segment(row, m);
+    }
+  });
+}
+
+/* ************************************************************************* */
+void BlockCSRJacobian::multiplyHessian(const Vector& x, Vector& AtAx) const {
+  Vector Ax(rows());
+  multiply(x, Ax);
+  transposeMultiply(Ax, AtAx);
+}
+
+}  // namespace gtsam
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BlockCSRJacobian.h
+ * @brief   Whitened Jacobian of a GaussianFactorGraph packed in block-CSR form,
+ *          for fast and parallel matrix-vector products in iterative solvers
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/Vector.h>
+#include <gtsam/dllexport.h>
+
+#include <vector>
+
+namespace gtsam {
+
+class GaussianFactorGraph;
+class KeyInfo;
+
+/**
+ * The whitened Jacobian [A b] of a GaussianFactorGraph, packed once into one
+ * contiguous array of blocks: every factor is a block row, with one dense
+ * block per key. Vectors are laid out as in KeyInfo, so products are computed
+ * directly on them, without building VectorValues.
+ *
+ * The product A*x is parallel over block rows, and A'*e is parallel over
+ * variables using a transposed index of the blocks, so that neither needs
+ * atomic or per-thread accumulation. Both use TBB if GTSAM is built with it.
+ *
+ * JacobianFactors are packed as they are, HessianFactors are first converted
+ * to a JacobianFactor, and other factor types are not supported.
+ */
+class GTSAM_EXPORT BlockCSRJacobian {
+ public:
+  /// Pack the factors of gfg, with columns as given by keyInfo.
+  BlockCSRJacobian(const GaussianFactorGraph& gfg, const KeyInfo& keyInfo);
+
+  /// Number of scalar rows of A.
+  size_t rows() const { return rowOffsets_.back(); }
+
+  /// Number of scalar columns of A.
+  size_t cols() const { return columnOffsets_.back(); }
+
+  /// Number of block rows, i.e., non-empty factors.
+  size_t nrBlockRows() const { return rowOffsets_.size() - 1; }
+
+  /// Number of non-zero blocks.
+  size_t nrBlocks() const { return blocks_.size(); }
+
+  /// Whitened right-hand side b.
+  const Vector& b() const { return b_; }
+
+  /// Ax = A * x
+  void multiply(const Vector& x, Vector& Ax) const;
+
+  /// Ate = A' * e
+  void transposeMultiply(const Vector& e, Vector& Ate) const;
+
+  /// AtAx = A' * A * x, with A * x in a temporary, so it is safe to call
+  /// concurrently.
+  void multiplyHessian(const Vector& x, Vector& AtAx) const;
+
+ private:
+  /// A block of a block row, stored column-major in values_.
+  struct Block {
+    size_t value;    ///< offset of the block in values_
+    size_t column;   ///< first column of the variable
+    size_t cols;     ///< dimension of the variable
+  };
+
+  /// A block, in the transposed index of a variable.
+  struct Entry {
+    size_t block;     ///< index in blocks_
+    size_t blockRow;  ///< block row of the block
+  };
+
+  std::vector<double> values_;
+  std::vector<Block> blocks_;
+  std::vector<size_t> rowOffsets_;    ///< first row of each block row
+  std::vector<size_t> rowBlocks_;     ///< first block of each block row
+  std::vector<Entry> entries_;        ///< blocks ordered by variable
+  std::vector<size_t> columnEntries_; ///< first entry of each variable
+  std::vector<size_t> columnOffsets_; ///< first column of each variable
+  Vector b_;
+};
+
+}  // namespace gtsam
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BlockSparseHessian.cpp
+ * @brief   Symmetric block-sparse matrix, used by the incomplete Cholesky and
+ *          multigrid preconditioners
+ * @date    October 2026
+ */
+
+#include <gtsam/linear/BlockSparseHessian.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/IterativeSolver.h>
+
+#include <stdexcept>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+BlockSparseHessian::BlockSparseHessian(const std::vector<size_t>& dims,
+                                       const Rows& rows)
+    : dims_(dims) {
+  if (rows.size() != dims.size())
+    throw std::invalid_argument(
+        "BlockSparseHessian: number of rows and dimensions differ");
+  const size_t n = dims.size();
+  offsets_.resize(n + 1);
+  offsets_[0] = 0;
+  for (size_t i = 0; i < n; ++i) offsets_[i + 1] = offsets_[i] + dims[i];
+
+  rowBlocks_.reserve(n + 1);
+  rowBlocks_.push_back(0);
+  diagonal_.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    if (!rows[i].count(i))
+      throw std::invalid_argument(
+          "BlockSparseHessian: missing diagonal block");
+    for (const auto& [j, block] : rows[i]) {
+      if (static_cast<size_t>(block.rows()) != dims[i] ||
+          static_cast<size_t>(block.cols()) != dims[j])
+        throw std::invalid_argument(
+            "BlockSparseHessian: block dimensions do not match");
+      if (j == i) diagonal_[i] = columns_.size();
+      columns_.push_back(j);
+      valueOffsets_.push_back(values_.size());
+      values_.insert(values_.end(), block.data(), block.data() + block.size());
+    }
+    rowBlocks_.push_back(columns_.size());
+  }
+}
+
+/* ************************************************************************* */
+static BlockSparseHessian::Rows Assemble(const GaussianFactorGraph& gfg,
+                                         const KeyInfo& keyInfo,
+                                         std::vector<size_t>& dims) {
+  dims = keyInfo.colSpec();
+  BlockSparseHessian::Rows rows(dims.size());
+  for (size_t i = 0; i < dims.size(); ++i)
+    rows[i].emplace(i, Matrix::Zero(dims[i], dims[i]));
+
+  std::vector<size_t> indices, offsets;
+  for (const GaussianFactor::shared_ptr& factor : gfg) {
+    if (!factor) continue;
+    const Matrix information = factor->augmentedInformation();
+    indices.clear();
+    offsets.clear();
+    size_t offset = 0;
+    for (auto it = factor->begin(); it != factor->end(); ++it) {
+      indices.push_back(keyInfo.at(*it).index);
+      offsets.push_back(offset);
+      offset += factor->getDim(it);
+    }
+    for (size_t a = 0; a < indices.size(); ++a) {
+      const size_t i = indices[a];
+      for (size_t b = 0; b < indices.size(); ++b) {
+        const size_t j = indices[b];
+        const auto block =
+            information.block(offsets[a], offsets[b], dims[i], dims[j]);
+        auto [it, inserted] = rows[i].try_emplace(j, block);
+        if (!inserted) it->second += block;
+      }
+    }
+  }
+  return rows;
+}
+
+/* ************************************************************************* */
+BlockSparseHessian::BlockSparseHessian(const GaussianFactorGraph& gfg,
+                                       const KeyInfo& keyInfo) {
+  std::vector<size_t> dims;
+  const Rows rows = Assemble(gfg, keyInfo, dims);
+  *this = BlockSparseHessian(dims, rows);
+}
+
+/* ************************************************************************* */
+void BlockSparseHessian::multiply(const Vector& x, Vector& y) const {
+  y.resize(cols());
+  for (size_t i = 0; i < size(); ++i) {
+    auto yi = y.segment(offsets_[i], dims_[i]);
+    yi.setZero();
+    for (size_t k = rowBegin(i); k < rowEnd(i); ++k) {
+      const size_t j = columns_[k];
+      yi.noalias() += block(i, k) * x.segment(offsets_[j], dims_[j]);
+    }
+  }
+}
+
+/* ************************************************************************* */
+void BlockSparseHessian::addDiagonal(const Vector& d) {
+  if (static_cast<size_t>(d.size()) != cols())
+    throw std::invalid_argument(
+        "BlockSparseHessian::addDiagonal: wrong dimension");
+  for (size_t i = 0; i < size(); ++i) {
+    Eigen::Map<Matrix> D(values_.data() + valueOffsets_[diagonal_[i]],
+                         dims_[i], dims_[i]);
+    D.diagonal() += d.segment(offsets_[i], dims_[i]);
+  }
+}
+
+/* ************************************************************************* */
+BlockSparseHessian::Rows BlockSparseHessian::rows() const {
+  Rows result(size());
+  for (size_t i = 0; i < size(); ++i)
+    for (size_t k = rowBegin(i); k < rowEnd(i); ++k)
+      result[i].emplace_hint(result[i].end(), columns_[k], block(i, k));
+  return result;
+}
+
+/* ************************************************************************* */
+Matrix BlockSparseHessian::dense() const {
+  Matrix result = Matrix::Zero(cols(), cols());
+  for (size_t i = 0; i < size(); ++i)
+    for (size_t k = rowBegin(i); k < rowEnd(i); ++k) {
+      const size_t j = columns_[k];
+      result.block(offsets_[i], offsets_[j], dims_[i], dims_[j]) = block(i, k);
+    }
+  return result;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    BlockSparseHessian.h
+ * @brief   Symmetric block-sparse matrix, used by the incomplete Cholesky and
+ *          multigrid preconditioners
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/Matrix.h>
+#include <gtsam/dllexport.h>
+
+#include <map>
+#include <vector>
+
+namespace gtsam {
+
+class GaussianFactorGraph;
+class KeyInfo;
+
+/**
+ * Symmetric block-sparse matrix, e.g., the Hessian A'A of a GaussianFactorGraph,
+ * with one block row per variable. Both triangles are stored: the blocks of
+ * each block row are sorted by block column, and stored column-major in one
+ * contiguous array.
+ */
+class GTSAM_EXPORT BlockSparseHessian {
+ public:
+  /// Blocks of each block row by block column, to build or modify a matrix.
+  using Rows = std::vector<std::map<size_t, Matrix>>;
+
+  BlockSparseHessian() : offsets_(1, 0), rowBlocks_(1, 0) {}
+
+  /// Construct from blocks, which have to be symmetric and have diagonals.
+  BlockSparseHessian(const std::vector<size_t>& dims, const Rows& rows);
+
+  /// The Hessian A'A of gfg, without b, with block rows as in keyInfo.
+  BlockSparseHessian(const GaussianFactorGraph& gfg, const KeyInfo& keyInfo);
+
+  /// Number of block rows.
+  size_t size() const { return dims_.size(); }
+
+  /// Number of scalar rows and columns.
+  size_t cols() const { return offsets_.back(); }
+
+  /// Dimensions of the block rows.
+  const std::vector<size_t>& dims() const { return dims_; }
+
+  /// Dimension of block row i.
+  size_t dim(size_t i) const { return dims_[i]; }
+
+  /// First scalar row of block row i.
+  size_t offset(size_t i) const { return offsets_[i]; }
+
+  /// Number of non-zero blocks.
+  size_t nrBlocks() const { return columns_.size(); }
+
+  /// First block of block row i, the blocks are [rowBegin(i), rowEnd(i)).
+  size_t rowBegin(size_t i) const { return rowBlocks_[i]; }
+
+  /// One past the last block of block row i.
+  size_t rowEnd(size_t i) const { return rowBlocks_[i + 1]; }
+
+  /// Block column of block k.
+  size_t column(size_t k) const { return columns_[k]; }
+
+  /// Index of the diagonal block of block row i.
+  size_t diagonal(size_t i) const { return diagonal_[i]; }
+
+  /// Block k, which has to be in block row i.
+  Eigen::Map<const Matrix> block(size_t i, size_t k) const {
+    return Eigen::Map<const Matrix>(values_.data() + valueOffsets_[k],
+                                    dims_[i], dims_[columns_[k]]);
+  }
+
+  /// y = A * x
+  void multiply(const Vector& x, Vector& y) const;
+
+  /// A += diag(d), with d of size cols(), e.g., to add a damping.
+  void addDiagonal(const Vector& d);
+
+  /// Blocks of each block row, to modify the matrix.
+  Rows rows() const;
+
+  /// Dense matrix, for small matrices and testing.
+  Matrix dense() const;
+
+ private:
+  std::vector<size_t> dims_;
+  std::vector<size_t> offsets_;         ///< first scalar row of block rows
+  std::vector<size_t> rowBlocks_;       ///< first block of block rows
+  std::vector<size_t> columns_;         ///< block column of blocks
+  std::vector<size_t> valueOffsets_;  ///< offset of blocks in values_
+  std::vector<size_t> diagonal_;        ///< diagonal block of block rows
+  std::vector<double> values_;
+};
+
+}  // namespace gtsam
@@ -32,7 +32,8 @@ void ConjugateGradientParameters::print(ostream &os) const {
        << "maxIter:       " << maxIterations << endl
        << "resetIter:     " << reset << endl
        << "eps_rel:       " << epsilon_rel << endl
-       << "eps_abs:       " << epsilon_abs << endl;
+       << "eps_abs:       " << epsilon_abs << endl
+       << "blasKernel:    " << blasTranslator(blas_kernel) << endl;
 }
 
 /*****************************************************************************/
@@ -40,6 +41,7 @@ std::string ConjugateGradientParameters::blasTranslator(const BLASKernel value)
   std::string s;
   switch (value) {
   case ConjugateGradientParameters::GTSAM:      s = "GTSAM" ;      break;
+  case ConjugateGradientParameters::BLOCK_CSR:  s = "BLOCK_CSR" ;  break;
   default:                                      s = "UNDEFINED" ;  break;
   }
   return s;
@@ -52,6 +54,7 @@ ConjugateGradientParameters::BLASKernel ConjugateGradientParameters::blasTransla
   // Convert to upper case
   std::transform(s.begin(), s.end(), s.begin(), ::toupper);
   if (s == "GTSAM")  return ConjugateGradientParameters::GTSAM;
+  if (s == "BLOCK_CSR")  return ConjugateGradientParameters::BLOCK_CSR;
 
   /* default is SBM */
   return ConjugateGradientParameters::GTSAM;
@@ -39,7 +39,8 @@ struct GTSAM_EXPORT ConjugateGradientParameters
 
   /* Matrix Operation Kernel */
   enum BLASKernel {
-    GTSAM = 0,  ///< Jacobian Factor Graph of GTSAM
+    GTSAM = 0,      ///< Jacobian Factor Graph of GTSAM
+    BLOCK_CSR = 1,  ///< Jacobian packed in block-CSR form, multi-threaded
   } blas_kernel;
 
   ConjugateGradientParameters()
@@ -67,7 +68,7 @@ struct GTSAM_EXPORT ConjugateGradientParameters
         reset(p.reset),
         epsilon_rel(p.epsilon_rel),
         epsilon_abs(p.epsilon_abs),
-        blas_kernel(GTSAM) {}
+        blas_kernel(p.blas_kernel) {}
 
   ConjugateGradientParameters& operator=(const ConjugateGradientParameters& other) = default;
 
@@ -100,6 +101,7 @@ struct GTSAM_EXPORT ConjugateGradientParameters
  * System class should support residual(v, g), multiply(v,Av), scal(alpha,v), dot(v,v), axpy(alpha,x,y)
  * leftPrecondition(v, L^{-1}v, rightPrecondition(v, L^{-T}v) where preconditioner M = L*L^T
  * Note that the residual is in the preconditioned domain. Refer to Section 9.2 of Saad's book.
+ * If iterations is given, the number of iterations is stored there.
  *
  ** REFERENCES:
  * [1] Y. Saad, "Preconditioned Iterations," in Iterative Methods for Sparse Linear Systems,
@@ -107,7 +109,8 @@ struct GTSAM_EXPORT ConjugateGradientParameters
  */
 template<class S, class V>
 V preconditionedConjugateGradient(const S &system, const V &initial,
-    const ConjugateGradientParameters &parameters) {
+    const ConjugateGradientParameters &parameters,
+    size_t *iterations = nullptr) {
 
   V estimate, residual, direction, q1, q2;
   estimate = residual = direction = q1 = q2 = initial;
@@ -166,6 +169,80 @@ V preconditionedConjugateGradient(const S &system, const V &initial,
      std::cout << "[PCG] iterations = " << k
                << ", ||r||^2 = " << currentGamma
                << std::endl;
+  if (iterations) *iterations = k - 1;
+
+  return estimate;
+}
+
+/*
+ * A template for the linear preconditioned conjugate gradient method with a
+ * preconditioner M that is not split, e.g., a multigrid cycle.
+ * System class should support residual(v, g), multiply(v,Av), scal(alpha,v), dot(v,v), axpy(alpha,x,y)
+ * and precondition(v, M^{-1}v). The residual is in the original domain, and
+ * gamma = r' M^{-1} r, so that the thresholds match the split version.
+ * If iterations is given, the number of iterations is stored there.
+ * Refer to Algorithm 9.1 of Saad's book.
+ */
+template<class S, class V>
+V unsplitPreconditionedConjugateGradient(const S &system, const V &initial,
+    const ConjugateGradientParameters &parameters,
+    size_t *iterations = nullptr) {
+
+  V estimate, residual, direction, z, q;
+  estimate = residual = direction = z = q = initial;
+
+  system.residual(estimate, residual);          /* r = b-Ax */
+  system.precondition(residual, z);             /* z = M^{-1} r */
+  direction = z;                                /* p = z */
+
+  double currentGamma = system.dot(residual, z), prevGamma, alpha, beta;
+
+  const size_t iMaxIterations = parameters.maxIterations,
+               iMinIterations = parameters.minIterations,
+               iReset = parameters.reset;
+  const double threshold =
+      std::max(parameters.epsilon_abs,
+               parameters.epsilon_rel * parameters.epsilon_rel * currentGamma);
+
+  if (parameters.verbosity() >= ConjugateGradientParameters::COMPLEXITY)
+    std::cout << "[PCG] epsilon = " << parameters.epsilon_rel
+              << ", max = " << parameters.maxIterations
+              << ", reset = " << parameters.reset
+              << ", r0'M^{-1}r0 = " << currentGamma
+              << ", threshold = " << threshold << std::endl;
+
+  size_t k;
+  for ( k = 1 ; k <= iMaxIterations && (currentGamma > threshold || k <= iMinIterations) ; k++ ) {
+
+    if ( k % iReset == 0 ) {
+      system.residual(estimate, residual);                /* r = b-Ax */
+      system.precondition(residual, z);                   /* z = M^{-1} r */
+      direction = z;                                      /* p = z */
+      currentGamma = system.dot(residual, z);
+    }
+    system.multiply(direction, q);                        /* q = A p */
+    alpha = currentGamma / system.dot(direction, q);      /* alpha = gamma / (p' A p) */
+    system.axpy(alpha, direction, estimate);              /* estimate += alpha * p */
+    system.axpy(-alpha, q, residual);                     /* r -= alpha * q */
+    system.precondition(residual, z);                     /* z = M^{-1} r */
+    prevGamma = currentGamma;
+    currentGamma = system.dot(residual, z);               /* gamma = r' z */
+    beta = currentGamma / prevGamma;
+    system.scal(beta, direction);
+    system.axpy(1.0, z, direction);                       /* p = z + beta * p */
+
+    if (parameters.verbosity() >= ConjugateGradientParameters::ERROR )
+       std::cout << "[PCG] k = " << k
+                 << ", alpha = " << alpha
+                 << ", beta = " << beta
+                 << ", r'M^{-1}r = " << currentGamma
+                 << std::endl;
+  }
+  if (parameters.verbosity() >= ConjugateGradientParameters::COMPLEXITY )
+     std::cout << "[PCG] iterations = " << k
+               << ", r'M^{-1}r = " << currentGamma
+               << std::endl;
+  if (iterations) *iterations = k - 1;
 
   return estimate;
 }
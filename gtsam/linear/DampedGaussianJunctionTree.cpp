@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    DampedGaussianJunctionTree.cpp
+ * @brief   Junction tree that caches the Hessian of each clique, to be
+ *          eliminated repeatedly with different diagonal damping
+ * @date    October 2026
+ */
+
+#include <gtsam/linear/DampedGaussianJunctionTree.h>
+#include <gtsam/linear/GaussianConditional.h>
+#include <gtsam/linear/GaussianEliminationTree.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/Scatter.h>
+#include <gtsam/inference/Ordering.h>
+
+#include <stack>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+DampedGaussianJunctionTree::DampedGaussianJunctionTree(
+    const GaussianFactorGraph& graph, const Ordering& ordering)
+    : Base(GaussianEliminationTree(graph, ordering)) {
+  gttic(DampedGaussianJunctionTree_cacheHessians);
+  std::stack<sharedNode> stack;
+  for (const sharedNode& root : roots_) stack.push(root);
+  while (!stack.empty()) {
+    const sharedNode cluster = stack.top();
+    stack.pop();
+    for (const sharedNode& child : cluster->children) stack.push(child);
+    if (cluster->factors.empty()) continue;
+    const Scatter scatter(cluster->factors);
+    auto hessian = std::make_shared<HessianFactor>(cluster->factors, scatter);
+    cluster->factors = GaussianFactorGraph();
+    cluster->factors.push_back(hessian);
+  }
+}
+
+/* ************************************************************************* */
+std::shared_ptr<GaussianBayesTree> DampedGaussianJunctionTree::eliminate(
+    const std::map<Key, Vector>& lambda) const {
+  gttic(DampedGaussianJunctionTree_eliminate);
+  // As EliminateCholesky, with lambda added to the frontal diagonal blocks of
+  // the joint factor. The frontal keys come first in the scatter.
+  const Eliminate function = [&lambda](const GaussianFactorGraph& factors,
+                                       const Ordering& keys) {
+    const Scatter scatter(factors, keys);
+    auto jointFactor = std::make_shared<HessianFactor>(factors, scatter);
+    SymmetricBlockMatrix& info = jointFactor->info();
+    for (size_t j = 0; j < keys.size(); ++j) {
+      const auto it = lambda.find(keys[j]);
+      if (it != lambda.end())
+        info.diagonalBlock(j).nestedExpression().diagonal() += it->second;
+    }
+    auto conditional = jointFactor->eliminateCholesky(keys);
+    return std::make_pair(
+        conditional, std::static_pointer_cast<GaussianFactor>(jointFactor));
+  };
+  return Base::eliminate(function).first;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    DampedGaussianJunctionTree.h
+ * @brief   Junction tree that caches the Hessian of each clique, to be
+ *          eliminated repeatedly with different diagonal damping
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianJunctionTree.h>
+
+#include <map>
+
+namespace gtsam {
+
+/**
+ * A GaussianJunctionTree in which the factors of each cluster are combined
+ * into a single HessianFactor when it is built. It can then be eliminated
+ * with Cholesky for several damped systems H + diag(lambda), as in the lambda
+ * trials of Levenberg-Marquardt: lambda is added to the diagonal of the
+ * frontal blocks of each joint factor, instead of adding prior factors to the
+ * graph and re-linearizing them into Hessians for every trial.
+ *
+ * The graph must not have constrained noise models, which Cholesky cannot
+ * eliminate.
+ *
+ * \ingroup Multifrontal
+ */
+class GTSAM_EXPORT DampedGaussianJunctionTree : public GaussianJunctionTree {
+ public:
+  typedef GaussianJunctionTree Base;  ///< Base class
+  typedef DampedGaussianJunctionTree This;  ///< This class
+  typedef std::shared_ptr<This> shared_ptr;  ///< Shared pointer to this class
+
+  /**
+   * Build the junction tree of a graph for the given ordering, and cache the
+   * undamped Hessian of the factors of each cluster.
+   */
+  DampedGaussianJunctionTree(const GaussianFactorGraph& graph,
+                             const Ordering& ordering);
+
+  using Base::eliminate;
+
+  /**
+   * Eliminate H + diag(lambda) with Cholesky, with H the Hessian of the graph.
+   * Variables missing from lambda are not damped.
+   * @throw IndeterminantLinearSystemException if the damped system is not
+   * positive definite
+   */
+  std::shared_ptr<GaussianBayesTree> eliminate(
+      const std::map<Key, Vector>& lambda) const;
+};
+
+}  // namespace gtsam
@@ -0,0 +1,302 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file FixedKalmanFilter.h
+ * @brief Linear Kalman filter for a state of fixed dimension, with the same
+ * factor semantics as KalmanFilter but working on fixed-size matrices.
+ * @date October 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/Matrix.h>
+#include <gtsam/linear/KalmanFilter.h>
+
+#include <Eigen/Cholesky>
+#include <Eigen/QR>
+
+#include <iostream>
+
+namespace gtsam {
+
+/**
+ * Kalman filter for a state of dimension N, known at compile time.
+ *
+ * As KalmanFilter, the filter is functional and motion and measurement models
+ * are the factors |A0*x_k + A1*x_{k+1} - b|^2 and |H*x_k - z|^2, but the
+ * elimination of x_k is done directly on fixed-size matrices rather than by
+ * building and eliminating a GaussianFactorGraph, so that no memory is
+ * allocated. Both factorizations of KalmanFilter are supported:
+ * - QR: the state is the square-root information form (R, d), with R upper
+ *   triangular and density exp(-0.5*|R*x - d|^2). Predict and update are a
+ *   Householder QR of the stacked prior and new factor.
+ * - CHOLESKY: the state is the information form (Lambda, eta), with density
+ *   exp(-0.5*x'*Lambda*x + eta'*x). Updates are additions, and predict is the
+ *   Schur complement of x_k.
+ */
+template <int N>
+class FixedKalmanFilter {
+  static_assert(N > 0, "FixedKalmanFilter: N needs to be a fixed dimension");
+
+ public:
+  using Factorization = KalmanFilter::Factorization;
+  using VectorN = Eigen::Matrix<double, N, 1>;
+  using MatrixN = Eigen::Matrix<double, N, N>;
+
+  /**
+   * The filter state: (R, d) for QR, or (Lambda, eta) for CHOLESKY, and the
+   * step index k, which starts at 0 and is incremented at each predict.
+   */
+  struct State {
+    MatrixN matrix;
+    VectorN vector;
+    size_t step = 0;
+
+    GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+  };
+
+ private:
+  Factorization method_;
+
+ public:
+  /**
+   * Constructor.
+   * @param method Factorization method (default: QR unless compile-flag set).
+   */
+  explicit FixedKalmanFilter(
+      Factorization method = KalmanFilter::KALMANFILTER_DEFAULT_FACTORIZATION)
+      : method_(method) {}
+
+  /// Factorization method used.
+  Factorization method() const { return method_; }
+
+  /// Dimension of the state.
+  static constexpr int dim() { return N; }
+
+  /// Return the step index k.
+  static size_t step(const State& p) { return p.step; }
+
+  /**
+   * Create the initial state from a Gaussian prior with diagonal covariance.
+   * @param x0 Initial state estimate.
+   * @param sigmas Standard deviations of x0.
+   */
+  State init(const VectorN& x0, const VectorN& sigmas) const {
+    const VectorN precisions = sigmas.cwiseInverse();
+    return fromSquareRoot(MatrixN(precisions.asDiagonal()),
+                          precisions.cwiseProduct(x0), 0);
+  }
+
+  /**
+   * Create the initial state with a full covariance matrix.
+   * @param x0 Initial state estimate.
+   * @param P0 Full covariance matrix.
+   */
+  State init(const VectorN& x0, const MatrixN& P0) const {
+    const MatrixN information = P0.llt().solve(MatrixN::Identity());
+    const MatrixN R = information.llt().matrixU();
+    return fromSquareRoot(R, R * x0, 0);
+  }
+
+  /**
+   * Predict the next state with motion model x_{k+1} = F*x_k + B*u + w, where
+   * w is zero-mean Gaussian noise with diagonal covariance.
+   * @param p Previous state.
+   * @param F State transition matrix.
+   * @param B Control input matrix.
+   * @param u Control vector.
+   * @param sigmasQ Standard deviations of w.
+   */
+  template <int M>
+  State predict(const State& p, const MatrixN& F,
+                const Eigen::Matrix<double, N, M>& B,
+                const Eigen::Matrix<double, M, 1>& u,
+                const VectorN& sigmasQ) const {
+    const VectorN precisions = sigmasQ.cwiseInverse();
+    return predict2(p, -(precisions.asDiagonal() * F),
+                    MatrixN(precisions.asDiagonal()),
+                    precisions.cwiseProduct(B * u));
+  }
+
+  /**
+   * Predict the next state with a full covariance matrix Q for w.
+   * @param p Previous state.
+   * @param F State transition matrix.
+   * @param B Control input matrix.
+   * @param u Control vector.
+   * @param Q Full covariance matrix.
+   */
+  template <int M>
+  State predictQ(const State& p, const MatrixN& F,
+                 const Eigen::Matrix<double, N, M>& B,
+                 const Eigen::Matrix<double, M, 1>& u, const MatrixN& Q) const {
+    // Premultiply -F, I, and B * u with L^{-1}, where Q = L*L'
+    const Eigen::LLT<MatrixN> llt(Q);
+    const MatrixN Linv = llt.matrixL().solve(MatrixN::Identity());
+    return predict2(p, -(Linv * F), Linv, Linv * (B * u));
+  }
+
+  /**
+   * Predict the next state with a whitened motion model, given as the factor
+   * |A0*x_k + A1*x_{k+1} - b|^2.
+   */
+  State predict2(const State& p, const MatrixN& A0, const MatrixN& A1,
+                 const VectorN& b) const {
+    if (method_ == KalmanFilter::QR) {
+      // Eliminate x_k from [R 0 d; A0 A1 b], the bottom right block is the
+      // square root information form on x_{k+1}.
+      Eigen::Matrix<double, 2 * N, 2 * N + 1> Ab;
+      Ab << p.matrix, MatrixN::Zero(), p.vector, A0, A1, b;
+      const Eigen::HouseholderQR<Eigen::Matrix<double, 2 * N, 2 * N + 1>> qr(
+          Ab);
+      return fromSquareRoot(
+          qr.matrixQR().template block<N, N>(N, N),
+          qr.matrixQR().template block<N, 1>(N, 2 * N), p.step + 1);
+    } else {
+      // Schur complement of x_k in the joint information form on x_k, x_{k+1}
+      const MatrixN L00 = p.matrix + A0.transpose() * A0;
+      const MatrixN L01 = A0.transpose() * A1;
+      const VectorN eta0 = p.vector + A0.transpose() * b;
+      const Eigen::LLT<MatrixN> llt(L00);
+      State result;
+      result.matrix = A1.transpose() * A1 - L01.transpose() * llt.solve(L01);
+      result.vector = A1.transpose() * b - L01.transpose() * llt.solve(eta0);
+      result.step = p.step + 1;
+      return result;
+    }
+  }
+
+  /**
+   * Update with a measurement z = H*x_k + v, where v is zero-mean Gaussian
+   * noise with diagonal covariance.
+   * @param p Previous state.
+   * @param H Observation matrix.
+   * @param z Measurement vector.
+   * @param sigmas Standard deviations of v.
+   */
+  template <int M>
+  State update(const State& p, const Eigen::Matrix<double, M, N>& H,
+               const Eigen::Matrix<double, M, 1>& z,
+               const Eigen::Matrix<double, M, 1>& sigmas) const {
+    const Eigen::Matrix<double, M, 1> precisions = sigmas.cwiseInverse();
+    const Eigen::Matrix<double, M, N> A = precisions.asDiagonal() * H;
+    return update2(p, A, precisions.cwiseProduct(z));
+  }
+
+  /**
+   * Update with a measurement using a full covariance matrix R for v.
+   * @param p Previous state.
+   * @param H Observation matrix.
+   * @param z Measurement vector.
+   * @param R Full covariance matrix.
+   */
+  template <int M>
+  State updateQ(const State& p, const Eigen::Matrix<double, M, N>& H,
+                const Eigen::Matrix<double, M, 1>& z,
+                const Eigen::Matrix<double, M, M>& R) const {
+    // Premultiply H and z with L^{-1}, where R = L*L'
+    const Eigen::LLT<Eigen::Matrix<double, M, M>> llt(R);
+    const Eigen::Matrix<double, M, N> A = llt.matrixL().solve(H);
+    const Eigen::Matrix<double, M, 1> b = llt.matrixL().solve(z);
+    return update2(p, A, b);
+  }
+
+  /**
+   * Update with a whitened measurement factor |A*x_k - b|^2. A and b can be of
+   * fixed or dynamic size, memory is only allocated for the latter.
+   */
+  template <class DA, class DB>
+  State update2(const State& p, const Eigen::MatrixBase<DA>& A,
+                const Eigen::MatrixBase<DB>& b) const {
+    if (method_ == KalmanFilter::QR) {
+      // Re-triangularize [R d; A b]
+      constexpr int Rows = DA::RowsAtCompileTime == Eigen::Dynamic
+                               ? Eigen::Dynamic
+                               : N + DA::RowsAtCompileTime;
+      using Stacked = Eigen::Matrix<double, Rows, N + 1>;
+      Stacked Ab(N + A.rows(), N + 1);
+      Ab << p.matrix, p.vector, A, b;
+      const Eigen::HouseholderQR<Stacked> qr(Ab);
+      return fromSquareRoot(qr.matrixQR().template block<N, N>(0, 0),
+                            qr.matrixQR().template block<N, 1>(0, N), p.step);
+    } else {
+      State result;
+      result.matrix.noalias() = p.matrix + A.transpose() * A;
+      result.vector.noalias() = p.vector + A.transpose() * b;
+      result.step = p.step;
+      return result;
+    }
+  }
+
+  /// Shift the density by -delta, i.e., make it a density on x - delta.
+  State recenter(const State& p, const VectorN& delta) const {
+    State result = p;
+    if (method_ == KalmanFilter::QR)
+      result.vector -= p.matrix.template triangularView<Eigen::Upper>() * delta;
+    else
+      result.vector -= p.matrix * delta;
+    return result;
+  }
+
+  /// Mean of the state.
+  VectorN mean(const State& p) const {
+    if (method_ == KalmanFilter::QR)
+      return p.matrix.template triangularView<Eigen::Upper>().solve(p.vector);
+    return p.matrix.llt().solve(p.vector);
+  }
+
+  /// Information matrix of the state.
+  MatrixN information(const State& p) const {
+    if (method_ == KalmanFilter::QR) {
+      const MatrixN R = p.matrix.template triangularView<Eigen::Upper>();
+      return R.transpose() * R;
+    }
+    return p.matrix;
+  }
+
+  /// Covariance matrix of the state.
+  MatrixN covariance(const State& p) const {
+    if (method_ == KalmanFilter::QR) {
+      const MatrixN Rinv =
+          p.matrix.template triangularView<Eigen::Upper>().solve(
+              MatrixN::Identity());
+      return Rinv * Rinv.transpose();
+    }
+    return p.matrix.llt().solve(MatrixN::Identity());
+  }
+
+  /// print
+  void print(const std::string& s = "") const {
+    std::cout << "FixedKalmanFilter " << s << ", dim = " << N << std::endl;
+  }
+
+ private:
+  /// Create a state from the square root information form (R, d).
+  template <class DR, class DD>
+  State fromSquareRoot(const Eigen::MatrixBase<DR>& R,
+                       const Eigen::MatrixBase<DD>& d, size_t step) const {
+    // Only the upper triangle is used, below are the Householder vectors
+    const MatrixN upper = R.template triangularView<Eigen::Upper>();
+    State result;
+    if (method_ == KalmanFilter::QR) {
+      result.matrix = upper;
+      result.vector = d;
+    } else {
+      result.matrix = upper.transpose() * upper;
+      result.vector = upper.transpose() * d;
+    }
+    result.step = step;
+    return result;
+  }
+};
+
+}  // namespace gtsam
@@ -16,12 +16,19 @@
  */
 
 #include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/inference/FactorGraph-inst.h>
 #include <gtsam/linear/GaussianBayesNet.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/linearExceptions.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 #include <fstream>
 #include <iterator>
+#include <random>
 
 using namespace std;
 using namespace gtsam;
@@ -85,6 +92,121 @@ namespace gtsam {
     return sample(given, &kRandomNumberGenerator);
   }
 
+  /* ************************************************************************ */
+  namespace {
+  // Number of samples drawn from a single random number stream. This is fixed
+  // so that batch sampling is reproducible regardless of the thread count.
+  constexpr size_t kSampleChunkSize = 1024;
+
+  // A conditional prepared for batch sampling: the contribution of the given
+  // parents is folded into the rhs, the sampled parents refer to rows of the
+  // (transposed) sample block.
+  struct BatchConditional {
+    const GaussianConditional* conditional;
+    DenseIndex offset;  // first row of the frontal variables
+    Vector rhs;         // d - S_given * x_given
+    std::vector<std::pair<GaussianConditional::const_iterator, DenseIndex>>
+        sampledParents;  // parent and its row offset
+    Vector sigmas;
+  };
+  }  // namespace
+
+  Matrix GaussianBayesNet::sampleBatch(const VectorValues& given,
+                                       size_t nrSamples,
+                                       std::uint_fast64_t seed) const {
+    gttic(GaussianBayesNet_sampleBatch);
+
+    // Lay out the frontal variables in ordering() order
+    FastMap<Key, DenseIndex> offsets;
+    DenseIndex dim = 0;
+    for (const sharedConditional& cg : *this) {
+      if (!cg) continue;
+      for (auto frontal = cg->beginFrontals(); frontal != cg->endFrontals();
+           ++frontal) {
+        offsets.emplace(*frontal, dim);
+        dim += cg->getDim(frontal);
+      }
+    }
+
+    // Prepare conditionals in sampling order (parents first)
+    std::vector<BatchConditional> conditionals;
+    conditionals.reserve(size());
+    for (auto it = std::make_reverse_iterator(end());
+         it != std::make_reverse_iterator(begin()); ++it) {
+      const sharedConditional& cg = *it;
+      if (!cg) continue;
+      BatchConditional bc;
+      bc.conditional = cg.get();
+      bc.offset = offsets.at(cg->firstFrontalKey());
+      bc.rhs = cg->d();
+      for (auto parent = cg->beginParents(); parent != cg->endParents();
+           ++parent) {
+        auto sampled = offsets.find(*parent);
+        if (sampled != offsets.end()) {
+          bc.sampledParents.emplace_back(parent, sampled->second);
+        } else if (given.exists(*parent)) {
+          bc.rhs.noalias() -= cg->getA(parent) * given.at(*parent);
+        } else {
+          throw std::invalid_argument(
+              "GaussianBayesNet::sampleBatch: parent is neither sampled nor "
+              "given");
+        }
+      }
+      const auto& model = cg->get_model();
+      bc.sigmas = model ? model->sigmas() : Vector::Ones(cg->rows());
+      conditionals.push_back(std::move(bc));
+    }
+
+    Matrix result(nrSamples, dim);
+    const size_t nrChunks = (nrSamples + kSampleChunkSize - 1) / kSampleChunkSize;
+
+    // Sample one chunk, one sample per column, then transpose into result
+    auto sampleChunk = [&](size_t chunk) {
+      const size_t start = chunk * kSampleChunkSize;
+      const DenseIndex m = std::min(kSampleChunkSize, nrSamples - start);
+      std::seed_seq seq{static_cast<std::uint64_t>(seed),
+                        static_cast<std::uint64_t>(chunk)};
+      std::mt19937_64 rng(seq);
+      std::normal_distribution<double> normal(0.0, 1.0);
+
+      Matrix X(dim, m);
+      for (const BatchConditional& bc : conditionals) {
+        const GaussianConditional& cg = *bc.conditional;
+        const DenseIndex n = cg.rows();
+        auto xF = X.middleRows(bc.offset, n);
+        xF.colwise() = bc.rhs;
+        for (const auto& [parent, offset] : bc.sampledParents)
+          xF.noalias() -=
+              cg.getA(parent) * X.middleRows(offset, cg.getDim(parent));
+        cg.R().triangularView<Eigen::Upper>().solveInPlace(xF);
+        if (xF.hasNaN()) throw IndeterminantLinearSystemException(cg.front());
+
+        // Perturb like GaussianConditional::sample, constrained rows are exact
+        for (DenseIndex j = 0; j < m; ++j)
+          for (DenseIndex i = 0; i < n; ++i)
+            if (bc.sigmas(i) != 0.0) xF(i, j) += bc.sigmas(i) * normal(rng);
+      }
+      result.middleRows(start, m) = X.transpose();
+    };
+
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, nrChunks),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        for (size_t c = range.begin(); c != range.end(); ++c)
+                          sampleChunk(c);
+                      });
+#else
+    for (size_t c = 0; c < nrChunks; ++c) sampleChunk(c);
+#endif
+
+    return result;
+  }
+
+  Matrix GaussianBayesNet::sampleBatch(size_t nrSamples,
+                                       std::uint_fast64_t seed) const {
+    return sampleBatch(VectorValues(), nrSamples, seed);
+  }
+
   /* ************************************************************************ */
   VectorValues GaussianBayesNet::optimizeGradientSearch() const
   {
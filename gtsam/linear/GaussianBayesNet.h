@@ -25,7 +25,9 @@
 #include <gtsam/inference/FactorGraph.h>
 #include <gtsam/global_includes.h>
 
+#include <cstdint>
 #include <utility>
+
 namespace gtsam {
 
   /** 
@@ -148,6 +150,30 @@ namespace gtsam {
     /// Sample from an incomplete BayesNet, use default rng
     VectorValues sample(const VectorValues& given) const;
 
+    /**
+     * Draw many samples at once using batched ancestral sampling.
+     *
+     * Samples are drawn in chunks of a fixed size, and each chunk is
+     * back-substituted as a block with matrix-matrix triangular solves. When
+     * GTSAM is built with TBB, chunks are sampled in parallel. Every chunk
+     * uses its own random number stream derived from `seed` and the chunk
+     * index, so the result does not depend on the number of threads.
+     *
+     * Example:
+     *   Matrix samples = gbn.sampleBatch(given, 1000000, 7);
+     *
+     * @param given values for parents that are not frontal in this Bayes net
+     * @param nrSamples number of samples to draw
+     * @param seed seed for the random number streams
+     * @return nrSamples x n matrix with one sample per row; the columns follow
+     *   the frontal variables in `ordering()`.
+     */
+    Matrix sampleBatch(const VectorValues& given, size_t nrSamples,
+                       std::uint_fast64_t seed = 42u) const;
+
+    /// Draw many samples at once from a complete Bayes net, see above.
+    Matrix sampleBatch(size_t nrSamples, std::uint_fast64_t seed = 42u) const;
+
     /**
      * Return ordering corresponding to a topological sort.
      * There are many topological sorts of a Bayes net. This one
@@ -19,6 +19,22 @@
 #include <gtsam/inference/JunctionTree-inst.h>
 #include <gtsam/linear/GaussianJunctionTree.h>
 #include <gtsam/linear/GaussianEliminationTree.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam/base/cholesky.h>
+#include <gtsam/config.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
 
 namespace gtsam {
 
@@ -31,4 +47,250 @@ namespace gtsam {
     const GaussianEliminationTree& eliminationTree) :
   Base(eliminationTree) {}
 
+  /* ************************************************************************* */
+  namespace {
+  // Only trees with at least this many clusters per level on average are
+  // eliminated level by level. Narrower trees, such as those of pose graphs,
+  // lose more to the level by level traversal than batching gains.
+  const size_t kMinAverageWidth = 128;
+
+  // Cliques with at most this many columns, including the right-hand side, are
+  // factorized in batches of at least kMinBatchSize and at most kMaxBatchSize
+  const DenseIndex kMaxBatchedColumns = 32;
+  const size_t kMinBatchSize = 4;
+  const size_t kMaxBatchSize = 32;
+
+  typedef GaussianFactorGraph::EliminationResult EliminationResult;
+
+  // A cluster in the level by level elimination
+  struct LevelNode {
+    GaussianJunctionTree::sharedNode cluster;
+    LevelNode* parent;
+    size_t indexInParent;
+    size_t height = 0;
+    GaussianBayesTree::sharedClique clique;
+    GaussianFactorGraph childFactors;  // messages from the children
+    HessianFactor::shared_ptr joint;   // if eliminated with Cholesky
+    EliminationResult result;
+  };
+
+  /// Call f(i) for i in [0, n), in parallel if TBB is available.
+  template <class F>
+  void ParallelFor(size_t n, const F& f) {
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        for (size_t i = range.begin(); i != range.end(); ++i)
+                          f(i);
+                      });
+#else
+    for (size_t i = 0; i < n; ++i) f(i);
+#endif
+  }
+
+  // Gather the factors of a cluster and the messages of its children, and
+  // either eliminate them with QR if they are constrained, or build their joint
+  // Hessian as EliminateCholesky does.
+  void GatherAndCombine(LevelNode& node, bool preferCholesky) {
+    GaussianFactorGraph gathered;
+    gathered.reserve(node.cluster->factors.size() + node.childFactors.size());
+    gathered.push_back(node.cluster->factors);
+    gathered.push_back(node.childFactors);
+
+    // Bayes tree orphan subtrees become children of our clique
+    for (const auto& factor : node.cluster->factors) {
+      auto asSubtree = dynamic_cast<
+          const BayesTreeOrphanWrapper<GaussianBayesTreeClique>*>(factor.get());
+      if (asSubtree) {
+        node.clique->children.push_back(asSubtree->clique);
+        asSubtree->clique->parent_ = node.clique;
+      }
+    }
+
+    node.childFactors = GaussianFactorGraph();
+
+    const Ordering& keys = node.cluster->orderedFrontalKeys;
+    if (preferCholesky && hasConstraints(gathered)) {
+      node.result = EliminateQR(gathered, keys);
+      return;
+    }
+    try {
+      Scatter scatter(gathered, keys);
+      node.joint = std::make_shared<HessianFactor>(gathered, scatter);
+    } catch (std::invalid_argument&) {
+      throw InvalidDenseElimination(
+          "EliminateCholesky was called with a request to eliminate variables that are not\n"
+          "involved in the provided factors.");
+    }
+  }
+
+  // Eliminate the joint Hessians of a batch of cliques with the same number of
+  // frontal and total columns.
+  void EliminateBatch(const std::vector<LevelNode*>& batch) {
+    const size_t B = batch.size();
+    const SymmetricBlockMatrix& info0 = batch.front()->joint->info();
+    const size_t nrFrontals = batch.front()->cluster->orderedFrontalKeys.size();
+    const size_t n = info0.cols();
+    size_t nFrontal = 0;
+    for (size_t j = 0; j < nrFrontals; ++j) nFrontal += info0.getDim(j);
+
+    // Interleave the upper triangles, factorize, and copy them back
+    std::vector<double> ABC(n * n * B);
+    for (size_t b = 0; b < B; ++b) {
+      const auto full =
+          batch[b]->joint->info().selfadjointView().nestedExpression();
+      for (size_t j = 0; j < n; ++j)
+        for (size_t i = 0; i <= j; ++i) ABC[(j * n + i) * B + b] = full(i, j);
+    }
+    const std::vector<bool> success =
+        choleskyPartialBatch(ABC.data(), n, nFrontal, B);
+    for (size_t b = 0; b < B; ++b) {
+      LevelNode& node = *batch[b];
+      if (!success[b])
+        throw IndeterminantLinearSystemException(
+            node.cluster->orderedFrontalKeys.front());
+      auto full = node.joint->info().selfadjointView().nestedExpression();
+      for (size_t j = 0; j < n; ++j)
+        for (size_t i = 0; i <= j; ++i) full(i, j) = ABC[(j * n + i) * B + b];
+      node.result = {node.joint->splitEliminatedConditional(nrFrontals),
+                     node.joint};
+    }
+  }
+  }  // namespace
+
+  /* ************************************************************************* */
+  std::pair<std::shared_ptr<GaussianBayesTree>,
+            std::shared_ptr<GaussianFactorGraph>>
+  GaussianJunctionTree::eliminate(const Eliminate& function) const {
+    // Only the default Cholesky elimination functions are batched
+    typedef EliminationResult (*PreferCholesky)(const GaussianFactorGraph&,
+                                                const Ordering&);
+    typedef decltype(&EliminateCholesky) Cholesky;
+    const PreferCholesky* preferCholesky = function.target<PreferCholesky>();
+    const Cholesky* cholesky = function.target<Cholesky>();
+    const bool prefer =
+        preferCholesky &&
+        (*preferCholesky == &EliminatePreferCholesky ||
+         *preferCholesky ==
+             &EliminationTraits<GaussianFactorGraph>::DefaultEliminate);
+    if (!prefer && !(cholesky && *cholesky == &EliminateCholesky))
+      return Base::eliminate(function);
+
+    // Flatten the tree depth-first, so that parents come before their children
+    // and the nodes of each level stay in tree order, for memory locality
+    std::vector<LevelNode> nodes;
+    std::vector<size_t> parents;
+    std::vector<size_t> depths;
+    {
+      std::vector<std::tuple<sharedNode, size_t, size_t>> stack;
+      for (size_t r = roots_.size(); r-- > 0;)
+        stack.emplace_back(roots_[r], nodes.max_size(), 0);
+      while (!stack.empty()) {
+        const auto [cluster, parent, indexInParent] = stack.back();
+        stack.pop_back();
+        const size_t i = nodes.size();
+        nodes.push_back({cluster, nullptr, indexInParent});
+        parents.push_back(parent);
+        depths.push_back(parent < i ? depths[parent] + 1 : 0);
+        for (size_t c = cluster->children.size(); c-- > 0;)
+          stack.emplace_back(cluster->children[c], i, c);
+      }
+    }
+    const size_t nrLevels =
+        depths.empty() ? 0 : *std::max_element(depths.begin(), depths.end()) + 1;
+    if (nodes.size() < kMinAverageWidth * nrLevels)
+      return Base::eliminate(function);
+
+    gttic(GaussianJunctionTree_eliminateByLevel);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      LevelNode& node = nodes[i];
+      node.clique = std::make_shared<GaussianBayesTreeClique>();
+      node.clique->problemSize_ = node.cluster->problemSize();
+      node.childFactors.resize(node.cluster->children.size());
+      if (parents[i] < nodes.size()) {
+        node.parent = &nodes[parents[i]];
+        node.clique->parent_ = node.parent->clique;
+        node.parent->clique->children.push_back(node.clique);
+      }
+    }
+
+    // Heights, leaves first, and the nodes of each height
+    size_t maxHeight = 0;
+    for (size_t i = nodes.size(); i-- > 0;) {
+      LevelNode& node = nodes[i];
+      if (node.parent)
+        node.parent->height = std::max(node.parent->height, node.height + 1);
+      maxHeight = std::max(maxHeight, node.height);
+    }
+    std::vector<std::vector<LevelNode*>> levels(maxHeight + 1);
+    for (LevelNode& node : nodes) levels[node.height].push_back(&node);
+
+    GaussianFactorGraph rootFactors;
+    for (const std::vector<LevelNode*>& level : levels) {
+      ParallelFor(level.size(),
+                  [&](size_t l) { GatherAndCombine(*level[l], prefer); });
+
+      // Batch the small cliques by number of frontal and total columns, and
+      // eliminate the others one by one
+      std::map<std::pair<DenseIndex, DenseIndex>, std::vector<LevelNode*>>
+          sameSize;
+      std::vector<std::vector<LevelNode*>> jobs;
+      for (LevelNode* node : level) {
+        if (!node->joint) continue;
+        const SymmetricBlockMatrix& info = node->joint->info();
+        if (info.cols() <= kMaxBatchedColumns) {
+          DenseIndex nFrontal = 0;
+          for (size_t j = 0; j < node->cluster->orderedFrontalKeys.size(); ++j)
+            nFrontal += info.getDim(j);
+          sameSize[{nFrontal, info.cols()}].push_back(node);
+        } else {
+          jobs.push_back({node});
+        }
+      }
+      for (const auto& [size, group] : sameSize) {
+        if (group.size() < kMinBatchSize) {
+          for (LevelNode* node : group) jobs.push_back({node});
+          continue;
+        }
+        for (size_t b = 0; b < group.size(); b += kMaxBatchSize)
+          jobs.emplace_back(group.begin() + b,
+                            group.begin() + std::min(group.size(),
+                                                     b + kMaxBatchSize));
+      }
+      ParallelFor(jobs.size(), [&](size_t j) {
+        const std::vector<LevelNode*>& job = jobs[j];
+        if (job.size() > 1) {
+          EliminateBatch(job);
+        } else {
+          LevelNode& node = *job.front();
+          node.result = {
+              node.joint->eliminateCholesky(node.cluster->orderedFrontalKeys),
+              node.joint};
+        }
+      });
+
+      // Store the conditionals, and pass the remaining factors up the tree
+      for (LevelNode* node : level) {
+        node->clique->setEliminationResult(node->result);
+        node->joint.reset();
+        const EliminationResult result = std::move(node->result);
+        if (result.second->empty()) continue;
+        if (node->parent)
+          node->parent->childFactors[node->indexInParent] = result.second;
+        else
+          rootFactors.push_back(result.second);
+      }
+    }
+
+    auto result = std::make_shared<GaussianBayesTree>();
+    for (const LevelNode& node : nodes)
+      if (!node.parent) result->insertRoot(node.clique);
+
+    // Add remaining factors that were not involved with eliminated variables
+    auto remaining = std::make_shared<GaussianFactorGraph>();
+    remaining->push_back(remainingFactors_.begin(), remainingFactors_.end());
+    remaining->push_back(rootFactors);
+    return {result, remaining};
+  }
+
 }
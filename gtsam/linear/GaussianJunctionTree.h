@@ -51,6 +51,17 @@ namespace gtsam {
     * @return The elimination tree
     */
     GaussianJunctionTree(const GaussianEliminationTree& eliminationTree);
+
+    /**
+     * Eliminate the factors to a Bayes tree and remaining factor graph, as
+     * EliminatableClusterTree::eliminate. With EliminatePreferCholesky, the
+     * default, or EliminateCholesky, wide trees are eliminated level by level,
+     * and the partial Cholesky factorizations of small cliques of the same
+     * size on the same level are done together by choleskyPartialBatch.
+     */
+    std::pair<std::shared_ptr<GaussianBayesTree>,
+              std::shared_ptr<GaussianFactorGraph>>
+    eliminate(const Eliminate& function) const;
   };
 
 }
@@ -17,6 +17,7 @@
 
 #include <gtsam/linear/HessianFactor.h>
 
+#include <gtsam/config.h>
 #include <gtsam/linear/GaussianConditional.h>
 #include <gtsam/linear/GaussianFactor.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
@@ -30,10 +31,16 @@
 #include <gtsam/base/ThreadsafeException.h>
 #include <gtsam/base/timing.h>
 
+#include <algorithm>
 #include <sstream>
 #include <cassert>
 #include <limits>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
 using namespace std;
 
 namespace gtsam {
@@ -41,6 +48,63 @@ namespace gtsam {
 // Typedefs used in constructors below.
 using Dims = std::vector<Key>;
 
+// Each thread that accumulates factors into a HessianFactor in parallel gets
+// at least this many factors.
+static const size_t kMinFactorsPerThread = 64;
+
+/* ************************************************************************* */
+// For large cliques, add the factors to the zeroed information matrix info in
+// parallel: they are split in contiguous chunks, the first one is accumulated
+// into info and the others into zeroed copies of it, whose upper triangles are
+// then added to info. A copy costs about as much as adding up n^2 entries, for
+// n columns, so each chunk must do more work than that, estimated as the sum
+// of (d+1)^2 over its factors of total dimension d. Returns false if it does
+// not pay off, or without TBB.
+static bool ParallelUpdateHessian(const GaussianFactorGraph& factors,
+                                  const KeyVector& keys,
+                                  SymmetricBlockMatrix* info) {
+#ifdef GTSAM_USE_TBB
+  const size_t maxThreads = tbb::this_task_arena::max_concurrency();
+  if (maxThreads < 2 || factors.size() < 2 * kMinFactorsPerThread)
+    return false;
+
+  // Cumulative work, to split the factors in chunks of equal work
+  std::vector<double> work(factors.size() + 1, 0.0);
+  for (size_t i = 0; i < factors.size(); ++i) {
+    double d = 1.0;
+    if (factors[i])
+      for (auto key = factors[i]->begin(); key != factors[i]->end(); ++key)
+        d += factors[i]->getDim(key);
+    work[i + 1] = work[i] + d * d;
+  }
+  const double n = info->cols();
+  const size_t nrChunks =
+      std::min({maxThreads, factors.size() / kMinFactorsPerThread,
+                static_cast<size_t>(work.back() / (n * n))});
+  if (nrChunks < 2) return false;
+
+  gttic(ParallelUpdateHessian);
+  std::vector<size_t> begin(nrChunks + 1, factors.size());
+  for (size_t c = 0; c < nrChunks; ++c)
+    begin[c] = std::lower_bound(work.begin(), work.end(),
+                                c * work.back() / nrChunks) -
+               work.begin();
+  std::vector<SymmetricBlockMatrix> partial(nrChunks - 1, *info);
+  tbb::parallel_for(size_t(0), nrChunks, [&](size_t c) {
+    SymmetricBlockMatrix* chunkInfo = c == 0 ? info : &partial[c - 1];
+    for (size_t i = begin[c]; i < begin[c + 1]; ++i)
+      if (factors[i]) factors[i]->updateHessian(keys, chunkInfo);
+  });
+  auto upper =
+      info->selfadjointView().nestedExpression().triangularView<Eigen::Upper>();
+  for (const SymmetricBlockMatrix& chunkInfo : partial)
+    upper += chunkInfo.selfadjointView().nestedExpression();
+  return true;
+#else
+  return false;
+#endif
+}
+
 /* ************************************************************************* */
 void HessianFactor::Allocate(const Scatter& scatter) {
   gttic(HessianFactor_Allocate);
@@ -246,9 +310,10 @@ HessianFactor::HessianFactor(const GaussianFactorGraph& factors,
   // Form A' * A
   gttic(update);
   info_.setZero();
-  for(const auto& factor: factors)
-    if (factor)
-      factor->updateHessian(keys_, &info_);
+  if (!ParallelUpdateHessian(factors, keys_, &info_))
+    for(const auto& factor: factors)
+      if (factor)
+        factor->updateHessian(keys_, &info_);
   gttoc(update);
 }
 
@@ -467,13 +532,7 @@ std::shared_ptr<GaussianConditional> HessianFactor::eliminateCholesky(const Orde
     size_t nFrontals = keys.size();
     assert(nFrontals <= size());
     info_.choleskyPartial(nFrontals);
-
-    // TODO(frank): pre-allocate GaussianConditional and write into it
-    const VerticalBlockMatrix Ab = info_.split(nFrontals);
-    conditional = std::make_shared<GaussianConditional>(keys_, nFrontals, Ab);
-
-    // Erase the eliminated keys in this factor
-    keys_.erase(begin(), begin() + nFrontals);
+    conditional = splitEliminatedConditional(nFrontals);
   } catch (const CholeskyFailed&) {
 #ifndef NDEBUG
     cout << "Partial Cholesky on HessianFactor failed." << endl;
@@ -487,6 +546,19 @@ std::shared_ptr<GaussianConditional> HessianFactor::eliminateCholesky(const Orde
   return conditional;
 }
 
+/* ************************************************************************* */
+std::shared_ptr<GaussianConditional> HessianFactor::splitEliminatedConditional(
+    size_t nFrontals) {
+  // TODO(frank): pre-allocate GaussianConditional and write into it
+  const VerticalBlockMatrix Ab = info_.split(nFrontals);
+  auto conditional =
+      std::make_shared<GaussianConditional>(keys_, nFrontals, Ab);
+
+  // Erase the eliminated keys in this factor
+  keys_.erase(begin(), begin() + nFrontals);
+  return conditional;
+}
+
 /* ************************************************************************* */
 VectorValues HessianFactor::solve() {
   gttic(HessianFactor_solve);
@@ -357,6 +357,13 @@ namespace gtsam {
      */
     std::shared_ptr<GaussianConditional> eliminateCholesky(const Ordering& keys);
 
+    /**
+     *  Second half of eliminateCholesky, for a factor whose first nFrontals variables were
+     *  already eliminated in place by partial Cholesky of info(): returns the conditional on
+     *  them, and leaves this factor on the remaining keys.
+     */
+    std::shared_ptr<GaussianConditional> splitEliminatedConditional(size_t nFrontals);
+
       /// Solve the system A'*A delta = A'*b in-place, return delta as VectorValues
     VectorValues solve();
 
@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    IncompleteCholeskyPreconditioner.cpp
+ * @brief   Block incomplete Cholesky preconditioner, IC(0) or with threshold
+ *          based fill-in (ICT)
+ * @date    October 2026
+ */
+
+#include <gtsam/linear/BlockSparseHessian.h>
+#include <gtsam/linear/IncompleteCholeskyPreconditioner.h>
+#include <gtsam/linear/IterativeSolver.h>
+
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+/* ************************************************************************* */
+void IncompleteCholeskyPreconditionerParameters::print(ostream& os) const {
+  Base::print(os);
+  os << "IncompleteCholeskyPreconditionerParameters" << endl
+     << "allowFill:     " << allowFill << endl
+     << "dropTolerance: " << dropTolerance << endl
+     << "initialShift:  " << initialShift << endl;
+}
+
+/* ************************************************************************* */
+void IncompleteCholeskyPreconditioner::solve(const Vector& y,
+                                             Vector& x) const {
+  // Forward substitution, by block columns of L
+  x = y;
+  const size_t n = dims_.size();
+  for (size_t j = 0; j < n; ++j) {
+    auto xj = x.segment(offsets_[j], dims_[j]);
+    const size_t first = columnBlocks_[j];
+    Eigen::Map<const Matrix>(values_.data() + valueOffsets_[first], dims_[j],
+                             dims_[j])
+        .triangularView<Eigen::Lower>()
+        .solveInPlace(xj);
+    for (size_t k = first + 1; k < columnBlocks_[j + 1]; ++k) {
+      const size_t i = rows_[k];
+      x.segment(offsets_[i], dims_[i]).noalias() -=
+          Eigen::Map<const Matrix>(values_.data() + valueOffsets_[k],
+                                   dims_[i], dims_[j]) *
+          xj;
+    }
+  }
+}
+
+/* ************************************************************************* */
+void IncompleteCholeskyPreconditioner::transposeSolve(const Vector& y,
+                                                      Vector& x) const {
+  // Back substitution with L', i.e., by block rows of L'
+  x = y;
+  for (size_t j = dims_.size(); j-- > 0;) {
+    auto xj = x.segment(offsets_[j], dims_[j]);
+    const size_t first = columnBlocks_[j];
+    for (size_t k = first + 1; k < columnBlocks_[j + 1]; ++k) {
+      const size_t i = rows_[k];
+      xj.noalias() -= Eigen::Map<const Matrix>(values_.data() + valueOffsets_[k],
+                                               dims_[i], dims_[j])
+                          .transpose() *
+                      x.segment(offsets_[i], dims_[i]);
+    }
+    Eigen::Map<const Matrix>(values_.data() + valueOffsets_[first], dims_[j],
+                             dims_[j])
+        .transpose()
+        .triangularView<Eigen::Upper>()
+        .solveInPlace(xj);
+  }
+}
+
+/* ************************************************************************* */
+void IncompleteCholeskyPreconditioner::build(
+    const GaussianFactorGraph& gfg, const KeyInfo& info,
+    const std::map<Key, Vector>& lambda) {
+  hessian_ = BlockSparseHessian(gfg, info);
+  updateDamping(info, lambda);
+}
+
+/* ************************************************************************* */
+bool IncompleteCholeskyPreconditioner::updateDamping(
+    const KeyInfo& info, const std::map<Key, Vector>& lambda) {
+  if (lambda.empty()) {
+    factorize(hessian_);
+  } else {
+    BlockSparseHessian A = hessian_;
+    A.addDiagonal(info.diagonal(lambda));
+    factorize(A);
+  }
+  return true;
+}
+
+/* ************************************************************************* */
+void IncompleteCholeskyPreconditioner::factorize(const BlockSparseHessian& A) {
+  // Restart with a growing diagonal shift on breakdown
+  const size_t maxAttempts = 20;
+  double shift = 0.0;
+  for (size_t attempt = 0; attempt < maxAttempts; ++attempt) {
+    if (factorize(A, shift)) {
+      shift_ = shift;
+      if (parameters_.verbosity() >= Parameters::COMPLEXITY)
+        cout << "IncompleteCholeskyPreconditioner: " << nrBlocks()
+             << " blocks for " << A.nrBlocks() << " blocks in A, shift "
+             << shift << endl;
+      return;
+    }
+    shift = (shift == 0.0) ? parameters_.initialShift : 10.0 * shift;
+  }
+  throw runtime_error(
+      "IncompleteCholeskyPreconditioner: factorization broke down");
+}
+
+/* ************************************************************************* */
+bool IncompleteCholeskyPreconditioner::factorize(const BlockSparseHessian& A,
+                                                 double shift) {
+  // Lower triangle of A by block columns, columns[j] has A_ij for i > j
+  const size_t n = A.size();
+  std::vector<Matrix> diagonal(n);
+  std::vector<std::map<size_t, Matrix>> columns(n);
+  std::vector<double> norms(n);
+  for (size_t j = 0; j < n; ++j) {
+    for (size_t k = A.rowBegin(j); k < A.rowEnd(j); ++k) {
+      const size_t i = A.column(k);
+      if (i == j) {
+        diagonal[j] = A.block(j, k);
+        norms[j] = diagonal[j].norm();
+        diagonal[j].diagonal() *= 1.0 + shift;
+      } else if (i > j) {
+        columns[j].emplace_hint(columns[j].end(), i, A.block(j, k).transpose());
+      }
+    }
+  }
+
+  // Right-looking factorization, updating the remaining columns with L_j L_j'
+  const bool allowFill = parameters_.allowFill;
+  const double tolerance = parameters_.dropTolerance;
+  for (size_t j = 0; j < n; ++j) {
+    Eigen::LLT<Matrix> llt(diagonal[j]);
+    if (llt.info() != Eigen::Success) return false;
+    diagonal[j] = llt.matrixL();
+    auto& column = columns[j];
+    for (auto& [i, Lij] : column)
+      diagonal[j]
+          .triangularView<Eigen::Lower>()
+          .transpose()
+          .solveInPlace<Eigen::OnTheRight>(Lij);
+
+    for (auto k = column.begin(); k != column.end(); ++k) {
+      const Matrix& Lkj = k->second;
+      diagonal[k->first].noalias() -= Lkj * Lkj.transpose();
+      auto& target = columns[k->first];
+      for (auto i = std::next(k); i != column.end(); ++i) {
+        auto it = target.find(i->first);
+        if (it != target.end()) {
+          it->second.noalias() -= i->second * Lkj.transpose();
+        } else if (allowFill) {
+          Matrix fill = -i->second * Lkj.transpose();
+          if (fill.norm() >
+              tolerance * std::sqrt(norms[i->first] * norms[k->first]))
+            target.emplace(i->first, std::move(fill));
+        }
+      }
+    }
+  }
+
+  // Store L by block columns, with the diagonal block first
+  dims_ = A.dims();
+  offsets_.resize(n);
+  for (size_t j = 0; j < n; ++j) offsets_[j] = A.offset(j);
+  columnBlocks_.assign(1, 0);
+  rows_.clear();
+  valueOffsets_.clear();
+  values_.clear();
+  auto append = [this](size_t i, const Matrix& block) {
+    rows_.push_back(i);
+    valueOffsets_.push_back(values_.size());
+    values_.insert(values_.end(), block.data(), block.data() + block.size());
+  };
+  for (size_t j = 0; j < n; ++j) {
+    append(j, diagonal[j]);
+    for (const auto& [i, Lij] : columns[j]) append(i, Lij);
+    columnBlocks_.push_back(rows_.size());
+  }
+  return true;
+}
+
+}  // namespace gtsam
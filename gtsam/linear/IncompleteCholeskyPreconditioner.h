@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    IncompleteCholeskyPreconditioner.h
+ * @brief   Block incomplete Cholesky preconditioner, IC(0) or with threshold
+ *          based fill-in (ICT)
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/BlockSparseHessian.h>
+#include <gtsam/linear/Preconditioner.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/*******************************************************************************************/
+struct GTSAM_EXPORT IncompleteCholeskyPreconditionerParameters
+    : public PreconditionerParameters {
+  typedef PreconditionerParameters Base;
+  typedef std::shared_ptr<IncompleteCholeskyPreconditionerParameters>
+      shared_ptr;
+
+  /// If false, no fill-in is kept (IC(0)), otherwise fill-in blocks with a
+  /// large enough norm are kept (ICT).
+  bool allowFill;
+
+  /// ICT keeps a fill-in block L_ij if |L_ij| > dropTolerance *
+  /// sqrt(|A_ii| |A_jj|), with Frobenius norms.
+  double dropTolerance;
+
+  /// If the factorization breaks down, it is restarted on A + shift * diag(A),
+  /// with shift starting here and growing tenfold.
+  double initialShift;
+
+  IncompleteCholeskyPreconditionerParameters(bool allowFill = false,
+                                             double dropTolerance = 1e-2,
+                                             double initialShift = 1e-3)
+      : Base(),
+        allowFill(allowFill),
+        dropTolerance(dropTolerance),
+        initialShift(initialShift) {}
+  ~IncompleteCholeskyPreconditionerParameters() override {}
+
+  void print(std::ostream& os) const override;
+};
+
+/*******************************************************************************************/
+/**
+ * Block incomplete Cholesky factorization A ~ L L', on the blocks of the
+ * Hessian A = J'J of the factor graph, with one block per variable in the
+ * order of KeyInfo. IC(0) keeps the sparsity of A, ICT also keeps fill-in
+ * blocks above a relative drop tolerance. As a split preconditioner, solve and
+ * transposeSolve are block forward and back substitution with L.
+ */
+class GTSAM_EXPORT IncompleteCholeskyPreconditioner : public Preconditioner {
+ public:
+  typedef Preconditioner Base;
+  typedef IncompleteCholeskyPreconditionerParameters Parameters;
+
+  explicit IncompleteCholeskyPreconditioner(
+      const Parameters& parameters = Parameters())
+      : Base(), parameters_(parameters) {}
+  ~IncompleteCholeskyPreconditioner() override {}
+
+  /* Computation Interfaces for raw vector */
+  void solve(const Vector& y, Vector& x) const override;
+  void transposeSolve(const Vector& y, Vector& x) const override;
+  void build(const GaussianFactorGraph& gfg, const KeyInfo& info,
+             const std::map<Key, Vector>& lambda) override;
+  bool updateDamping(const KeyInfo& info,
+                     const std::map<Key, Vector>& lambda) override;
+
+  /// Factorize the given block-sparse matrix.
+  void factorize(const BlockSparseHessian& A);
+
+  /// Number of blocks of L, including the diagonal.
+  size_t nrBlocks() const { return rows_.size(); }
+
+  /// Diagonal shift used in the last factorization, 0 if there was none.
+  double shift() const { return shift_; }
+
+ protected:
+  /// Factorize A + shift * D, return false on breakdown.
+  bool factorize(const BlockSparseHessian& A, double shift);
+
+  Parameters parameters_;
+  BlockSparseHessian hessian_;  ///< undamped Hessian of the last build
+  double shift_ = 0.0;
+  std::vector<size_t> dims_, offsets_;
+  std::vector<size_t> columnBlocks_;  ///< first block of each block column
+  std::vector<size_t> rows_;          ///< block row, the diagonal is first
+  std::vector<size_t> valueOffsets_;
+  std::vector<double> values_;
+};
+
+}  // namespace gtsam
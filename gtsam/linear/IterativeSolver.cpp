@@ -154,5 +154,15 @@ Vector KeyInfo::x0vector() const {
   return Vector::Zero(numCols_);
 }
 
+/****************************************************************************/
+Vector KeyInfo::diagonal(const std::map<Key, Vector> &lambda) const {
+  Vector result = Vector::Zero(numCols_);
+  for (const auto &[key, value] : lambda) {
+    const auto it = find(key);
+    if (it != end()) result.segment(it->second.start, it->second.dim) = value;
+  }
+  return result;
+}
+
 }
 
@@ -169,6 +169,10 @@ public:
   /// Return zero Vector of correct dimension
   Vector x0vector() const;
 
+  /// Return the damping lambda as a Vector ordered by ordering(), with zeros
+  /// for the keys that are not in lambda
+  Vector diagonal(const std::map<Key, Vector> &lambda) const;
+
 };
 
 } // \ namespace gtsam
@@ -422,6 +422,7 @@ namespace gtsam {
 
     // be very selective on who can access these private methods:
     template<typename T> friend class ExpressionFactor;
+    template<class E> friend class FusedExpressionFactor;
 
 #if GTSAM_ENABLE_BOOST_SERIALIZATION
     /** Serialization function */
@@ -0,0 +1,359 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    MultigridPreconditioner.cpp
+ * @brief   Algebraic multigrid preconditioner on the block structure of a
+ *          GaussianFactorGraph
+ * @date    October 2026
+ */
+
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/linear/MultigridPreconditioner.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+const size_t kNone = numeric_limits<size_t>::max();
+
+/// Coarse levels with more columns are smoothed instead of factorized.
+const size_t kMaxDenseColumns = 4000;
+
+/// Coarsening stalls if it keeps more than this fraction of the variables.
+const double kMaxCoarseningRatio = 0.8;
+
+/// Strongly connected neighbours of variable i, with their strength.
+template <class F>
+void ForStrongNeighbours(const BlockSparseHessian& A,
+                         const std::vector<double>& norms, double threshold,
+                         size_t i, const F& f) {
+  for (size_t k = A.rowBegin(i); k < A.rowEnd(i); ++k) {
+    const size_t j = A.column(k);
+    if (j == i || A.dim(j) != A.dim(i)) continue;
+    const double strength = A.block(i, k).norm();
+    if (strength >= threshold * std::sqrt(norms[i] * norms[j])) f(j, strength);
+  }
+}
+
+/// Greedy aggregation of strongly connected variables, returns the number of
+/// aggregates.
+size_t Aggregate(const BlockSparseHessian& A, double threshold,
+                 std::vector<size_t>& aggregates) {
+  const size_t n = A.size();
+  std::vector<double> norms(n);
+  for (size_t i = 0; i < n; ++i) norms[i] = A.block(i, A.diagonal(i)).norm();
+
+  // Pass 1: variables whose strong neighbours are all free seed an aggregate
+  aggregates.assign(n, kNone);
+  size_t nrAggregates = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (aggregates[i] != kNone) continue;
+    bool free = true;
+    ForStrongNeighbours(A, norms, threshold, i, [&](size_t j, double) {
+      if (aggregates[j] != kNone) free = false;
+    });
+    if (!free) continue;
+    aggregates[i] = nrAggregates;
+    ForStrongNeighbours(A, norms, threshold, i,
+                        [&](size_t j, double) { aggregates[j] = nrAggregates; });
+    ++nrAggregates;
+  }
+
+  // Pass 2: join the aggregate of the strongest neighbour from pass 1
+  const std::vector<size_t> seeded = aggregates;
+  for (size_t i = 0; i < n; ++i) {
+    if (aggregates[i] != kNone) continue;
+    double best = 0.0;
+    ForStrongNeighbours(A, norms, threshold, i, [&](size_t j, double strength) {
+      if (seeded[j] != kNone && strength > best) {
+        best = strength;
+        aggregates[i] = seeded[j];
+      }
+    });
+  }
+
+  // Pass 3: the remaining variables aggregate with their free neighbours
+  for (size_t i = 0; i < n; ++i) {
+    if (aggregates[i] != kNone) continue;
+    aggregates[i] = nrAggregates;
+    ForStrongNeighbours(A, norms, threshold, i, [&](size_t j, double) {
+      if (aggregates[j] == kNone) aggregates[j] = nrAggregates;
+    });
+    ++nrAggregates;
+  }
+  return nrAggregates;
+}
+
+/// Estimate the spectral radius of D^{-1}A with power iteration.
+double SpectralRadius(const BlockSparseHessian& A,
+                      const std::vector<Eigen::LLT<Matrix>>& diagonal) {
+  const size_t nrIterations = 10;
+  Vector x = Vector::Ones(A.cols()), y;
+  double rho = 1.0;
+  for (size_t k = 0; k < nrIterations; ++k) {
+    A.multiply(x, y);
+    for (size_t i = 0; i < A.size(); ++i)
+      diagonal[i].solveInPlace(y.segment(A.offset(i), A.dim(i)));
+    rho = y.norm() / x.norm();
+    x = y.normalized();
+  }
+  return rho;
+}
+
+/// Blocks of the smoothed prolongation P = (I - omega D^{-1} A) P0, with P0
+/// the block identity on every aggregate, by block rows.
+BlockSparseHessian::Rows SmoothedProlongation(
+    const BlockSparseHessian& A,
+    const std::vector<Eigen::LLT<Matrix>>& diagonal,
+    const std::vector<size_t>& aggregates) {
+  const double omega = 4.0 / (3.0 * SpectralRadius(A, diagonal));
+  BlockSparseHessian::Rows P(A.size());
+  for (size_t i = 0; i < A.size(); ++i) {
+    for (size_t k = A.rowBegin(i); k < A.rowEnd(i); ++k) {
+      Matrix block = -omega * diagonal[i].solve(Matrix(A.block(i, k)));
+      auto [it, inserted] =
+          P[i].try_emplace(aggregates[A.column(k)], std::move(block));
+      if (!inserted) it->second += block;
+    }
+    P[i].at(aggregates[i]).diagonal().array() += 1.0;
+  }
+  return P;
+}
+
+/// Galerkin product P'AP, with P given by block rows.
+BlockSparseHessian Galerkin(const BlockSparseHessian& A,
+                            const BlockSparseHessian::Rows& P,
+                            const std::vector<size_t>& dims) {
+  BlockSparseHessian::Rows rows(dims.size());
+  std::map<size_t, Matrix> AP;  // block row i of A*P
+  for (size_t i = 0; i < A.size(); ++i) {
+    AP.clear();
+    for (size_t k = A.rowBegin(i); k < A.rowEnd(i); ++k) {
+      for (const auto& [b, Pjb] : P[A.column(k)]) {
+        Matrix block = A.block(i, k) * Pjb;
+        auto [it, inserted] = AP.try_emplace(b, std::move(block));
+        if (!inserted) it->second += block;
+      }
+    }
+    for (const auto& [a, Pia] : P[i]) {
+      for (const auto& [b, APib] : AP) {
+        Matrix block = Pia.transpose() * APib;
+        auto [it, inserted] = rows[a].try_emplace(b, std::move(block));
+        if (!inserted) it->second += block;
+      }
+    }
+  }
+  return BlockSparseHessian(dims, rows);
+}
+}  // namespace
+
+/* ************************************************************************* */
+void MultigridPreconditionerParameters::print(ostream& os) const {
+  Base::print(os);
+  os << "MultigridPreconditionerParameters" << endl
+     << "strengthThreshold: " << strengthThreshold << endl
+     << "coarsestSize:      " << coarsestSize << endl
+     << "maxLevels:         " << maxLevels << endl
+     << "nrSweeps:          " << nrSweeps << endl;
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::solve(const Vector& y, Vector& x) const {
+  throw runtime_error(
+      "MultigridPreconditioner::solve: the preconditioner is not split, use "
+      "precondition");
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::transposeSolve(const Vector& y,
+                                             Vector& x) const {
+  throw runtime_error(
+      "MultigridPreconditioner::transposeSolve: the preconditioner is not "
+      "split, use precondition");
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::precondition(const Vector& y, Vector& x) const {
+  const Level& finest = levels_.front();
+  finest.b = y;
+  cycle(0);
+  x = finest.x;
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::build(const GaussianFactorGraph& gfg,
+                                    const KeyInfo& info,
+                                    const std::map<Key, Vector>& lambda) {
+  hessian_ = BlockSparseHessian(gfg, info);
+  updateDamping(info, lambda);
+}
+
+/* ************************************************************************* */
+bool MultigridPreconditioner::updateDamping(
+    const KeyInfo& info, const std::map<Key, Vector>& lambda) {
+  // The damping changes the smoothers and the prolongation, so the hierarchy
+  // is rebuilt, but without assembling the Hessian again.
+  BlockSparseHessian A = hessian_;
+  if (!lambda.empty()) A.addDiagonal(info.diagonal(lambda));
+  build(A);
+  return true;
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::build(const BlockSparseHessian& A) {
+  levels_.clear();
+  levels_.emplace_back();
+  levels_.back().A = A;
+  while (true) {
+    Level& fine = levels_.back();
+
+    // Factorize the diagonal blocks, for smoothing and the prolongation
+    fine.diagonal.clear();
+    fine.diagonal.reserve(fine.A.size());
+    for (size_t i = 0; i < fine.A.size(); ++i) {
+      fine.diagonal.emplace_back(fine.A.block(i, fine.A.diagonal(i)));
+      if (fine.diagonal.back().info() != Eigen::Success)
+        throw runtime_error(
+            "MultigridPreconditioner: diagonal block is not positive definite");
+    }
+
+    if (levels_.size() >= parameters_.maxLevels ||
+        fine.A.size() <= parameters_.coarsestSize)
+      break;
+    std::vector<size_t> aggregates;
+    const size_t nrAggregates =
+        Aggregate(fine.A, parameters_.strengthThreshold, aggregates);
+    if (nrAggregates > kMaxCoarseningRatio * fine.A.size()) break;
+
+    std::vector<size_t> dims(nrAggregates);
+    for (size_t i = 0; i < fine.A.size(); ++i)
+      dims[aggregates[i]] = fine.A.dim(i);
+    const BlockSparseHessian::Rows P =
+        SmoothedProlongation(fine.A, fine.diagonal, aggregates);
+    BlockSparseHessian coarse = Galerkin(fine.A, P, dims);
+
+    // Store P by block rows
+    Prolongation& prolongation = fine.P;
+    prolongation.rowBlocks.assign(1, 0);
+    for (size_t i = 0; i < fine.A.size(); ++i) {
+      for (const auto& [a, Pia] : P[i]) {
+        prolongation.columns.push_back(a);
+        prolongation.offsets.push_back(prolongation.values.size());
+        prolongation.values.insert(prolongation.values.end(), Pia.data(),
+                                   Pia.data() + Pia.size());
+      }
+      prolongation.rowBlocks.push_back(prolongation.columns.size());
+    }
+
+    levels_.emplace_back();
+    levels_.back().A = std::move(coarse);
+  }
+
+  // Factorize the coarsest level if it is small and definite enough
+  const BlockSparseHessian& coarsest = levels_.back().A;
+  dense_ = false;
+  if (coarsest.cols() <= kMaxDenseColumns) {
+    coarsest_.compute(coarsest.dense());
+    dense_ = (coarsest_.info() == Eigen::Success);
+  }
+
+  if (parameters_.verbosity() >= Parameters::COMPLEXITY) {
+    cout << "MultigridPreconditioner: " << levels_.size() << " levels with";
+    for (const Level& level : levels_)
+      cout << " " << level.A.size() << " (" << level.A.nrBlocks() << ")";
+    cout << " variables (blocks), " << (dense_ ? "dense" : "smoothed")
+         << " coarsest level" << endl;
+  }
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::smooth(const Level& level, bool forward) const {
+  const BlockSparseHessian& A = level.A;
+  const size_t n = A.size();
+  for (size_t s = 0; s < n; ++s) {
+    const size_t i = forward ? s : n - 1 - s;
+    const size_t d = A.dim(i);
+    // x_i = A_ii^{-1} (b_i - sum_{j != i} A_ij x_j), with r_i as workspace
+    auto ri = level.r.segment(A.offset(i), d);
+    ri = level.b.segment(A.offset(i), d);
+    for (size_t k = A.rowBegin(i); k < A.rowEnd(i); ++k) {
+      const size_t j = A.column(k);
+      if (j != i)
+        ri.noalias() -= A.block(i, k) * level.x.segment(A.offset(j), A.dim(j));
+    }
+    auto xi = level.x.segment(A.offset(i), d);
+    xi = ri;
+    level.diagonal[i].solveInPlace(xi);
+  }
+}
+
+/* ************************************************************************* */
+void MultigridPreconditioner::cycle(size_t l) const {
+  const Level& level = levels_[l];
+  const BlockSparseHessian& A = level.A;
+  level.x.setZero(A.cols());
+  level.r.resize(A.cols());
+
+  if (l + 1 == levels_.size()) {
+    if (dense_) {
+      level.x = coarsest_.solve(level.b);
+    } else {
+      for (size_t s = 0; s < parameters_.nrSweeps; ++s) {
+        smooth(level, true);
+        smooth(level, false);
+      }
+    }
+    return;
+  }
+
+  // Pre-smoothing
+  for (size_t s = 0; s < parameters_.nrSweeps; ++s) smooth(level, true);
+
+  // Restrict the residual, r = b - A x, and correct with the coarse solution
+  A.multiply(level.x, level.r);
+  level.r = level.b - level.r;
+  const Level& coarse = levels_[l + 1];
+  const Prolongation& P = level.P;
+  coarse.b.setZero(coarse.A.cols());
+  for (size_t i = 0; i < A.size(); ++i) {
+    for (size_t k = P.rowBlocks[i]; k < P.rowBlocks[i + 1]; ++k) {
+      const size_t a = P.columns[k];
+      coarse.b.segment(coarse.A.offset(a), coarse.A.dim(a)).noalias() +=
+          Eigen::Map<const Matrix>(P.values.data() + P.offsets[k], A.dim(i),
+                                   coarse.A.dim(a))
+              .transpose() *
+          level.r.segment(A.offset(i), A.dim(i));
+    }
+  }
+  cycle(l + 1);
+  for (size_t i = 0; i < A.size(); ++i) {
+    for (size_t k = P.rowBlocks[i]; k < P.rowBlocks[i + 1]; ++k) {
+      const size_t a = P.columns[k];
+      level.x.segment(A.offset(i), A.dim(i)).noalias() +=
+          Eigen::Map<const Matrix>(P.values.data() + P.offsets[k], A.dim(i),
+                                   coarse.A.dim(a)) *
+          coarse.x.segment(coarse.A.offset(a), coarse.A.dim(a));
+    }
+  }
+
+  // Post-smoothing, in reverse order so that the cycle is symmetric
+  for (size_t s = 0; s < parameters_.nrSweeps; ++s) smooth(level, false);
+}
+
+}  // namespace gtsam
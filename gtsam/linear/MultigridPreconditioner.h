@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    MultigridPreconditioner.h
+ * @brief   Algebraic multigrid preconditioner on the block structure of a
+ *          GaussianFactorGraph
+ * @date    October 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/BlockSparseHessian.h>
+#include <gtsam/linear/Preconditioner.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/*******************************************************************************************/
+struct GTSAM_EXPORT MultigridPreconditionerParameters
+    : public PreconditionerParameters {
+  typedef PreconditionerParameters Base;
+  typedef std::shared_ptr<MultigridPreconditionerParameters> shared_ptr;
+
+  /// Variables i and j are strongly connected if |A_ij| >= strengthThreshold *
+  /// sqrt(|A_ii| |A_jj|), with Frobenius norms. With 0, all neighbours of
+  /// equal dimension are.
+  double strengthThreshold = 0.0;
+
+  /// Coarsening stops at this number of variables, or when it stalls.
+  size_t coarsestSize = 200;
+
+  /// Maximum number of levels, including the finest.
+  size_t maxLevels = 10;
+
+  /// Symmetric block Gauss-Seidel sweeps before and after coarse correction.
+  size_t nrSweeps = 1;
+
+  MultigridPreconditionerParameters() : Base() {}
+  ~MultigridPreconditionerParameters() override {}
+
+  void print(std::ostream& os) const override;
+};
+
+/*******************************************************************************************/
+/**
+ * Smoothed aggregation algebraic multigrid on the Hessian A = J'J of the
+ * factor graph, with one block per variable. Strongly connected variables of
+ * equal dimension are aggregated greedily into coarse variables. The
+ * prolongation P is the block identity on every aggregate, smoothed with one
+ * damped block Jacobi step, and the coarse Hessians are P'AP. M^{-1} is one
+ * symmetric V-cycle with block Gauss-Seidel smoothing and a dense Cholesky
+ * solve on the coarsest level.
+ *
+ * M is not split into L L', so PCGSolver uses it through precondition, with
+ * unsplitPreconditionedConjugateGradient.
+ */
+class GTSAM_EXPORT MultigridPreconditioner : public Preconditioner {
+ public:
+  typedef Preconditioner Base;
+  typedef MultigridPreconditionerParameters Parameters;
+
+  explicit MultigridPreconditioner(const Parameters& parameters = Parameters())
+      : Base(), parameters_(parameters) {}
+  ~MultigridPreconditioner() override {}
+
+  /* Computation Interfaces for raw vector */
+  void solve(const Vector& y, Vector& x) const override;
+  void transposeSolve(const Vector& y, Vector& x) const override;
+  void precondition(const Vector& y, Vector& x) const override;
+  bool isSplit() const override { return false; }
+  void build(const GaussianFactorGraph& gfg, const KeyInfo& info,
+             const std::map<Key, Vector>& lambda) override;
+  bool updateDamping(const KeyInfo& info,
+                     const std::map<Key, Vector>& lambda) override;
+
+  /// Build the hierarchy for the given block-sparse matrix.
+  void build(const BlockSparseHessian& A);
+
+  /// Number of levels, including the finest.
+  size_t nrLevels() const { return levels_.size(); }
+
+  /// Matrix on the given level.
+  const BlockSparseHessian& matrix(size_t level) const {
+    return levels_[level].A;
+  }
+
+ protected:
+  /// Block-sparse prolongation from the next level, by block rows.
+  struct Prolongation {
+    std::vector<size_t> rowBlocks;  ///< first block of each block row
+    std::vector<size_t> columns;    ///< coarse variable of each block
+    std::vector<size_t> offsets;    ///< offset of each block in values
+    std::vector<double> values;
+  };
+
+  struct Level {
+    BlockSparseHessian A;
+    std::vector<Eigen::LLT<Matrix>> diagonal;  ///< for Gauss-Seidel
+    Prolongation P;                            ///< empty on the coarsest
+    mutable Vector b, x, r;                    ///< workspace of the V-cycle
+  };
+
+  /// Block Gauss-Seidel sweep on a level, forward or backward.
+  void smooth(const Level& level, bool forward) const;
+
+  /// V-cycle on level l, with right-hand side and result in the workspace.
+  void cycle(size_t l) const;
+
+  Parameters parameters_;
+  BlockSparseHessian hessian_;  ///< undamped Hessian of the last build
+  std::vector<Level> levels_;
+  Eigen::LLT<Matrix> coarsest_;
+  bool dense_ = false;  ///< if false, the coarsest level is only smoothed
+};
+
+}  // namespace gtsam
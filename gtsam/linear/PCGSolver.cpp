@@ -18,6 +18,7 @@
  */
 
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/BlockCSRJacobian.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/VectorValues.h>
@@ -58,9 +59,80 @@ VectorValues PCGSolver::optimize(const GaussianFactorGraph &gfg,
   preconditioner_->build(gfg, keyInfo, lambda);
 
   /* apply pcg */
-  GaussianFactorGraphSystem system(gfg, *preconditioner_, keyInfo, lambda);
+  GaussianFactorGraphSystem system(gfg, *preconditioner_, keyInfo, lambda,
+                                   parameters_.blas_kernel);
   Vector x0 = initial.vector(keyInfo.ordering());
-  const Vector sol = preconditionedConjugateGradient(system, x0, parameters_);
+  const Vector sol =
+      preconditioner_->isSplit()
+          ? preconditionedConjugateGradient(system, x0, parameters_,
+                                            &iterations_)
+          : unsplitPreconditionedConjugateGradient(system, x0, parameters_,
+                                                   &iterations_);
+
+  return buildVectorValues(sol, keyInfo);
+}
+
+/*****************************************************************************/
+void PCGSolver::build(const GaussianFactorGraph &gfg, const KeyInfo &keyInfo,
+                      const std::map<Key, Vector> &lambda) {
+  preconditioner_->build(gfg, keyInfo, lambda);
+}
+
+/*****************************************************************************/
+void PCGSolver::updateDamping(const GaussianFactorGraph &gfg,
+                              const KeyInfo &keyInfo,
+                              const std::map<Key, Vector> &lambda) {
+  if (!preconditioner_->updateDamping(keyInfo, lambda))
+    preconditioner_->build(gfg, keyInfo, lambda);
+}
+
+/*****************************************************************************/
+VectorValues PCGSolver::solve(const GaussianFactorGraph &gfg,
+                              const KeyInfo &keyInfo,
+                              const std::map<Key, Vector> &lambda,
+                              const VectorValues &initial,
+                              double epsilon_rel) {
+  GaussianFactorGraphSystem system(gfg, *preconditioner_, keyInfo, lambda,
+                                   parameters_.blas_kernel);
+  const size_t n = keyInfo.numCols();
+
+  /* gamma of the residual b at zero, in the norm used by pcg */
+  Vector b(n), z(n);
+  system.getb(b);
+  double gamma0;
+  if (preconditioner_->isSplit()) {
+    preconditioner_->solve(b, z);
+    gamma0 = z.squaredNorm();
+  } else {
+    preconditioner_->precondition(b, z);
+    gamma0 = b.dot(z);
+  }
+
+  /* x0 = alpha * initial, with alpha = b'x / x'Ax minimizing x'Ax/2 - b'x */
+  Vector x0 = Vector::Zero(n);
+  for (const auto &[key, value] : initial) {
+    const auto it = keyInfo.find(key);
+    if (it != keyInfo.end()) x0.segment(it->second.start, it->second.dim) = value;
+  }
+  if (!x0.isZero()) {
+    Vector Ax(n);
+    system.multiply(x0, Ax);
+    const double xAx = x0.dot(Ax);
+    x0 *= (xAx > 0.0) ? b.dot(x0) / xAx : 0.0;
+  }
+
+  /* stop relative to the residual at zero */
+  ConjugateGradientParameters parameters = parameters_;
+  parameters.epsilon_rel = 0.0;
+  parameters.epsilon_abs =
+      std::max(parameters_.epsilon_abs, epsilon_rel * epsilon_rel * gamma0);
+
+  const Vector sol =
+      preconditioner_->isSplit()
+          ? preconditionedConjugateGradient(system, x0, parameters,
+                                            &iterations_)
+          : unsplitPreconditionedConjugateGradient(system, x0, parameters,
+                                                   &iterations_);
 
   return buildVectorValues(sol, keyInfo);
 }
@@ -68,9 +140,13 @@ VectorValues PCGSolver::optimize(const GaussianFactorGraph &gfg,
 /*****************************************************************************/
 GaussianFactorGraphSystem::GaussianFactorGraphSystem(
     const GaussianFactorGraph &gfg, const Preconditioner &preconditioner,
-    const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda) :
-    gfg_(gfg), preconditioner_(preconditioner), keyInfo_(keyInfo), lambda_(
-        lambda) {
+    const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda,
+    ConjugateGradientParameters::BLASKernel kernel) :
+    gfg_(gfg), preconditioner_(preconditioner), keyInfo_(keyInfo) {
+  if (!lambda.empty())
+    damping_ = keyInfo_.diagonal(lambda);
+  if (kernel == ConjugateGradientParameters::BLOCK_CSR)
+    jacobian_ = std::make_shared<BlockCSRJacobian>(gfg_, keyInfo_);
 }
 
 /*****************************************************************************/
@@ -88,25 +164,37 @@ void GaussianFactorGraphSystem::residual(const Vector &x, Vector &r) const {
 
 /*****************************************************************************/
 void GaussianFactorGraphSystem::multiply(const Vector &x, Vector& AtAx) const {
-  /* implement A^T*(A*x), assume x and AtAx are pre-allocated */
+  /* implement (A^T*A + diag(lambda))*x, assume x and AtAx are pre-allocated */
 
-  // Build a VectorValues for Vector x
-  VectorValues vvX = buildVectorValues(x, keyInfo_);
+  if (jacobian_) {
+    jacobian_->multiplyHessian(x, AtAx);
+  } else {
+    // Build a VectorValues for Vector x
+    VectorValues vvX = buildVectorValues(x, keyInfo_);
 
-  // VectorValues form of A'Ax for multiplyHessianAdd
-  VectorValues vvAtAx = keyInfo_.x0(); // crucial for performance
+    // VectorValues form of A'Ax for multiplyHessianAdd
+    VectorValues vvAtAx = keyInfo_.x0(); // crucial for performance
 
-  // vvAtAx += 1.0 * A'Ax for each factor
-  gfg_.multiplyHessianAdd(1.0, vvX, vvAtAx);
+    // vvAtAx += 1.0 * A'Ax for each factor
+    gfg_.multiplyHessianAdd(1.0, vvX, vvAtAx);
 
-  // Make the result as Vector form
-  AtAx = vvAtAx.vector(keyInfo_.ordering());
+    // Make the result as Vector form
+    AtAx = vvAtAx.vector(keyInfo_.ordering());
+  }
+
+  if (damping_.size() > 0)
+    AtAx += damping_.cwiseProduct(x);
 }
 
 /*****************************************************************************/
 void GaussianFactorGraphSystem::getb(Vector &b) const {
   /* compute rhs, assume b pre-allocated */
 
+  if (jacobian_) {
+    jacobian_->transposeMultiply(jacobian_->b(), b);
+    return;
+  }
+
   // Get whitened r.h.s (A^T * b) from each factor in the form of VectorValues
   VectorValues vvb = gfg_.gradientAtZero();
 
@@ -130,6 +218,13 @@ void GaussianFactorGraphSystem::rightPrecondition(const Vector &x,
   preconditioner_.transposeSolve(x, y);
 }
 
+/**********************************************************************************/
+void GaussianFactorGraphSystem::precondition(const Vector &x,
+    Vector &y) const {
+  // Calculate y = M^{-1} x
+  preconditioner_.precondition(x, y);
+}
+
 /**********************************************************************************/
 void GaussianFactorGraphSystem::scal(const double alpha, Vector &x) const {
   x *= alpha;
@@ -24,6 +24,7 @@
 
 namespace gtsam {
 
+class BlockCSRJacobian;
 class GaussianFactorGraph;
 class KeyInfo;
 class Preconditioner;
@@ -61,6 +62,7 @@ protected:
 
   PCGSolverParameters parameters_;
   std::shared_ptr<Preconditioner> preconditioner_;
+  size_t iterations_ = 0;
 
 public:
   /* Interface to initialize a solver without a problem */
@@ -70,31 +72,70 @@ public:
 
   using IterativeSolver::optimize;
 
+  /**
+   * Solve (A'A + diag(lambda)) x = A'b, with A and b from gfg, from initial.
+   * Note that lambda damps the system that is solved, and not only the
+   * preconditioner: earlier versions passed lambda to the preconditioner and
+   * otherwise ignored it, so the undamped system was solved. Pass an empty
+   * map to solve the undamped system.
+   */
   VectorValues optimize(const GaussianFactorGraph &gfg,
       const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda,
       const VectorValues &initial) override;
 
+  /// Build the preconditioner for the Hessian of gfg + diag(lambda), for solve.
+  void build(const GaussianFactorGraph &gfg, const KeyInfo &keyInfo,
+             const std::map<Key, Vector> &lambda);
+
+  /// Change the damping of the last build, which is only built again if the
+  /// preconditioner cannot update it.
+  void updateDamping(const GaussianFactorGraph &gfg, const KeyInfo &keyInfo,
+                     const std::map<Key, Vector> &lambda);
+
+  /**
+   * Solve with the preconditioner of the last build or updateDamping, e.g.,
+   * for damped systems that differ only in lambda. Unlike optimize, this is
+   * meant for warm starts: the initial estimate is first scaled to minimize
+   * the quadratic along it, so that it is never worse than zero, and the
+   * iterations stop at epsilon_rel relative to the residual at zero, not at
+   * the initial estimate.
+   */
+  VectorValues solve(const GaussianFactorGraph &gfg, const KeyInfo &keyInfo,
+                     const std::map<Key, Vector> &lambda,
+                     const VectorValues &initial, double epsilon_rel);
+
+  /// Number of iterations of the last optimize or solve.
+  size_t iterations() const { return iterations_; }
 };
 
 /**
- * System class needed for calling preconditionedConjugateGradient
+ * System class needed for calling preconditionedConjugateGradient, or
+ * unsplitPreconditionedConjugateGradient for preconditioners that are not split.
+ * The system is (A'A + diag(lambda)) x = A'b, with A and b from gfg.
+ *
+ * With the BLOCK_CSR kernel, the Jacobian is packed into a BlockCSRJacobian
+ * on construction, and products with it are computed in parallel.
  */
 class GTSAM_EXPORT GaussianFactorGraphSystem {
   const GaussianFactorGraph &gfg_;
   const Preconditioner &preconditioner_;
   KeyInfo keyInfo_;
-  std::map<Key, Vector> lambda_;
+  Vector damping_;  ///< diagonal of lambda in the order of keyInfo, or empty
+  std::shared_ptr<BlockCSRJacobian> jacobian_;  ///< only for BLOCK_CSR
 
  public:
   GaussianFactorGraphSystem(const GaussianFactorGraph &gfg,
                             const Preconditioner &preconditioner,
                             const KeyInfo &info,
-                            const std::map<Key, Vector> &lambda);
+                            const std::map<Key, Vector> &lambda,
+                            ConjugateGradientParameters::BLASKernel kernel =
+                                ConjugateGradientParameters::GTSAM);
 
   void residual(const Vector &x, Vector &r) const;
   void multiply(const Vector &x, Vector& y) const;
   void leftPrecondition(const Vector &x, Vector &y) const;
   void rightPrecondition(const Vector &x, Vector &y) const;
+  void precondition(const Vector &x, Vector &y) const;
   void scal(const double alpha, Vector &x) const;
   double dot(const Vector &x, const Vector &y) const;
   void axpy(const double alpha, const Vector &x, Vector &y) const;
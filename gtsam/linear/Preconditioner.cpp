@@ -8,6 +8,8 @@
 
 #include <gtsam/inference/FactorGraph-inst.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/IncompleteCholeskyPreconditioner.h>
+#include <gtsam/linear/MultigridPreconditioner.h>
 #include <gtsam/linear/PCGSolver.h>
 #include <gtsam/linear/Preconditioner.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
@@ -133,24 +135,37 @@ void BlockJacobiPreconditioner::build(
   // dims_ is a vector that contains the dimension of keys
   dims_ = keyInfo.colSpec();
 
-  /* prepare the buffer of block diagonals */
-  std::vector<Matrix> blocks; blocks.reserve(n);
+  /* getting the block diagonals over the factors, in the order of keyInfo */
+  blocks_.assign(n, Matrix());
+  std::map<Key, Matrix> hessianMap =gfg.hessianBlockDiagonal();
+  for (const auto& [key, hessian]: hessianMap) {
+    blocks_[keyInfo.at(key).index] = hessian;
+  }
+
+  factorize(keyInfo.diagonal(lambda));
+}
+
+/*****************************************************************************/
+bool BlockJacobiPreconditioner::updateDamping(
+  const KeyInfo &keyInfo, const std::map<Key,Vector> &lambda)
+{
+  factorize(keyInfo.diagonal(lambda));
+  return true;
+}
+
+/*****************************************************************************/
+void BlockJacobiPreconditioner::factorize(const Vector &damping)
+{
+  const size_t n = dims_.size();
 
   /* allocate memory for the factorization of block diagonals */
   size_t nnz = 0;
   for ( size_t i = 0 ; i < n ; ++i ) {
     const size_t dim = dims_[i];
-    // blocks.push_back(Matrix::Zero(dim, dim));
     // nnz += (((dim)*(dim+1)) >> 1); // d*(d+1) / 2  ;
     nnz += dim*dim;
   }
 
-  /* getting the block diagonals over the factors */
-  std::map<Key, Matrix> hessianMap =gfg.hessianBlockDiagonal();
-  for (const auto& [key, hessian]: hessianMap) {
-    blocks.push_back(hessian);
-  }
-
   /* if necessary, allocating the memory for cacheing the factorization results */
   if ( nnz > bufferSize_ ) {
     clean();
@@ -159,12 +174,16 @@ void BlockJacobiPreconditioner::build(
   }
   nnz_ = nnz;
 
-  /* factorizing the blocks respectively */
+  /* factorizing the damped blocks respectively */
   double *ptr = buffer_;
+  size_t offset = 0;
   for ( size_t i = 0 ; i < n ; ++i ) {
+    Matrix D = blocks_[i];
+    D.diagonal() += damping.segment(offset, dims_[i]);
+
     /* use eigen to decompose Di */
     /* It is same as L = chol(M,'lower') in MATLAB where M is full preconditioner */
-    const Matrix L = blocks[i].llt().matrixL();
+    const Matrix L = D.llt().matrixL();
 
     /* store the data in the buffer */
     size_t sz = dims_[i]*dims_[i] ;
@@ -172,6 +191,7 @@ void BlockJacobiPreconditioner::build(
 
     /* advance the pointer */
     ptr += sz;
+    offset += dims_[i];
   }
 }
 
@@ -198,6 +218,14 @@ std::shared_ptr<Preconditioner> createPreconditioner(
                  dynamic_pointer_cast<SubgraphPreconditionerParameters>(
                      params)) {
     return std::make_shared<SubgraphPreconditioner>(*subgraph);
+  } else if (auto incompleteCholesky = dynamic_pointer_cast<
+                 IncompleteCholeskyPreconditionerParameters>(params)) {
+    return std::make_shared<IncompleteCholeskyPreconditioner>(
+        *incompleteCholesky);
+  } else if (auto multigrid =
+                 dynamic_pointer_cast<MultigridPreconditionerParameters>(
+                     params)) {
+    return std::make_shared<MultigridPreconditioner>(*multigrid);
   }
 
   throw invalid_argument(
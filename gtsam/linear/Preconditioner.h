@@ -83,12 +83,33 @@ public:
   /// implement x = L^{-T} y
   virtual void transposeSolve(const Vector& y, Vector& x) const = 0;
 
-  /// build/factorize the preconditioner
+  /// implement x = M^{-1} y, which is L^{-T} L^{-1} y for split preconditioners
+  virtual void precondition(const Vector& y, Vector& x) const {
+    Vector z(y.size());
+    solve(y, z);
+    x.resize(y.size());
+    transposeSolve(z, x);
+  }
+
+  /// whether M = L L^{T} is split, otherwise only precondition is implemented
+  virtual bool isSplit() const { return true; }
+
+  /// build/factorize the preconditioner, for the Hessian of gfg + diag(lambda)
   virtual void build(
     const GaussianFactorGraph &gfg,
     const KeyInfo &info,
     const std::map<Key,Vector> &lambda
     ) = 0;
+
+  /**
+   * Replace the damping lambda of the last build, reusing everything that does
+   * not depend on it. Returns false if not supported, in which case the
+   * preconditioner has to be built again.
+   */
+  virtual bool updateDamping(const KeyInfo &info,
+                             const std::map<Key, Vector> &lambda) {
+    return false;
+  }
 };
 
 /*******************************************************************************************/
@@ -118,6 +139,10 @@ public:
     const KeyInfo &info,
     const std::map<Key,Vector> &lambda
     ) override {}
+  bool updateDamping(const KeyInfo &info,
+                     const std::map<Key, Vector> &lambda) override {
+    return true;
+  }
 };
 
 /*******************************************************************************************/
@@ -142,12 +167,18 @@ public:
     const KeyInfo &info,
     const std::map<Key,Vector> &lambda
     ) override;
+  bool updateDamping(const KeyInfo &info,
+                     const std::map<Key, Vector> &lambda) override;
 
 protected:
 
   void clean() ;
 
+  /// factorize the undamped blocks plus diag(damping)
+  void factorize(const Vector &damping);
+
   std::vector<size_t> dims_;
+  std::vector<Matrix> blocks_;  ///< undamped block diagonal of the Hessian
   double *buffer_;
   size_t bufferSize_;
   size_t nnz_;
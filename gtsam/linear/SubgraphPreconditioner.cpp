@@ -200,33 +200,11 @@ void SubgraphPreconditioner::print(const std::string& s) const {
 
 /*****************************************************************************/
 void SubgraphPreconditioner::solve(const Vector &y, Vector &x) const {
-  assert(x.size() == y.size());
-
-  /* back substitute */
-  for (auto it = std::make_reverse_iterator(Rc1_.end()); it != std::make_reverse_iterator(Rc1_.begin()); ++it) {
-    auto& cg = *it;
-    /* collect a subvector of x that consists of the parents of cg (S) */
-    const KeyVector parentKeys(cg->beginParents(), cg->endParents());
-    const KeyVector frontalKeys(cg->beginFrontals(), cg->endFrontals());
-    const Vector xParent = getSubvector(x, keyInfo_, parentKeys);
-    const Vector rhsFrontal = getSubvector(y, keyInfo_, frontalKeys);
-
-    /* compute the solution for the current pivot */
-    const Vector solFrontal = cg->R().triangularView<Eigen::Upper>().solve(
-        rhsFrontal - cg->S() * xParent);
-
-    /* assign subvector of sol to the frontal variables */
-    setSubvector(solFrontal, keyInfo_, frontalKeys, x);
-  }
-}
-
-/*****************************************************************************/
-void SubgraphPreconditioner::transposeSolve(const Vector &y, Vector &x) const {
   /* copy first */
   assert(x.size() == y.size());
   std::copy(y.data(), y.data() + y.rows(), x.data());
 
-  /* in place back substitute */
+  /* in place forward substitute with R^T */
   for (const auto &cg : Rc1_) {
     const KeyVector frontalKeys(cg->beginFrontals(), cg->endFrontals());
     const Vector rhsFrontal = getSubvector(x, keyInfo_, frontalKeys);
@@ -250,6 +228,28 @@ void SubgraphPreconditioner::transposeSolve(const Vector &y, Vector &x) const {
   }
 }
 
+/*****************************************************************************/
+void SubgraphPreconditioner::transposeSolve(const Vector &y, Vector &x) const {
+  assert(x.size() == y.size());
+
+  /* back substitute */
+  for (auto it = std::make_reverse_iterator(Rc1_.end()); it != std::make_reverse_iterator(Rc1_.begin()); ++it) {
+    auto& cg = *it;
+    /* collect a subvector of x that consists of the parents of cg (S) */
+    const KeyVector parentKeys(cg->beginParents(), cg->endParents());
+    const KeyVector frontalKeys(cg->beginFrontals(), cg->endFrontals());
+    const Vector xParent = getSubvector(x, keyInfo_, parentKeys);
+    const Vector rhsFrontal = getSubvector(y, keyInfo_, frontalKeys);
+
+    /* compute the solution for the current pivot */
+    const Vector solFrontal = cg->R().triangularView<Eigen::Upper>().solve(
+        rhsFrontal - cg->S() * xParent);
+
+    /* assign subvector of sol to the frontal variables */
+    setSubvector(solFrontal, keyInfo_, frontalKeys, x);
+  }
+}
+
 /*****************************************************************************/
 void SubgraphPreconditioner::build(const GaussianFactorGraph &gfg, const KeyInfo &keyInfo, const std::map<Key,Vector> &lambda)
 {
@@ -260,10 +260,25 @@ void SubgraphPreconditioner::build(const GaussianFactorGraph &gfg, const KeyInfo
   keyInfo_ = keyInfo;
 
   /* build factor subgraph */
-  auto gfg_subgraph = buildFactorSubgraph(gfg, subgraph, true);
+  subgraph_ = buildFactorSubgraph(gfg, subgraph, true);
+
+  updateDamping(keyInfo, lambda);
+}
+
+/*****************************************************************************/
+bool SubgraphPreconditioner::updateDamping(const KeyInfo &keyInfo,
+                                           const std::map<Key, Vector> &lambda) {
+  /* add the damping as priors on the subgraph, sqrt(lambda) x = 0 */
+  GaussianFactorGraph damped = subgraph_;
+  for (const auto &[key, value] : lambda) {
+    if (!keyInfo.count(key) || value.isZero()) continue;
+    damped.emplace_shared<JacobianFactor>(
+        key, Matrix(value.cwiseSqrt().asDiagonal()), Vector::Zero(value.size()));
+  }
 
   /* factorize and cache BayesNet */
-  Rc1_ = *gfg_subgraph.eliminateSequential();
+  Rc1_ = *damped.eliminateSequential();
+  return true;
 }
 
 /*****************************************************************************/
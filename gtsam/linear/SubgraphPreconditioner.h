@@ -59,6 +59,7 @@ namespace gtsam {
   private:
     GaussianFactorGraph Ab2_;
     GaussianBayesNet Rc1_;
+    GaussianFactorGraph subgraph_;  ///< undamped subgraph of the last build
     VectorValues xbar_;  ///< A1 \ b1
     Errors b2bar_; ///< A2*xbar - b2
 
@@ -137,10 +138,10 @@ namespace gtsam {
     /*****************************************************************************/
     /* implement virtual functions of Preconditioner */
 
-    /// implement x = R^{-1} y
+    /// implement x = L^{-1} y = R^{-T} y, as M = R^T R = L L^T
     void solve(const Vector& y, Vector &x) const override;
 
-    /// implement x = R^{-T} y
+    /// implement x = L^{-T} y = R^{-1} y
     void transposeSolve(const Vector& y, Vector& x) const override;
 
     /// build/factorize the preconditioner
@@ -149,6 +150,10 @@ namespace gtsam {
       const KeyInfo &info,
       const std::map<Key,Vector> &lambda
       ) override;
+
+    /// eliminate the subgraph of the last build again, with the new damping
+    bool updateDamping(const KeyInfo &info,
+                       const std::map<Key, Vector> &lambda) override;
     /*****************************************************************************/
   };
 
@@ -730,6 +730,25 @@ virtual class BlockJacobiPreconditionerParameters : gtsam::PreconditionerParamet
   BlockJacobiPreconditionerParameters();
 };
 
+#include <gtsam/linear/IncompleteCholeskyPreconditioner.h>
+virtual class IncompleteCholeskyPreconditionerParameters : gtsam::PreconditionerParameters {
+  IncompleteCholeskyPreconditionerParameters(bool allowFill = false,
+                                             double dropTolerance = 1e-2,
+                                             double initialShift = 1e-3);
+  bool allowFill;
+  double dropTolerance;
+  double initialShift;
+};
+
+#include <gtsam/linear/MultigridPreconditioner.h>
+virtual class MultigridPreconditionerParameters : gtsam::PreconditionerParameters {
+  MultigridPreconditionerParameters();
+  double strengthThreshold;
+  size_t coarsestSize;
+  size_t maxLevels;
+  size_t nrSweeps;
+};
+
 #include <gtsam/linear/PCGSolver.h>
 virtual class PCGSolverParameters : gtsam::ConjugateGradientParameters {
   PCGSolverParameters();
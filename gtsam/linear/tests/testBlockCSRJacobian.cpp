@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testBlockCSRJacobian.cpp
+ * @brief   Unit tests for BlockCSRJacobian
+ * @date    October 2026
+ */
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/linear/BlockCSRJacobian.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Deterministic m*n matrix with non-trivial entries.
+Matrix Block(int m, int n, double seed) {
+  Matrix A(m, n);
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < n; j++) A(i, j) = std::sin(seed + 3 * i + 7 * j);
+  return A;
+}
+
+// Variables 0..3 of dimensions 2, 3, 2, 1, with factors on 1 to 3 variables,
+// diagonal and constrained noise models.
+GaussianFactorGraph createGraph() {
+  GaussianFactorGraph gfg;
+  const auto sigmas3 = noiseModel::Diagonal::Sigmas(Vector3(0.5, 2.0, 1.0));
+  gfg.emplace_shared<JacobianFactor>(0, Block(2, 2, 1), Vector2(1, 2));
+  gfg.emplace_shared<JacobianFactor>(0, Block(3, 2, 2), 1, Block(3, 3, 3),
+                                     Vector3(3, 4, 5), sigmas3);
+  gfg.emplace_shared<JacobianFactor>(1, Block(3, 3, 4), 2, Block(3, 2, 5), 3,
+                                     Block(3, 1, 6), Vector3(6, 7, 8), sigmas3);
+  gfg.emplace_shared<JacobianFactor>(
+      3, Block(2, 1, 7), 0, Block(2, 2, 8), Vector2(9, 10),
+      noiseModel::Constrained::MixedSigmas(Vector2(0.1, 0.0)));
+  gfg.emplace_shared<JacobianFactor>(2, Block(2, 2, 9), Vector2(11, 12));
+  return gfg;
+}
+
+Vector Concatenate(const Errors& errors) {
+  size_t n = 0;
+  for (const Vector& e : errors) n += e.size();
+  Vector result(n);
+  size_t row = 0;
+  for (const Vector& e : errors) {
+    result.segment(row, e.size()) = e;
+    row += e.size();
+  }
+  return result;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BlockCSRJacobian, constructor) {
+  const GaussianFactorGraph gfg = createGraph();
+  const KeyInfo keyInfo(gfg);
+  const BlockCSRJacobian A(gfg, keyInfo);
+  EXPECT_LONGS_EQUAL(12, A.rows());
+  EXPECT_LONGS_EQUAL(8, A.cols());
+  EXPECT_LONGS_EQUAL(5, A.nrBlockRows());
+  EXPECT_LONGS_EQUAL(9, A.nrBlocks());
+
+  // b is whitened
+  Vector expectedb(12);
+  size_t row = 0;
+  for (const auto& factor : gfg) {
+    const Vector b = std::static_pointer_cast<JacobianFactor>(factor)
+                         ->augmentedJacobian()
+                         .rightCols<1>();
+    expectedb.segment(row, b.size()) = b;
+    row += b.size();
+  }
+  EXPECT(assert_equal(expectedb, A.b()));
+}
+
+/* ************************************************************************* */
+TEST(BlockCSRJacobian, products) {
+  const GaussianFactorGraph gfg = createGraph();
+  const KeyInfo keyInfo(gfg);
+  const BlockCSRJacobian A(gfg, keyInfo);
+
+  Vector x(8);
+  x << 1, -2, 3, -4, 5, -6, 7, -8;
+  const VectorValues vvx = buildVectorValues(x, keyInfo);
+
+  // A * x
+  Vector Ax;
+  A.multiply(x, Ax);
+  EXPECT(assert_equal(Concatenate(gfg * vvx), Ax, 1e-9));
+
+  // A' * e
+  Vector e(12);
+  for (int i = 0; i < 12; i++) e(i) = i - 6.0;
+  Errors errors;
+  size_t row = 0;
+  for (const auto& factor : gfg) {
+    const size_t m = std::static_pointer_cast<JacobianFactor>(factor)->rows();
+    errors.push_back(e.segment(row, m));
+    row += m;
+  }
+  VectorValues expectedAte = keyInfo.x0();
+  gfg.transposeMultiplyAdd(1.0, errors, expectedAte);
+  Vector Ate;
+  A.transposeMultiply(e, Ate);
+  EXPECT(assert_equal(expectedAte.vector(keyInfo.ordering()), Ate, 1e-9));
+
+  // A' * A * x
+  VectorValues expectedAtAx = keyInfo.x0();
+  gfg.multiplyHessianAdd(1.0, vvx, expectedAtAx);
+  Vector AtAx;
+  A.multiplyHessian(x, AtAx);
+  EXPECT(assert_equal(expectedAtAx.vector(keyInfo.ordering()), AtAx, 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(BlockCSRJacobian, hessianFactor) {
+  // Replace the last factor by the equivalent HessianFactor
+  const GaussianFactorGraph jacobians = createGraph();
+  GaussianFactorGraph gfg = jacobians;
+  gfg.back() = std::make_shared<HessianFactor>(
+      *std::static_pointer_cast<JacobianFactor>(gfg.back()));
+  const KeyInfo keyInfo(gfg);
+  const BlockCSRJacobian A(gfg, keyInfo);
+
+  Vector x(8);
+  x << 1, -2, 3, -4, 5, -6, 7, -8;
+  VectorValues expected = keyInfo.x0();
+  jacobians.multiplyHessianAdd(1.0, buildVectorValues(x, keyInfo), expected);
+  Vector actual;
+  A.multiplyHessian(x, actual);
+  EXPECT(assert_equal(expected.vector(keyInfo.ordering()), actual, 1e-9));
+
+  // A'b is the negative gradient at zero
+  Vector Atb;
+  A.transposeMultiply(A.b(), Atb);
+  EXPECT(assert_equal(Vector(-jacobians.gradientAtZero().vector(
+                          keyInfo.ordering())),
+                      Atb, 1e-9));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
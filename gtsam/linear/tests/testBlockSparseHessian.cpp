@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testBlockSparseHessian.cpp
+ * @brief   Unit tests for BlockSparseHessian
+ * @date    October 2026
+ */
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/linear/BlockSparseHessian.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/IterativeSolver.h>
+#include <gtsam/linear/JacobianFactor.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Deterministic m*n matrix with non-trivial entries.
+Matrix Block(int m, int n, double seed) {
+  Matrix A(m, n);
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < n; j++) A(i, j) = std::sin(seed + 3 * i + 7 * j);
+  return A;
+}
+
+// Variables 0..3 of dimensions 2, 3, 2, 1, with a HessianFactor on 1 and 2.
+GaussianFactorGraph createGraph() {
+  GaussianFactorGraph gfg;
+  const auto sigmas3 = noiseModel::Diagonal::Sigmas(Vector3(0.5, 2.0, 1.0));
+  gfg.emplace_shared<JacobianFactor>(0, Block(2, 2, 1), Vector2(1, 2));
+  gfg.emplace_shared<JacobianFactor>(0, Block(3, 2, 2), 1, Block(3, 3, 3),
+                                     Vector3(3, 4, 5), sigmas3);
+  gfg.emplace_shared<JacobianFactor>(1, Block(3, 3, 4), 3, Block(3, 1, 6),
+                                     Vector3(6, 7, 8), sigmas3);
+  gfg.emplace_shared<HessianFactor>(JacobianFactor(
+      2, Block(3, 2, 5), 1, Block(3, 3, 7), Vector3(9, 10, 11)));
+  return gfg;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BlockSparseHessian, constructor) {
+  const GaussianFactorGraph gfg = createGraph();
+  const KeyInfo keyInfo(gfg);
+  const BlockSparseHessian A(gfg, keyInfo);
+  EXPECT_LONGS_EQUAL(4, A.size());
+  EXPECT_LONGS_EQUAL(8, A.cols());
+  // 4 diagonal blocks and both triangles of 0-1, 1-2 and 1-3
+  EXPECT_LONGS_EQUAL(10, A.nrBlocks());
+  EXPECT_LONGS_EQUAL(0, A.column(A.diagonal(0)));
+  EXPECT_LONGS_EQUAL(3, A.column(A.diagonal(3)));
+
+  const Matrix expected = gfg.hessian(keyInfo.ordering()).first;
+  EXPECT(assert_equal(expected, A.dense(), 1e-9));
+
+  // Round trip through rows
+  const BlockSparseHessian B(A.dims(), A.rows());
+  EXPECT(assert_equal(expected, B.dense(), 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(BlockSparseHessian, multiply) {
+  const GaussianFactorGraph gfg = createGraph();
+  const KeyInfo keyInfo(gfg);
+  const BlockSparseHessian A(gfg, keyInfo);
+
+  Vector x(8);
+  x << 1, -2, 3, -4, 5, -6, 7, -8;
+  Vector y;
+  A.multiply(x, y);
+  EXPECT(assert_equal(Vector(A.dense() * x), y, 1e-9));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
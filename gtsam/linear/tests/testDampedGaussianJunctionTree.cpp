@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testDampedGaussianJunctionTree.cpp
+ * @brief   Unit tests for DampedGaussianJunctionTree
+ * @date    October 2026
+ */
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/inference/Ordering.h>
+#include <gtsam/linear/DampedGaussianJunctionTree.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/HessianFactor.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Deterministic m*n matrix with non-trivial entries.
+Matrix Block(int m, int n, double seed) {
+  Matrix A(m, n);
+  for (int i = 0; i < m; i++)
+    for (int j = 0; j < n; j++)
+      A(i, j) = std::sin(seed + 3 * i + 7 * j + i * j);
+  return A;
+}
+
+// Variables 0..4 of dimensions 2, 3, 2, 1, 2, with a loop 1-2-4 and a
+// HessianFactor on 1 and 2.
+GaussianFactorGraph createGraph() {
+  GaussianFactorGraph gfg;
+  const auto sigmas3 = noiseModel::Diagonal::Sigmas(Vector3(0.5, 2.0, 1.0));
+  gfg.emplace_shared<JacobianFactor>(0, Block(2, 2, 1), Vector2(1, 2));
+  gfg.emplace_shared<JacobianFactor>(0, Block(3, 2, 2), 1, Block(3, 3, 3),
+                                     Vector3(3, 4, 5), sigmas3);
+  gfg.emplace_shared<JacobianFactor>(1, Block(3, 3, 4), 3, Block(3, 1, 6),
+                                     Vector3(6, 7, 8), sigmas3);
+  gfg.emplace_shared<HessianFactor>(JacobianFactor(
+      2, Block(3, 2, 5), 1, Block(3, 3, 7), Vector3(9, 10, 11)));
+  gfg.emplace_shared<JacobianFactor>(2, Block(2, 2, 8), 4, Block(2, 2, 9),
+                                     Vector2(12, 13));
+  gfg.emplace_shared<JacobianFactor>(4, Block(2, 2, 10), 1, Block(2, 3, 11),
+                                     Vector2(14, 15));
+  return gfg;
+}
+
+// The graph with priors sqrt(lambda) x = 0, as built by LM.
+GaussianFactorGraph damped(GaussianFactorGraph gfg,
+                           const std::map<Key, Vector>& lambda) {
+  for (const auto& [key, value] : lambda)
+    gfg.emplace_shared<JacobianFactor>(
+        key, Matrix(value.cwiseSqrt().asDiagonal()), Vector::Zero(value.size()));
+  return gfg;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(DampedGaussianJunctionTree, eliminate) {
+  const GaussianFactorGraph gfg = createGraph();
+  const Ordering ordering{0, 3, 2, 4, 1};
+  const DampedGaussianJunctionTree tree(gfg, ordering);
+
+  // Undamped
+  EXPECT(assert_equal(gfg.optimize(ordering),
+                      tree.eliminate(std::map<Key, Vector>())->optimize(),
+                      1e-9));
+
+  // The cached Hessians are not modified by elimination, so the same tree
+  // can be eliminated for several lambdas. Variable 3 is not damped.
+  for (const double scale : {0.1, 10.0, 1e3}) {
+    std::map<Key, Vector> lambda;
+    lambda.emplace(0, scale * Vector2(1, 2));
+    lambda.emplace(1, scale * Vector3(3, 1, 2));
+    lambda.emplace(2, scale * Vector2::Ones());
+    lambda.emplace(4, scale * Vector2(0.5, 4));
+    EXPECT(assert_equal(damped(gfg, lambda).optimize(ordering),
+                        tree.eliminate(lambda)->optimize(), 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
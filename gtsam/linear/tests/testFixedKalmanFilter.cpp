@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testFixedKalmanFilter.cpp
+ * @brief Test the fixed-size Kalman filter against KalmanFilter
+ * @date October 2026
+ */
+
+#include <gtsam/linear/FixedKalmanFilter.h>
+#include <gtsam/linear/KalmanFilter.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/base/Testable.h>
+#include <gtsam/base/VectorSpace.h>
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Constant velocity model of a 2D point, with state (x, y, vx, vy), a
+// acceleration control and position measurements.
+const double dt = 0.1;
+const Matrix4 F = (Matrix4() << 1, 0, dt, 0,  //
+                   0, 1, 0, dt,               //
+                   0, 0, 1, 0,                //
+                   0, 0, 0, 1).finished();
+const Eigen::Matrix<double, 4, 2> B =
+    (Eigen::Matrix<double, 4, 2>() << 0.5 * dt * dt, 0, 0, 0.5 * dt * dt, dt,
+     0, 0, dt)
+        .finished();
+const Eigen::Matrix<double, 2, 4> H =
+    (Eigen::Matrix<double, 2, 4>() << 1, 0, 0, 0, 0, 1, 0, 0).finished();
+const Vector4 sigmasQ(0.01, 0.02, 0.1, 0.2);
+const Vector2 sigmasR(0.3, 0.2);
+const Matrix4 Q = (Matrix4() << 2e-4, 1e-5, 2e-5, 0,  //
+                   1e-5, 3e-4, 0, 1e-5,               //
+                   2e-5, 0, 1e-2, 1e-3,               //
+                   0, 1e-5, 1e-3, 4e-2).finished();
+const Matrix2 R = (Matrix2() << 0.09, 0.01, 0.01, 0.04).finished();
+
+Vector2 Control(size_t k) { return Vector2(std::sin(0.3 * k), 0.5); }
+Vector2 Measurement(size_t k) { return Vector2(0.1 * k, 0.02 * k * k); }
+
+// Run both filters, and compare their states at each step.
+bool CompareFilters(KalmanFilter::Factorization method) {
+  KalmanFilter kf(4, method);
+  FixedKalmanFilter<4> fkf(method);
+
+  const Vector4 x0(1, 2, 0.5, -0.5);
+  const Matrix4 P0 = Q * 10;
+  KalmanFilter::State p = kf.init(x0, P0);
+  FixedKalmanFilter<4>::State s = fkf.init(x0, P0);
+
+  for (size_t k = 0; k < 10; k++) {
+    // Alternate diagonal and full noise models
+    const Vector2 u = Control(k), z = Measurement(k + 1);
+    if (k % 2 == 0) {
+      p = kf.predict(p, F, B, u, noiseModel::Diagonal::Sigmas(sigmasQ));
+      s = fkf.predict(s, F, B, u, sigmasQ);
+      p = kf.update(p, H, z, noiseModel::Diagonal::Sigmas(sigmasR));
+      s = fkf.update(s, H, z, sigmasR);
+    } else {
+      p = kf.predictQ(p, F, B, u, Q);
+      s = fkf.predictQ(s, F, B, u, Q);
+      p = kf.updateQ(p, H, z, R);
+      s = fkf.updateQ(s, H, z, R);
+    }
+    if (KalmanFilter::step(p) != FixedKalmanFilter<4>::step(s)) return false;
+    if (!assert_equal(p->mean(), Vector(fkf.mean(s)), 1e-9)) return false;
+    if (!assert_equal(p->information(), Matrix(fkf.information(s)), 1e-6))
+      return false;
+    if (!assert_equal(p->covariance(), Matrix(fkf.covariance(s)), 1e-9))
+      return false;
+  }
+  return true;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST( FixedKalmanFilter, linear1 ) {
+  // Same example as KalmanFilter.linear1
+  const Matrix2 F = I_2x2, B = I_2x2, H = I_2x2;
+  const Vector2 u(1.0, 0.0), sigmas(0.1, 0.1);
+  const Matrix2 Q = 0.01 * I_2x2, R = 0.01 * I_2x2;
+
+  const Matrix2 P00 = 0.01 * I_2x2;
+  const Matrix2 P01 = P00 + Q;
+  const Matrix2 I11 = P01.inverse() + R.inverse();
+
+  for (auto method : {KalmanFilter::QR, KalmanFilter::CHOLESKY}) {
+    FixedKalmanFilter<2> kf(method);
+    const auto p0 = kf.init(Vector2::Zero(), sigmas);
+    EXPECT(assert_equal(Vector2(0.0, 0.0), kf.mean(p0)));
+    EXPECT(assert_equal(P00, kf.covariance(p0)));
+
+    const auto p1p = kf.predict(p0, F, B, u, sigmas);
+    EXPECT(assert_equal(Vector2(1.0, 0.0), kf.mean(p1p)));
+    EXPECT(assert_equal(P01, kf.covariance(p1p)));
+
+    const auto p1 = kf.update(p1p, H, Vector2(1.0, 0.0), sigmas);
+    EXPECT(assert_equal(Vector2(1.0, 0.0), kf.mean(p1)));
+    EXPECT(assert_equal(I11, kf.information(p1)));
+
+    const auto p2p = kf.predictQ(p1, F, B, u, Q);
+    EXPECT(assert_equal(Vector2(2.0, 0.0), kf.mean(p2p)));
+
+    const auto p2 = kf.updateQ(p2p, H, Vector2(2.0, 0.0), R);
+    EXPECT(assert_equal(Vector2(2.0, 0.0), kf.mean(p2)));
+    LONGS_EQUAL(2, (long)FixedKalmanFilter<2>::step(p2));
+  }
+}
+
+/* ************************************************************************* */
+TEST( FixedKalmanFilter, QR ) {
+  EXPECT(CompareFilters(KalmanFilter::QR));
+}
+
+/* ************************************************************************* */
+TEST( FixedKalmanFilter, CHOLESKY ) {
+  EXPECT(CompareFilters(KalmanFilter::CHOLESKY));
+}
+
+/* ************************************************************************* */
+TEST( FixedKalmanFilter, recenter ) {
+  for (auto method : {KalmanFilter::QR, KalmanFilter::CHOLESKY}) {
+    FixedKalmanFilter<4> kf(method);
+    const Vector4 x0(1, 2, 3, 4), delta(0.1, -0.2, 0.3, -0.4);
+    const auto p = kf.recenter(kf.init(x0, Q), delta);
+    EXPECT(assert_equal(Vector4(x0 - delta), kf.mean(p), 1e-9));
+    EXPECT(assert_equal(Q, kf.covariance(p), 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -208,6 +208,44 @@ TEST(GaussianBayesNet, MonteCarloIntegration) {
   EXPECT_DOUBLES_EQUAL(9.0, sum / N, 0.5); // Pretty high.
 }
 
+/* ************************************************************************* */
+// Check batch samples against the analytic mean and covariance.
+TEST(GaussianBayesNet, sampleBatch) {
+  // y ~ N(5, 3^2), x = 9 - y + 2*e, so x ~ N(4, 13) and cov(x,y) = -9.
+  constexpr size_t N = 20000;
+  const Matrix samples = noisyBayesNet.sampleBatch(N, 7);
+  EXPECT_LONGS_EQUAL(N, samples.rows());
+  EXPECT_LONGS_EQUAL(2, samples.cols());  // columns follow ordering(): x, y
+
+  const Vector mean = samples.colwise().mean();
+  EXPECT(assert_equal(Vector2(4.0, 5.0), mean, 0.1));
+  const Matrix centered = samples.rowwise() - mean.transpose();
+  const Matrix covariance = centered.transpose() * centered / (N - 1);
+  const Matrix expected = (Matrix2() << 13.0, -9.0, -9.0, 9.0).finished();
+  EXPECT(assert_equal(expected, covariance, 0.5));
+
+  // Same seed gives the same samples, another seed does not.
+  EXPECT(assert_equal(samples, noisyBayesNet.sampleBatch(N, 7)));
+  EXPECT(!samples.isApprox(noisyBayesNet.sampleBatch(N, 8)));
+}
+
+/* ************************************************************************* */
+TEST(GaussianBayesNet, sampleBatchGiven) {
+  GaussianBayesNet gbn;
+  gbn.push_back(noisyBayesNet.at(0));  // only x|y, y is given
+
+  VectorValues given;
+  given.insert(_y_, Vector1(1.0));
+  constexpr size_t N = 20000;
+  const Matrix samples = gbn.sampleBatch(given, N);
+  EXPECT_LONGS_EQUAL(1, samples.cols());
+  EXPECT_DOUBLES_EQUAL(8.0, samples.col(0).mean(), 0.1);
+  EXPECT_DOUBLES_EQUAL(4.0, (samples.array() - 8.0).square().mean(), 0.2);
+
+  // Missing parent should throw.
+  THROWS_EXCEPTION(gbn.sampleBatch(N));
+}
+
 /* ************************************************************************* */
 TEST(GaussianBayesNet, ordering)
 {
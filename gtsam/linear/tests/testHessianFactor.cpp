@@ -22,12 +22,17 @@
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/TestableAssertions.h>
+#include <gtsam/config.h>
 
 #include <CppUnitLite/TestHarness.h>
 
 #include <vector>
 #include <utility>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/task_arena.h>
+#endif
+
 using namespace std;
 using namespace gtsam;
 
@@ -476,6 +481,39 @@ TEST(HessianFactor, combine) {
 
 }
 
+/* ************************************************************************* */
+TEST(HessianFactor, combineMany) {
+  // Enough factors to be accumulated in parallel by 4 threads
+  GaussianFactorGraph factors;
+  const SharedDiagonal model = noiseModel::Diagonal::Sigmas(Vector3(0.5, 1, 2));
+  for (size_t i = 0; i < 1000; ++i) {
+    Matrix A1(3, 2), A2(3, 3);
+    for (int r = 0; r < 3; ++r)
+      for (int c = 0; c < 3; ++c) {
+        if (c < 2) A1(r, c) = sin(i + 3.0 * r + 7.0 * c);
+        A2(r, c) = cos(2.0 * i + 5.0 * r + c * r);
+      }
+    factors.emplace_shared<JacobianFactor>(i % 10, A1, 10 + i % 7, A2,
+                                           Vector3(1, i % 3, -2.0), model);
+  }
+  const Ordering ordering = Ordering::Natural(factors);
+  const Matrix Ab = factors.augmentedJacobian(ordering);
+  const Matrix expected = Ab.transpose() * Ab;
+
+  const Scatter scatter(factors, ordering);
+  auto combine = [&]() {
+    const HessianFactor actual(factors, scatter);
+    EXPECT(assert_equal(expected, Matrix(actual.info().selfadjointView()),
+                        1e-9));
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::task_arena arena(4);
+  arena.execute(combine);
+#else
+  combine();
+#endif
+}
+
 /* ************************************************************************* */
 TEST(HessianFactor, gradientAtZero)
 {
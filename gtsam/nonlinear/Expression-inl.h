@@ -20,6 +20,7 @@
 #pragma once
 
 #include <gtsam/nonlinear/internal/ExpressionNode.h>
+#include <gtsam/nonlinear/internal/TraceArena.h>
 
 #include <map>
 #include <memory>
@@ -172,10 +173,10 @@ T Expression<T>::valueAndDerivatives(const Values& values,
   // H should be pre-allocated
   assert(H.size()==keys.size());
 
-  // Pre-allocate and zero VerticalBlockMatrix
+  // Zeroed VerticalBlockMatrix, re-used across calls with the same dims
   static const int Dim = traits<T>::dimension;
-  VerticalBlockMatrix Ab(dims, Dim);
-  Ab.matrix().setZero();
+  internal::JacobianBuffer buffer(dims, Dim);
+  VerticalBlockMatrix& Ab = buffer.matrix();
   internal::JacobianMap jacobianMap(keys, Ab);
 
   // Call unsafe version
@@ -205,15 +206,15 @@ template<typename T>
 T Expression<T>::valueAndJacobianMap(const Values& values,
     internal::JacobianMap& jacobians) const {
   try {
-    // We allocate a single block of aligned memory using a unique_ptr.
-    const size_t size = traceSize();
-    auto traceStorage = allocAligned(size);
+    // We borrow a single block of aligned memory from a per-thread arena,
+    // which is only (re-)allocated when it is too small for this trace.
+    internal::TraceBuffer traceStorage(traceSize());
 
     // The traceExecution call then fills this memory
     // with an execution trace, made up entirely of "Record" structs, see
     // the FunctionalNode class in expression-inl.h
     internal::ExecutionTrace<T> trace;
-    T value(this->traceExecution(values, trace, reinterpret_cast<char *>(traceStorage.get())));
+    T value(this->traceExecution(values, trace, traceStorage.data()));
 
     // We then calculate the Jacobians using reverse automatic differentiation (AD).
     trace.startReverseAD1(jacobians);
@@ -222,7 +223,7 @@ T Expression<T>::valueAndJacobianMap(const Values& values,
     std::cerr << "valueAndJacobianMap exception: " << e.what() << '\n';
     throw e;
   }
-  // Here traceStorage will be de-allocated properly.
+  // Here traceStorage is given back to the arena.
 }
 
 template<typename T>
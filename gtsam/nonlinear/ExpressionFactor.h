@@ -145,7 +145,9 @@ protected:
 
     // Whiten the corresponding system, Ab already contains RHS
     if (noiseModel_) {
-      Vector b = Ab(size()).col(0);  // need b to be valid for Robust noise models
+      // need b to be valid for Robust noise models, kept to avoid allocation
+      static thread_local Vector b;
+      b = Ab(size()).col(0);
       noiseModel_->WhitenSystem(Ab.matrix(), b);
     }
 
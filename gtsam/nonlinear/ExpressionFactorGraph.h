@@ -19,6 +19,7 @@
 #pragma once
 
 #include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/FusedExpressionFactor.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 
 namespace gtsam {
@@ -46,6 +47,19 @@ public:
     push_back(std::allocate_shared<F>(Eigen::aligned_allocator<F>(), R, z, h));
   }
 
+  /**
+   * Directly add FusedExpressionFactor that implements |h(x)-z|^2_R
+   * @param h fused expression that implements measurement function
+   * @param z measurement
+   * @param R model
+   */
+  template <class E, typename = std::enable_if_t<fused::IsExpression<E>>>
+  void addExpressionFactor(const E& h, const typename E::Type& z,
+                           const SharedNoiseModel& R) {
+    using F = FusedExpressionFactor<E>;
+    push_back(std::allocate_shared<F>(Eigen::aligned_allocator<F>(), R, z, h));
+  }
+
   /// @}
 };
 
@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file FixedExtendedKalmanFilter.h
+ * @brief Extended Kalman filter for a state of fixed dimension, using
+ * FixedKalmanFilter on the tangent space of the estimate.
+ * @date October 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/OptionalJacobian.h>
+#include <gtsam/linear/FixedKalmanFilter.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/nonlinear/NonlinearFactor.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <stdexcept>
+
+namespace gtsam {
+
+/**
+ * Extended Kalman filter as ExtendedKalmanFilter, for a VALUE type of fixed
+ * dimension N. The density is kept as a FixedKalmanFilter<N> state on the
+ * tangent space at the current estimate x_, so that predict and update do not
+ * build and eliminate a GaussianFactorGraph.
+ *
+ * Motion and measurement models can be given as NoiseModelFactors, exactly as
+ * for ExtendedKalmanFilter, in which case only their linearization allocates.
+ * For an allocation-free filter, give them as functions with fixed-size
+ * Jacobians instead, as used with Expression<T>:
+ * - motion model: T f(const T& x, OptionalJacobian<N, N> H)
+ * - measurement model: Z h(const T& x, OptionalJacobian<M, N> H)
+ */
+template <class VALUE>
+class FixedExtendedKalmanFilter {
+  GTSAM_CONCEPT_ASSERT(IsTestable<VALUE>);
+  GTSAM_CONCEPT_ASSERT(IsManifold<VALUE>);
+
+ public:
+  using T = VALUE;
+  static constexpr int N = traits<T>::dimension;
+  static_assert(N != Eigen::Dynamic,
+                "FixedExtendedKalmanFilter: VALUE needs a fixed dimension");
+
+  using Filter = FixedKalmanFilter<N>;
+  using State = typename Filter::State;
+  using VectorN = typename Filter::VectorN;
+  using MatrixN = typename Filter::MatrixN;
+
+ protected:
+  Filter filter_;
+  T x_;            ///< linearization point, which is also the mean
+  State density_;  ///< zero-mean density on the tangent space at x_
+
+  /// Move x_ to the mean of the density, which is re-centered on it.
+  const T& recenter() {
+    const VectorN delta = filter_.mean(density_);
+    x_ = traits<T>::Retract(x_, delta);
+    density_ = filter_.recenter(density_, delta);
+    return x_;
+  }
+
+  static JacobianFactor::shared_ptr Linearize(const NoiseModelFactor& factor,
+                                              const Values& values) {
+    auto jacobian =
+        std::dynamic_pointer_cast<JacobianFactor>(factor.linearize(values));
+    if (!jacobian || jacobian->get_model())
+      throw std::invalid_argument(
+          "FixedExtendedKalmanFilter: factors cannot have a constrained noise "
+          "model");
+    return jacobian;
+  }
+
+ public:
+  /// @name Standard Constructors
+  /// @{
+
+  /**
+   * Constructor from an initial estimate and its covariance.
+   * @param x_initial Initial estimate.
+   * @param P_initial Covariance of x_initial.
+   * @param method Factorization method (default: QR unless compile-flag set).
+   */
+  FixedExtendedKalmanFilter(
+      const T& x_initial, const MatrixN& P_initial,
+      typename Filter::Factorization method =
+          KalmanFilter::KALMANFILTER_DEFAULT_FACTORIZATION)
+      : filter_(method),
+        x_(x_initial),
+        density_(filter_.init(VectorN::Zero(), P_initial)) {}
+
+  /// Constructor with the initial covariance given as a Gaussian noise model.
+  FixedExtendedKalmanFilter(
+      const T& x_initial, const noiseModel::Gaussian::shared_ptr& P_initial,
+      typename Filter::Factorization method =
+          KalmanFilter::KALMANFILTER_DEFAULT_FACTORIZATION)
+      : filter_(method), x_(x_initial) {
+    // The prior |R*dx|^2, triangularized by the filter
+    const MatrixN R = P_initial->R();
+    density_ = filter_.update2(State{MatrixN::Zero(), VectorN::Zero(), 0}, R,
+                               VectorN::Zero());
+  }
+
+  /// @}
+  /// @name Testable
+  /// @{
+
+  /// print
+  void print(const std::string& s = "") const {
+    std::cout << s << "\n";
+    traits<T>::Print(x_, s + "x");
+    std::cout << s << "covariance:\n" << covariance() << std::endl;
+  }
+
+  /// @}
+  /// @name Interface
+  /// @{
+
+  /// Current estimate.
+  const T& estimate() const { return x_; }
+
+  /// Density on the tangent space at estimate(), of zero mean.
+  const State& density() const { return density_; }
+
+  /// Covariance of the estimate, in the tangent space.
+  MatrixN covariance() const { return filter_.covariance(density_); }
+
+  /**
+   * Predict with the motion model x_{k+1} = f(x_k) + w, where w is zero-mean
+   * Gaussian noise on the tangent space at f(x_k), with covariance Q.
+   */
+  template <class MOTION>
+  const T& predict(const MOTION& f, const MatrixN& Q) {
+    MatrixN F;
+    x_ = f(x_, F);
+    // Whitened factor |F*dx_k - dx_{k+1}|^2 on the tangent spaces, with
+    // Q = L*L'. The predicted density stays zero-mean at f(x_k).
+    const Eigen::LLT<MatrixN> llt(Q);
+    const MatrixN Linv = llt.matrixL().solve(MatrixN::Identity());
+    density_ = filter_.predict2(density_, -(Linv * F), Linv, VectorN::Zero());
+    return x_;
+  }
+
+  /**
+   * Update with the measurement z = h(x_k) + v, where v is zero-mean Gaussian
+   * noise with covariance R. The error is Local(h(x_k), z), as in
+   * ExpressionFactor.
+   */
+  template <class MEASUREMENT, typename Z, int M = traits<Z>::dimension>
+  const T& update(const MEASUREMENT& h, const Z& z,
+                  const Eigen::Matrix<double, M, M>& R) {
+    Eigen::Matrix<double, M, N> H;
+    const Z predicted = h(x_, H);
+    const Eigen::Matrix<double, M, 1> error =
+        traits<Z>::Local(predicted, z);
+    density_ = filter_.updateQ(density_, H, error, R);
+    return recenter();
+  }
+
+  /**
+   * Calculate the predictive density as ExtendedKalmanFilter::predict. The
+   * motion model is a factor with key1 for x_{k} and key2 for x_{k+1}, which
+   * are both linearized at the current estimate.
+   */
+  const T& predict(const NoiseModelFactor& motionFactor) {
+    const auto& keys = motionFactor.keys();
+    Values linearizationPoint;
+    linearizationPoint.insert(keys[0], x_);
+    linearizationPoint.insert(keys[1], x_);
+    const auto jacobian = Linearize(motionFactor, linearizationPoint);
+    if (jacobian->rows() != N)
+      throw std::invalid_argument(
+          "FixedExtendedKalmanFilter::predict: motion factor of wrong "
+          "dimension");
+    density_ =
+        filter_.predict2(density_, jacobian->getA(jacobian->begin()),
+                         jacobian->getA(jacobian->begin() + 1),
+                         jacobian->getb());
+    return recenter();
+  }
+
+  /**
+   * Calculate the posterior density as ExtendedKalmanFilter::update, with the
+   * likelihood given as a unary factor on x_k.
+   */
+  const T& update(const NoiseModelFactor& measurementFactor) {
+    Values linearizationPoint;
+    linearizationPoint.insert(measurementFactor.keys()[0], x_);
+    const auto jacobian = Linearize(measurementFactor, linearizationPoint);
+    density_ = filter_.update2(density_, jacobian->getA(jacobian->begin()),
+                               jacobian->getb());
+    return recenter();
+  }
+
+  /// @}
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}  // namespace gtsam
@@ -0,0 +1,356 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file FusedExpression.h
+ * @date October 2026
+ * @brief Expressions whose tree is a compile-time type, for small factors
+ */
+
+#pragma once
+
+#include <gtsam/base/FastVector.h>
+#include <gtsam/base/Lie.h>
+#include <gtsam/base/OptionalJacobian.h>
+#include <gtsam/nonlinear/Expression.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Fused expressions mirror Expression<T>, but the expression tree is encoded in
+ * the type, e.g., fused::Function<Point2, F, fused::Leaf<Pose3>,
+ * fused::Leaf<Point3>>, and the whole tree is a single object. Evaluating one
+ * is a chain of inlined calls: the forward pass stores the Jacobians of every
+ * node in a stack-allocated Record whose layout mirrors the tree, and the
+ * reverse pass multiplies fixed-size matrices down to the leaves, which add
+ * their block into the Jacobian. There are no virtual calls, trace storage or
+ * JacobianMap lookups, so small factors are as fast as handwritten ones.
+ *
+ * All types must have a fixed dimension. Use with FusedExpressionFactor, or
+ * ExpressionFactorGraph::addExpressionFactor, and use fused::wrap to embed an
+ * existing Expression<T> as a sub-tree.
+ *
+ * Every fused expression E provides:
+ *  - Type, Dim, kConstant, and a default-constructible Record type
+ *  - dims(map): add keys and dimensions of the leaves
+ *  - bind(columns): look up the Jacobian column of each leaf
+ *  - forward(values, record): the value, and the Jacobians if record != null
+ *  - reverse(record, dFdT, A): add dF/dT * dT/dx into the columns of A
+ *  - reverseRoot(record, A): same, with dF/dT the identity
+ */
+namespace fused {
+
+/// Base class of all fused expressions, used to recognize them.
+struct ExpressionBase {};
+
+/// True if E is a fused expression.
+template <class E>
+inline constexpr bool IsExpression = std::is_base_of_v<ExpressionBase, E>;
+
+/// Jacobian column of every key of a factor, used to bind leaves.
+struct Columns {
+  KeyVector keys;
+  FastVector<DenseIndex> offsets;
+
+  /// Column of key, which has to be one of keys.
+  DenseIndex operator()(Key key) const {
+    const auto it = std::find(keys.begin(), keys.end(), key);
+    assert(it != keys.end());
+    return offsets[it - keys.begin()];
+  }
+};
+
+/// Leaf expression, the value of a variable.
+template <typename T>
+class Leaf : public ExpressionBase {
+ public:
+  using Type = T;
+  static constexpr int Dim = traits<T>::dimension;
+  static constexpr bool kConstant = false;
+  static_assert(Dim != Eigen::Dynamic, "fused::Leaf: T needs a fixed dimension");
+  struct Record {};
+
+  explicit Leaf(Key key) : key_(key) {}
+
+  Key key() const { return key_; }
+
+  void dims(std::map<Key, int>& map) const { map[key_] = Dim; }
+
+  void bind(const Columns& columns) { column_ = columns(key_); }
+
+  T forward(const Values& values, Record*) const { return values.at<T>(key_); }
+
+  template <class D>
+  void reverse(const Record&, const Eigen::MatrixBase<D>& dFdT,
+               Matrix& A) const {
+    A.template block<D::RowsAtCompileTime, Dim>(0, column_) += dFdT;
+  }
+
+  void reverseRoot(const Record& record, Matrix& A) const {
+    reverse(record, Eigen::Matrix<double, Dim, Dim>::Identity(), A);
+  }
+
+ private:
+  Key key_;
+  DenseIndex column_ = 0;
+};
+
+/// Constant expression, has no Jacobian.
+template <typename T>
+class Constant : public ExpressionBase {
+ public:
+  using Type = T;
+  static constexpr int Dim = traits<T>::dimension;
+  static constexpr bool kConstant = true;
+  struct Record {};
+
+  explicit Constant(const T& value) : value_(value) {}
+
+  void dims(std::map<Key, int>&) const {}
+  void bind(const Columns&) {}
+  T forward(const Values&, Record*) const { return value_; }
+  template <class D>
+  void reverse(const Record&, const Eigen::MatrixBase<D>&, Matrix&) const {}
+  void reverseRoot(const Record&, Matrix&) const {}
+
+ private:
+  T value_;
+};
+
+/**
+ * Function of N fused expressions. F is called as
+ * f(a1, ..., aN, OptionalJacobian<Dim, A1::Dim> H1, ..., HN), as the functions
+ * used with Expression<T>. Jacobians are not requested for constant arguments.
+ * Use a function object or lambda rather than a function pointer for F, so
+ * that the call can be inlined.
+ */
+template <typename T, class F, class... Args>
+class Function : public ExpressionBase {
+  static_assert((IsExpression<Args> && ...),
+                "fused::Function: arguments must be fused expressions");
+
+  template <size_t I>
+  using Arg = std::tuple_element_t<I, std::tuple<Args...>>;
+
+ public:
+  using Type = T;
+  static constexpr int Dim = traits<T>::dimension;
+  static constexpr bool kConstant = (Args::kConstant && ...);
+  static_assert(Dim != Eigen::Dynamic,
+                "fused::Function: T needs a fixed dimension");
+
+  /// Records of the arguments, and the Jacobians with respect to them.
+  struct Record {
+    std::tuple<typename Args::Record...> args;
+    std::tuple<Eigen::Matrix<double, Dim, Args::Dim>...> H;
+  };
+
+  Function(const F& f, const Args&... args) : f_(f), args_(args...) {}
+
+  void dims(std::map<Key, int>& map) const {
+    std::apply([&](const auto&... a) { (a.dims(map), ...); }, args_);
+  }
+
+  void bind(const Columns& columns) {
+    std::apply([&](auto&... a) { (a.bind(columns), ...); }, args_);
+  }
+
+  T forward(const Values& values, Record* record) const {
+    return forward(values, record, std::index_sequence_for<Args...>());
+  }
+
+  template <class D>
+  void reverse(const Record& record, const Eigen::MatrixBase<D>& dFdT,
+               Matrix& A) const {
+    // Evaluate once, dFdT might be a product shared by all arguments
+    const Eigen::Matrix<double, D::RowsAtCompileTime, Dim> G = dFdT;
+    reverse(record, G, A, std::index_sequence_for<Args...>());
+  }
+
+  void reverseRoot(const Record& record, Matrix& A) const {
+    reverseRoot(record, A, std::index_sequence_for<Args...>());
+  }
+
+ private:
+  F f_;
+  std::tuple<Args...> args_;
+
+  template <size_t I>
+  OptionalJacobian<Dim, Arg<I>::Dim> jacobian(Record* record) const {
+    if constexpr (Arg<I>::kConstant) {
+      return {};
+    } else {
+      return std::get<I>(record->H);
+    }
+  }
+
+  template <size_t... I>
+  T forward(const Values& values, Record* record,
+            std::index_sequence<I...>) const {
+    // Braced initialization evaluates the arguments from left to right
+    const std::tuple<typename Args::Type...> a{std::get<I>(args_).forward(
+        values, record ? &std::get<I>(record->args) : nullptr)...};
+    if (record) return f_(std::get<I>(a)..., jacobian<I>(record)...);
+    return f_(std::get<I>(a)..., OptionalJacobian<Dim, Args::Dim>()...);
+  }
+
+  template <size_t I, class D>
+  void reverseArgument(const Record& record, const Eigen::MatrixBase<D>& dFdA,
+                       Matrix& A) const {
+    if constexpr (!Arg<I>::kConstant)
+      std::get<I>(args_).reverse(std::get<I>(record.args), dFdA, A);
+  }
+
+  template <class G, size_t... I>
+  void reverse(const Record& record, const G& dFdT, Matrix& A,
+               std::index_sequence<I...>) const {
+    (reverseArgument<I>(record, dFdT * std::get<I>(record.H), A), ...);
+  }
+
+  template <size_t... I>
+  void reverseRoot(const Record& record, Matrix& A,
+                   std::index_sequence<I...>) const {
+    (reverseArgument<I>(record, std::get<I>(record.H), A), ...);
+  }
+};
+
+/**
+ * An Expression<T> used as a sub-tree of a fused expression. It is evaluated
+ * with reverse AD on its execution trace, and its Jacobians are then chained
+ * as those of a function of all its keys.
+ */
+template <typename T>
+class Wrapped : public ExpressionBase {
+ public:
+  using Type = T;
+  static constexpr int Dim = traits<T>::dimension;
+  static constexpr bool kConstant = false;
+  struct Record {
+    std::vector<Matrix> H;
+  };
+
+  explicit Wrapped(const Expression<T>& expression) : expression_(expression) {
+    const std::set<Key> keys = expression.keys();
+    keys_.assign(keys.begin(), keys.end());
+  }
+
+  void dims(std::map<Key, int>& map) const { expression_.dims(map); }
+
+  void bind(const Columns& columns) {
+    columns_.clear();
+    for (Key key : keys_) columns_.push_back(columns(key));
+  }
+
+  T forward(const Values& values, Record* record) const {
+    if (!record) return expression_.value(values);
+    record->H.resize(keys_.size());
+    return expression_.value(values, record->H);
+  }
+
+  template <class D>
+  void reverse(const Record& record, const Eigen::MatrixBase<D>& dFdT,
+               Matrix& A) const {
+    for (size_t k = 0; k < keys_.size(); k++) {
+      const Matrix& H = record.H[k];
+      A.block(0, columns_[k], dFdT.rows(), H.cols()) += dFdT * H;
+    }
+  }
+
+  void reverseRoot(const Record& record, Matrix& A) const {
+    for (size_t k = 0; k < keys_.size(); k++) {
+      const Matrix& H = record.H[k];
+      A.block(0, columns_[k], Dim, H.cols()) += H;
+    }
+  }
+
+ private:
+  Expression<T> expression_;
+  KeyVector keys_;
+  FastVector<DenseIndex> columns_;
+};
+
+/// Create a Function of fused expressions.
+template <typename T, class F, class... Args>
+Function<T, F, Args...> apply(const F& f, const Args&... args) {
+  return Function<T, F, Args...>(f, args...);
+}
+
+/// Use an Expression<T> in a fused expression.
+template <typename T>
+Wrapped<T> wrap(const Expression<T>& expression) {
+  return Wrapped<T>(expression);
+}
+
+/// Function objects for the Lie group operations, see traits<T>.
+struct Compose {
+  template <typename T, int N = traits<T>::dimension>
+  T operator()(const T& a, const T& b, OptionalJacobian<N, N> H1,
+               OptionalJacobian<N, N> H2) const {
+    return traits<T>::Compose(a, b, H1, H2);
+  }
+};
+
+struct Between {
+  template <typename T, int N = traits<T>::dimension>
+  T operator()(const T& a, const T& b, OptionalJacobian<N, N> H1,
+               OptionalJacobian<N, N> H2) const {
+    return traits<T>::Between(a, b, H1, H2);
+  }
+};
+
+struct Inverse {
+  template <typename T, int N = traits<T>::dimension>
+  T operator()(const T& a, OptionalJacobian<N, N> H) const {
+    return traits<T>::Inverse(a, H);
+  }
+};
+
+/// Compose two fused expressions of the same Lie group.
+template <class A, class B,
+          typename = std::enable_if_t<IsExpression<A> && IsExpression<B>>>
+Function<typename A::Type, Compose, A, B> compose(const A& a, const B& b) {
+  static_assert(std::is_same_v<typename A::Type, typename B::Type>,
+                "fused::compose: types differ");
+  return {Compose(), a, b};
+}
+
+/// Compose two fused expressions of the same Lie group.
+template <class A, class B,
+          typename = std::enable_if_t<IsExpression<A> && IsExpression<B>>>
+Function<typename A::Type, Compose, A, B> operator*(const A& a, const B& b) {
+  return compose(a, b);
+}
+
+/// Between of two fused expressions, i.e., inverse(a) * b.
+template <class A, class B,
+          typename = std::enable_if_t<IsExpression<A> && IsExpression<B>>>
+Function<typename A::Type, Between, A, B> between(const A& a, const B& b) {
+  static_assert(std::is_same_v<typename A::Type, typename B::Type>,
+                "fused::between: types differ");
+  return {Between(), a, b};
+}
+
+/// Inverse of a fused expression.
+template <class A, typename = std::enable_if_t<IsExpression<A>>>
+Function<typename A::Type, Inverse, A> inverse(const A& a) {
+  return {Inverse(), a};
+}
+
+}  // namespace fused
+}  // namespace gtsam
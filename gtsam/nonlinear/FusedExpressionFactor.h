@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file FusedExpressionFactor.h
+ * @date October 2026
+ * @brief ExpressionFactor for fused, compile-time expression trees
+ */
+
+#pragma once
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/nonlinear/FusedExpression.h>
+#include <gtsam/nonlinear/NonlinearFactor.h>
+#include <gtsam/nonlinear/internal/TraceArena.h>
+
+#include <map>
+#include <stdexcept>
+
+namespace gtsam {
+
+/**
+ * Factor |h(x) - z|^2 where h is a fused expression, see FusedExpression.h.
+ * Behaves as ExpressionFactor<T>, with the same (sorted) keys, errors and
+ * Jacobians, but the expression is evaluated and differentiated by code
+ * generated at compile time for its tree.
+ * \tparam E fused expression type, e.g., as returned by fused::apply
+ */
+template <class E>
+class FusedExpressionFactor : public NoiseModelFactor {
+  static_assert(fused::IsExpression<E>,
+                "FusedExpressionFactor: E must be a fused expression");
+
+ public:
+  using T = typename E::Type;
+  using This = FusedExpressionFactor<E>;
+  using shared_ptr = std::shared_ptr<This>;
+  static constexpr int Dim = E::Dim;
+
+ protected:
+  T measured_;           ///< the measurement to be compared with the expression
+  E expression_;         ///< the expression, bound to the columns of keys_
+  FastVector<int> dims_; ///< dimensions of the Jacobian matrices
+
+ public:
+  // Provide access to the Matrix& version of unwhitenedError:
+  using NoiseModelFactor::unwhitenedError;
+
+  /**
+   * Constructor: creates a factor from a measurement and measurement function
+   *   @param noiseModel the noise model associated with a measurement
+   *   @param measurement actual value of the measurement, of type T
+   *   @param expression predicts the measurement from Values
+   * The keys associated with the factor, returned by keys(), are sorted.
+   */
+  FusedExpressionFactor(const SharedNoiseModel& noiseModel,
+                        const T& measurement, const E& expression)
+      : NoiseModelFactor(noiseModel),
+        measured_(measurement),
+        expression_(expression) {
+    if (!noiseModel_)
+      throw std::invalid_argument("FusedExpressionFactor: no NoiseModel.");
+    if (noiseModel_->dim() != Dim)
+      throw std::invalid_argument(
+          "FusedExpressionFactor was created with a NoiseModel of incorrect "
+          "dimension.");
+
+    std::map<Key, int> keyedDims;
+    expression_.dims(keyedDims);
+    fused::Columns columns;
+    DenseIndex column = 0;
+    for (const auto& [key, dim] : keyedDims) {
+      keys_.push_back(key);
+      dims_.push_back(dim);
+      columns.keys.push_back(key);
+      columns.offsets.push_back(column);
+      column += dim;
+    }
+    expression_.bind(columns);
+  }
+
+  /// return the measurement
+  const T& measured() const { return measured_; }
+
+  /// return the expression
+  const E& expression() const { return expression_; }
+
+  /// print relies on Testable traits being defined for T
+  void print(const std::string& s = "", const KeyFormatter& keyFormatter =
+                                            DefaultKeyFormatter) const override {
+    NoiseModelFactor::print(s, keyFormatter);
+    traits<T>::Print(measured_, "FusedExpressionFactor with measurement: ");
+  }
+
+  /// equals relies on Testable traits being defined for T
+  bool equals(const NonlinearFactor& f, double tol) const override {
+    const This* p = dynamic_cast<const This*>(&f);
+    return p && NoiseModelFactor::equals(f, tol) &&
+           traits<T>::Equals(measured_, p->measured_, tol) &&
+           dims_ == p->dims_;
+  }
+
+  /// Value of the expression, with its Jacobian added into the columns of A.
+  T valueAndJacobian(const Values& x, Matrix& A) const {
+    typename E::Record record;
+    const T value = expression_.forward(x, &record);
+    expression_.reverseRoot(record, A);
+    return value;
+  }
+
+  /**
+   * Error function *without* the NoiseModel, \f$ z-h(x) -> Local(h(x),z) \f$,
+   * as in ExpressionFactor.
+   */
+  Vector unwhitenedError(const Values& x,
+                         OptionalMatrixVecType H = nullptr) const override {
+    if (H) {
+      internal::JacobianBuffer buffer(dims_, Dim);
+      VerticalBlockMatrix& Ab = buffer.matrix();
+      const T value = valueAndJacobian(x, Ab.matrix());
+      for (DenseIndex i = 0; i < static_cast<DenseIndex>(size()); i++)
+        (*H)[i] = Ab(i);
+      return -traits<T>::Local(value, measured_);
+    } else {
+      const T value = expression_.forward(x, nullptr);
+      return -traits<T>::Local(value, measured_);
+    }
+  }
+
+  std::shared_ptr<GaussianFactor> linearize(const Values& x) const override {
+    // Only linearize if the factor is active
+    if (!active(x)) return std::shared_ptr<JacobianFactor>();
+
+    // In case noise model is constrained, we need to provide a noise model
+    SharedDiagonal noiseModel;
+    if (noiseModel_ && noiseModel_->isConstrained()) {
+      noiseModel = std::static_pointer_cast<noiseModel::Constrained>(
+          noiseModel_)->unit();
+    }
+
+    // Write the Jacobian directly into a zeroed JacobianFactor
+    std::shared_ptr<JacobianFactor> factor(
+        new JacobianFactor(keys_, dims_, Dim, noiseModel));
+    VerticalBlockMatrix& Ab = factor->matrixObject();
+    Ab.matrix().setZero();
+    const T value = valueAndJacobian(x, Ab.matrix());
+
+    // Evaluate error and set RHS vector b
+    Ab(size()).col(0) = traits<T>::Local(value, measured_);
+
+    // Whiten the corresponding system, Ab already contains RHS
+    if (noiseModel_) {
+      // need b to be valid for Robust noise models, kept to avoid allocation
+      static thread_local Vector b;
+      b = Ab(size()).col(0);
+      noiseModel_->WhitenSystem(Ab.matrix(), b);
+    }
+
+    return factor;
+  }
+
+  /// @return a deep copy of this factor
+  gtsam::NonlinearFactor::shared_ptr clone() const override {
+    return std::static_pointer_cast<gtsam::NonlinearFactor>(
+        gtsam::NonlinearFactor::shared_ptr(new This(*this)));
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// traits
+template <class E>
+struct traits<FusedExpressionFactor<E>>
+    : public Testable<FusedExpressionFactor<E>> {};
+
+}  // namespace gtsam
@@ -197,20 +197,26 @@ void ISAM2::recalculateBatch(const ISAM2UpdateParams& updateParams,
   gttoc(add_keys);
 
   gttic(ordering);
-  Ordering order;
+  FastMap<Key, int> constraintGroups;
   if (updateParams.constrainedKeys) {
-    order = Ordering::ColamdConstrained(affectedFactorsVarIndex,
-                                        *updateParams.constrainedKeys);
-  } else {
-    if (theta_.size() > result->observedKeys.size()) {
-      // Only if some variables are unconstrained
-      FastMap<Key, int> constraintGroups;
-      for (Key var : result->observedKeys) constraintGroups[var] = 1;
+    constraintGroups = *updateParams.constrainedKeys;
+  } else if (theta_.size() > result->observedKeys.size()) {
+    // Only if some variables are unconstrained
+    for (Key var : result->observedKeys) constraintGroups[var] = 1;
+  }
+  Ordering order;
+  switch (params_.batchOrderingType) {
+    case Ordering::COLAMD:
       order = Ordering::ColamdConstrained(affectedFactorsVarIndex,
                                           constraintGroups);
-    } else {
-      order = Ordering::Colamd(affectedFactorsVarIndex);
-    }
+      break;
+    case Ordering::METIS:
+      order = Ordering::MetisConstrained(affectedFactorsVarIndex,
+                                         constraintGroups);
+      break;
+    default:
+      throw std::invalid_argument(
+          "ISAM2: batchOrderingType must be COLAMD or METIS");
   }
   gttoc(ordering);
 
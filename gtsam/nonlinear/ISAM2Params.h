@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <gtsam/inference/Ordering.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/nonlinear/DoglegOptimizerImpl.h>
 
@@ -224,6 +225,15 @@ struct GTSAM_EXPORT ISAM2Params {
   /// cost of having to search for slots every time a factor is added.
   bool findUnusedFactorSlots;
 
+  /** The ordering used when all variables are reordered in a batch step
+   * (default: COLAMD), either COLAMD or METIS. Both keep the constrained keys
+   * of the update, or else the newly observed variables, last. METIS orders
+   * the other variables by nested dissection, which yields a balanced Bayes
+   * tree whose subtrees can be eliminated in parallel, rather than the deep
+   * and thin trees CCOLAMD produces for long trajectories.
+   */
+  Ordering::OrderingType batchOrderingType;
+
   /**
    * Specify parameters as constructor arguments
    * See the documentation of member variables above.
@@ -247,7 +257,8 @@ struct GTSAM_EXPORT ISAM2Params {
         keyFormatter(_keyFormatter),
         enableDetailedResults(_enableDetailedResults),
         enablePartialRelinearizationCheck(false),
-        findUnusedFactorSlots(false) {}
+        findUnusedFactorSlots(false),
+        batchOrderingType(Ordering::COLAMD) {}
 
   /// print iSAM2 parameters
   void print(const std::string& str = "") const {
@@ -290,6 +301,8 @@ struct GTSAM_EXPORT ISAM2Params {
          << enablePartialRelinearizationCheck << "\n";
     cout << "findUnusedFactorSlots:             " << findUnusedFactorSlots
          << "\n";
+    cout << "batchOrderingType:                 "
+         << (batchOrderingType == Ordering::METIS ? "METIS" : "COLAMD") << "\n";
     cout.flush();
   }
 
@@ -22,7 +22,9 @@
 #include <gtsam/nonlinear/internal/LevenbergMarquardtState.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/nonlinear/Values.h>
+#include <gtsam/linear/DampedGaussianJunctionTree.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/PCGSolver.h>
 #include <gtsam/linear/linearExceptions.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/base/Vector.h>
@@ -30,6 +32,7 @@
 #include <gtsam/base/timing.h>
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
@@ -138,8 +141,12 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
   if (verbose)
     cout << "trying lambda = " << currentState->lambda << endl;
 
-  // Build damped system for this lambda (adds prior factors that make it like gradient descent)
-  auto dampedSystem = buildDampedSystem(linear, sqrtHessianDiagonal);
+  // Build damped system for this lambda (adds prior factors that make it like gradient descent),
+  // unless the solver is given lambda directly
+  const bool damped = solvesDamped();
+  GaussianFactorGraph dampedSystem;
+  if (!damped)
+    dampedSystem = buildDampedSystem(linear, sqrtHessianDiagonal);
 
   // Try solving
   double modelFidelity = 0.0;
@@ -153,7 +160,8 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
   bool systemSolvedSuccessfully;
   try {
     // ============ Solve is where most computation happens !! =================
-    delta = solve(dampedSystem, params_);
+    delta = damped ? solveDamped(linear, sqrtHessianDiagonal)
+                   : solve(dampedSystem, params_);
     systemSolvedSuccessfully = true;
   } catch (const IndeterminantLinearSystemException&) {
     systemSolvedSuccessfully = false;
@@ -269,6 +277,64 @@ bool LevenbergMarquardtOptimizer::tryLambda(const GaussianFactorGraph& linear,
   }
 }
 
+/* ************************************************************************* */
+bool LevenbergMarquardtOptimizer::solvesDamped() const {
+  if (junctionTree_) return true;
+  return params_.isIterative() &&
+         (params_.warmStart || params_.reusePreconditioner ||
+          params_.inexactNewton) &&
+         std::dynamic_pointer_cast<PCGSolverParameters>(params_.iterativeParams);
+}
+
+/* ************************************************************************* */
+VectorValues LevenbergMarquardtOptimizer::solveDamped(
+    const GaussianFactorGraph& linear, const VectorValues& sqrtHessianDiagonal) {
+  gttic(solve_damped);
+  const std::map<Key, Vector> lambda = damping(sqrtHessianDiagonal);
+  if (junctionTree_) return junctionTree_->eliminate(lambda)->optimize();
+
+  const auto pcg =
+      std::dynamic_pointer_cast<PCGSolverParameters>(params_.iterativeParams);
+  if (!pcgSolver_)
+    pcgSolver_ = std::make_shared<PCGSolver>(*pcg);
+
+  if (params_.reusePreconditioner && preconditionerBuilt_)
+    pcgSolver_->updateDamping(linear, keyInfo_, lambda);
+  else
+    pcgSolver_->build(linear, keyInfo_, lambda);
+  preconditionerBuilt_ = true;
+
+  const double epsilon_rel = params_.inexactNewton
+                                 ? std::max(forcingTerm_, pcg->epsilon_rel)
+                                 : pcg->epsilon_rel;
+  VectorValues delta =
+      pcgSolver_->solve(linear, keyInfo_, lambda,
+                        params_.warmStart ? previousDelta_ : VectorValues(),
+                        epsilon_rel);
+  linearIterations_ += pcgSolver_->iterations();
+  if (params_.verbosityLM >= LevenbergMarquardtParams::TRYLAMBDA)
+    cout << "pcg iterations = " << pcgSolver_->iterations()
+         << ", epsilon_rel = " << epsilon_rel << endl;
+
+  previousDelta_ = delta;
+  return delta;
+}
+
+/* ************************************************************************* */
+std::map<Key, Vector> LevenbergMarquardtOptimizer::damping(
+    const VectorValues& sqrtHessianDiagonal) const {
+  auto currentState = static_cast<const State*>(state_.get());
+  std::map<Key, Vector> lambda;
+  if (params_.diagonalDamping) {
+    for (const auto& [key, value] : sqrtHessianDiagonal)
+      lambda.emplace(key, currentState->lambda * value.cwiseAbs2());
+  } else {
+    for (const auto& [key, dim] : currentState->values.dims())
+      lambda.emplace(key, Vector::Constant(dim, currentState->lambda));
+  }
+  return lambda;
+}
+
 /* ************************************************************************* */
 GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::iterate() {
   auto currentState = static_cast<const State*>(state_.get());
@@ -298,6 +364,40 @@ GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::iterate() {
     }
   }
 
+  // Cholesky cannot eliminate constrained noise models, which then go through
+  // the damped graph and EliminatePreferCholesky as usual
+  junctionTree_.reset();
+  if (params_.cacheCliqueHessians &&
+      params_.linearSolverType == NonlinearOptimizerParams::MULTIFRONTAL_CHOLESKY &&
+      !hasConstraints(*linear))
+    junctionTree_ = std::make_shared<DampedGaussianJunctionTree>(*linear, *params_.ordering);
+
+  if (solvesDamped() && !junctionTree_) {
+    // Only the lambda trials on the same linearization share the preconditioner
+    // and warm start from each other, the last step of another linearization
+    // is a poor start.
+    keyInfo_ = KeyInfo(*linear);
+    preconditionerBuilt_ = false;
+    previousDelta_ = VectorValues();
+
+    // Eisenstat-Walker forcing term, choice 2 with gamma = 0.9 and alpha = 2,
+    // safeguarded so that it does not drop too fast
+    if (params_.inexactNewton) {
+      const double gamma = 0.9, alpha = 2.0;
+      const double gradientNorm = linear->gradientAtZero().norm();
+      if (previousGradientNorm_ > 0.0) {
+        double eta =
+            gamma * std::pow(gradientNorm / previousGradientNorm_, alpha);
+        const double safeguard = gamma * std::pow(forcingTerm_, alpha);
+        if (safeguard > 0.1) eta = std::max(eta, safeguard);
+        forcingTerm_ = std::min(eta, params_.maxForcingTerm);
+      } else {
+        forcingTerm_ = params_.maxForcingTerm;
+      }
+      previousGradientNorm_ = gradientNorm;
+    }
+  }
+
   // Keep increasing lambda until we make make progress
   while (!tryLambda(*linear, sqrtHessianDiagonal)) {
     auto newState = static_cast<const State*>(state_.get());
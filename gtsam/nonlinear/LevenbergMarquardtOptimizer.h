@@ -22,6 +22,7 @@
 
 #include <gtsam/nonlinear/NonlinearOptimizer.h>
 #include <gtsam/nonlinear/LevenbergMarquardtParams.h>
+#include <gtsam/linear/IterativeSolver.h>
 #include <gtsam/linear/VectorValues.h>
 #include <chrono>
 
@@ -29,6 +30,9 @@ class NonlinearOptimizerMoreOptimizationTest;
 
 namespace gtsam {
 
+class PCGSolver;
+class DampedGaussianJunctionTree;
+
 /**
  * This class performs Levenberg-Marquardt nonlinear optimization
  */
@@ -42,6 +46,22 @@ protected:
 
   void initTime();
 
+  /// @name State of iterative solves that only damp with lambda, see
+  /// LevenbergMarquardtParams::warmStart
+  /// @{
+  std::shared_ptr<PCGSolver> pcgSolver_;  ///< keeps the preconditioner
+  KeyInfo keyInfo_;                       ///< of the current linearization
+  bool preconditionerBuilt_ = false;      ///< for the current linearization
+  VectorValues previousDelta_;            ///< last lambda trial, for warm starts
+  double previousGradientNorm_ = 0.0;     ///< for the forcing term
+  double forcingTerm_ = 0.0;              ///< PCG tolerance, if inexactNewton
+  size_t linearIterations_ = 0;           ///< total PCG iterations
+  /// @}
+
+  /// Clique Hessians of the current linearization, see
+  /// LevenbergMarquardtParams::cacheCliqueHessians
+  std::shared_ptr<DampedGaussianJunctionTree> junctionTree_;
+
 public:
   typedef std::shared_ptr<LevenbergMarquardtOptimizer> shared_ptr;
 
@@ -85,6 +105,10 @@ public:
   /// Access the current number of inner iterations
   int getInnerIterations() const;
 
+  /// Access the total number of PCG iterations, only counted if the solves
+  /// only damp with lambda, see LevenbergMarquardtParams::warmStart
+  size_t getLinearIterations() const { return linearIterations_; }
+
   /// print
   void print(const std::string& str = "") const {
     std::cout << str << "LevenbergMarquardtOptimizer" << std::endl;
@@ -119,10 +143,25 @@ public:
   /** Inner loop, changes state, returns true if successful or giving up */
   bool tryLambda(const GaussianFactorGraph& linear, const VectorValues& sqrtHessianDiagonal);
 
+  /**
+   * Solve the damped system for the current lambda without building it:
+   * lambda is passed as a diagonal to PCGSolver, so that the preconditioner
+   * and the previous step can be reused across lambda trials, or added to the
+   * cached clique Hessians before multifrontal Cholesky.
+   */
+  VectorValues solveDamped(const GaussianFactorGraph& linear,
+                           const VectorValues& sqrtHessianDiagonal);
+
   /// @}
 
 protected:
 
+  /// Whether tryLambda uses solveDamped instead of buildDampedSystem and solve
+  bool solvesDamped() const;
+
+  /// The damping of buildDampedSystem, lambda * I or lambda * diag(Hessian)
+  std::map<Key, Vector> damping(const VectorValues& sqrtHessianDiagonal) const;
+
   /** Access the parameters (base class version) */
   const NonlinearOptimizerParams& _params() const override {
     return params_;
@@ -100,6 +100,11 @@ void LevenbergMarquardtParams::print(const std::string& str) const {
   std::cout << "            diagonalDamping: " << diagonalDamping << "\n";
   std::cout << "                minDiagonal: " << minDiagonal << "\n";
   std::cout << "                maxDiagonal: " << maxDiagonal << "\n";
+  std::cout << "                  warmStart: " << warmStart << "\n";
+  std::cout << "        reusePreconditioner: " << reusePreconditioner << "\n";
+  std::cout << "              inexactNewton: " << inexactNewton << "\n";
+  std::cout << "             maxForcingTerm: " << maxForcingTerm << "\n";
+  std::cout << "        cacheCliqueHessians: " << cacheCliqueHessians << "\n";
   std::cout << "                verbosityLM: "
       << verbosityLMTranslator(verbosityLM) << "\n";
   std::cout.flush();
@@ -58,11 +58,26 @@ public:
   double minDiagonal; ///< when using diagonal damping saturates the minimum diagonal entries (default: 1e-6)
   double maxDiagonal; ///< when using diagonal damping saturates the maximum diagonal entries (default: 1e32)
 
+  /// @name Iterative solves with PCGSolverParameters, which lambda only damps
+  /// @{
+  bool warmStart; ///< if true, start PCG from the step of the previous lambda trial on the same linearization instead of zero (default: false)
+  bool reusePreconditioner; ///< if true, build the preconditioner once per linearization and only update its damping when lambda changes (default: false)
+  bool inexactNewton; ///< if true, use the Eisenstat-Walker forcing term as the PCG tolerance, at least epsilon_rel (default: false)
+  double maxForcingTerm; ///< upper bound on the forcing term, also used for the first linearization (default: 1e-3)
+  /// @}
+
+  bool cacheCliqueHessians; ///< if true and linearSolverType is MULTIFRONTAL_CHOLESKY, combine the factors of each clique into a Hessian once per linearization and add lambda to its diagonal for each lambda trial, instead of eliminating a damped graph (default: false)
+
   LevenbergMarquardtParams()
       : verbosityLM(SILENT),
         diagonalDamping(false),
         minDiagonal(1e-6),
-        maxDiagonal(1e32) {
+        maxDiagonal(1e32),
+        warmStart(false),
+        reusePreconditioner(false),
+        inexactNewton(false),
+        maxForcingTerm(1e-3),
+        cacheCliqueHessians(false) {
     SetLegacyDefaults(this);
   }
 
@@ -135,6 +150,11 @@ public:
   bool getUseFixedLambdaFactor() { return useFixedLambdaFactor; }
   std::string getLogFile() const { return logFile; }
   std::string getVerbosityLM() const { return verbosityLMTranslator(verbosityLM);}
+  bool getWarmStart() const { return warmStart; }
+  bool getReusePreconditioner() const { return reusePreconditioner; }
+  bool getInexactNewton() const { return inexactNewton; }
+  double getMaxForcingTerm() const { return maxForcingTerm; }
+  bool getCacheCliqueHessians() const { return cacheCliqueHessians; }
   
   void setDiagonalDamping(bool flag) { diagonalDamping = flag; }
   void setlambdaFactor(double value) { lambdaFactor = value; }
@@ -144,6 +164,11 @@ public:
   void setUseFixedLambdaFactor(bool flag) { useFixedLambdaFactor = flag;}
   void setLogFile(const std::string& s) { logFile = s; }
   void setVerbosityLM(const std::string& s) { verbosityLM = verbosityLMTranslator(s);}
+  void setWarmStart(bool flag) { warmStart = flag; }
+  void setReusePreconditioner(bool flag) { reusePreconditioner = flag; }
+  void setInexactNewton(bool flag) { inexactNewton = flag; }
+  void setMaxForcingTerm(double value) { maxForcingTerm = value; }
+  void setCacheCliqueHessians(bool flag) { cacheCliqueHessians = flag; }
   // @}
   /// @name Clone
   /// @{
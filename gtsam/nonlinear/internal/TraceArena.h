@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file TraceArena.h
+ * @date October 2026
+ * @brief Per-thread buffers reused across expression evaluations
+ */
+
+#pragma once
+
+#include <gtsam/base/FastVector.h>
+#include <gtsam/base/VerticalBlockMatrix.h>
+#include <gtsam/nonlinear/internal/ExecutionTrace.h>
+
+#include <memory>
+#include <utility>
+
+namespace gtsam {
+namespace internal {
+
+/**
+ * Execution trace storage of at least a given size, taken from a per-thread
+ * arena and given back on destruction, so that evaluating an expression with
+ * derivatives does not allocate once the arena has grown to the largest trace.
+ * The arena is borrowed for the lifetime of a TraceBuffer: a nested evaluation
+ * on the same thread (e.g., from a custom function) finds it empty and
+ * allocates its own storage, which is kept if it is larger.
+ */
+class TraceBuffer {
+ public:
+  /// Borrow the arena of this thread, growing it to size bytes if needed.
+  explicit TraceBuffer(size_t size) {
+    Arena& arena = ThreadArena();
+    storage_ = std::move(arena.storage);
+    capacity_ = std::exchange(arena.capacity, 0);
+    const size_t n = (size + TraceAlignment - 1) / TraceAlignment;
+    if (n > capacity_) {
+      storage_.reset(new ExecutionTraceStorage[n]);
+      capacity_ = n;
+    }
+  }
+
+  /// Give the storage back to the arena, if it is larger than the arena's.
+  ~TraceBuffer() {
+    Arena& arena = ThreadArena();
+    if (capacity_ > arena.capacity) {
+      arena.storage = std::move(storage_);
+      arena.capacity = capacity_;
+    }
+  }
+
+  TraceBuffer(const TraceBuffer&) = delete;
+  TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+  /// Start of the storage, aligned to TraceAlignment.
+  char* data() { return reinterpret_cast<char*>(storage_.get()); }
+
+ private:
+  struct Arena {
+    std::unique_ptr<ExecutionTraceStorage[]> storage;
+    size_t capacity = 0;  ///< in units of ExecutionTraceStorage
+  };
+
+  static Arena& ThreadArena() {
+    static thread_local Arena arena;
+    return arena;
+  }
+
+  std::unique_ptr<ExecutionTraceStorage[]> storage_;
+  size_t capacity_ = 0;
+};
+
+/**
+ * Zeroed Jacobian of the given block dimensions, borrowed from a per-thread
+ * cache like TraceBuffer. The cached matrix is only re-allocated when the
+ * dimensions change, which is rare when linearizing many factors of a kind.
+ */
+class JacobianBuffer {
+ public:
+  /// Borrow the cached Jacobian, re-allocated if dims or rows differ.
+  JacobianBuffer(const FastVector<int>& dims, DenseIndex rows)
+      : Ab_(std::move(ThreadCache())) {
+    if (!Ab_ || !hasDimensions(dims, rows))
+      Ab_ = std::make_unique<VerticalBlockMatrix>(dims, rows);
+    Ab_->matrix().setZero();
+  }
+
+  /// Give the Jacobian back to the cache.
+  ~JacobianBuffer() { ThreadCache() = std::move(Ab_); }
+
+  JacobianBuffer(const JacobianBuffer&) = delete;
+  JacobianBuffer& operator=(const JacobianBuffer&) = delete;
+
+  VerticalBlockMatrix& matrix() { return *Ab_; }
+
+ private:
+  bool hasDimensions(const FastVector<int>& dims, DenseIndex rows) const {
+    if (Ab_->rows() != rows ||
+        Ab_->nBlocks() != static_cast<DenseIndex>(dims.size()))
+      return false;
+    for (size_t i = 0; i < dims.size(); i++)
+      if ((*Ab_)(i).cols() != dims[i]) return false;
+    return true;
+  }
+
+  static std::unique_ptr<VerticalBlockMatrix>& ThreadCache() {
+    static thread_local std::unique_ptr<VerticalBlockMatrix> Ab;
+    return Ab;
+  }
+
+  std::unique_ptr<VerticalBlockMatrix> Ab_;
+};
+
+}  // namespace internal
+}  // namespace gtsam
@@ -266,6 +266,11 @@ virtual class LevenbergMarquardtParams : gtsam::NonlinearOptimizerParams {
   bool getUseFixedLambdaFactor();
   string getLogFile() const;
   string getVerbosityLM() const;
+  bool getWarmStart() const;
+  bool getReusePreconditioner() const;
+  bool getInexactNewton() const;
+  double getMaxForcingTerm() const;
+  bool getCacheCliqueHessians() const;
 
   void setDiagonalDamping(bool flag);
   void setlambdaFactor(double value);
@@ -275,6 +280,11 @@ virtual class LevenbergMarquardtParams : gtsam::NonlinearOptimizerParams {
   void setUseFixedLambdaFactor(bool flag);
   void setLogFile(string s);
   void setVerbosityLM(string s);
+  void setWarmStart(bool flag);
+  void setReusePreconditioner(bool flag);
+  void setInexactNewton(bool flag);
+  void setMaxForcingTerm(double value);
+  void setCacheCliqueHessians(bool flag);
 
   static gtsam::LevenbergMarquardtParams LegacyDefaults();
   static gtsam::LevenbergMarquardtParams CeresDefaults();
@@ -471,6 +481,7 @@ class ISAM2Params {
   bool enableDetailedResults;
   bool enablePartialRelinearizationCheck;
   bool findUnusedFactorSlots;
+  gtsam::Ordering::OrderingType batchOrderingType;
 
   enum Factorization { CHOLESKY, QR };
   gtsam::ISAM2Params::Factorization factorization;
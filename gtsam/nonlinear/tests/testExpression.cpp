@@ -538,6 +538,64 @@ TEST(Expression, LinearExpression) {
   EXPECT(assert_equal(I_3x3, H[0]))
 }
 
+/* ************************************************************************* */
+// Trace storage and Jacobians are re-used across calls on the same thread,
+// check that alternating expressions of different sizes gives correct results.
+TEST(Expression, ReusedBuffers) {
+  Values values;
+  values.insert(1, Pose3(Rot3::Ypr(0.1, 0.2, 0.3), Point3(1, 2, 3)));
+  values.insert(2, Point3(4, 5, 16));
+  values.insert(3, Cal3_S2(500, 480, 0.1, 320, 240));
+  const PinholeCamera<Cal3_S2> camera(values.at<Pose3>(1),
+                                      values.at<Cal3_S2>(3));
+  Matrix26 Dpose;
+  Matrix23 Dpoint;
+  Matrix25 Dcal;
+  const Point2 expected =
+      camera.project(values.at<Point3>(2), Dpose, Dpoint, Dcal);
+
+  const Point3_ scaled = 23 * Point3_(2);
+  for (size_t i = 0; i < 3; i++) {
+    std::vector<Matrix> H1(1), H3(3);
+    EXPECT(assert_equal(Point3(92, 115, 368), scaled.value(values, H1)))
+    EXPECT(assert_equal(23 * I_3x3, H1[0]))
+    EXPECT(assert_equal(expected, tree::uv_hat.value(values, H3), 1e-9))
+    EXPECT(assert_equal(Dpose, H3[0], 1e-9))
+    EXPECT(assert_equal(Dpoint, H3[1], 1e-9))
+    EXPECT(assert_equal(Dcal, H3[2], 1e-9))
+  }
+}
+
+/* ************************************************************************* */
+// A function that evaluates another expression with derivatives, while the
+// buffers of this thread are in use by the outer expression.
+TEST(Expression, NestedEvaluation) {
+  Values values;
+  values.insert(1, Pose3(Rot3::Ypr(0.1, 0.2, 0.3), Point3(1, 2, 3)));
+  values.insert(2, Point3(4, 5, 16));
+  values.insert(3, Cal3_S2(500, 480, 0.1, 320, 240));
+  values.insert(4, Point3(1, 2, 3));
+  std::vector<Matrix> innerH(3);
+  Point2 inner;
+  const std::function<double(const Point3&, OptionalJacobian<1, 3>)> f =
+      [&](const Point3& p, OptionalJacobian<1, 3> H) {
+        inner = tree::uv_hat.value(values, innerH);
+        if (H) *H << 1, 2, 3;
+        return p.x() + 2 * p.y() + 3 * p.z() + inner.x();
+      };
+  const Double_ outer(f, 2 * Point3_(4));
+
+  std::vector<Matrix> H(1);
+  const double actual = outer.value(values, H);
+  EXPECT_DOUBLES_EQUAL(28 + inner.x(), actual, 1e-9)
+  EXPECT(assert_equal((Matrix(1, 3) << 2, 4, 6).finished(), H[0]))
+
+  std::vector<Matrix> expectedH(3);
+  EXPECT(assert_equal(inner, tree::uv_hat.value(values, expectedH)))
+  for (size_t i = 0; i < 3; i++)
+    EXPECT(assert_equal(expectedH[i], innerH[i]))
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
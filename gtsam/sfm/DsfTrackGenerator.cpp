@@ -16,11 +16,19 @@
  * @brief Identifies connected components in the keypoint matches graph.
  */
 
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/sfm/DsfTrackGenerator.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <stdexcept>
+#include <string>
 
 namespace gtsam {
 
@@ -133,6 +141,167 @@ std::vector<SfmTrack2d> tracksFromPairwiseMatches(
   return validTracks;
 }
 
+/* ************************************************************************* */
+// Run body(i) for i in [0, n), in parallel if TBB is available.
+template <typename BODY>
+static void parallelFor(size_t n, const BODY& body) {
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      for (size_t i = range.begin(); i != range.end(); ++i)
+                        body(i);
+                    });
+#else
+  for (size_t i = 0; i < n; ++i) body(i);
+#endif
+}
+
+/* ************************************************************************* */
+static std::vector<size_t> computeOffsets(
+    const std::vector<size_t>& nrKeypoints) {
+  std::vector<size_t> offsets(nrKeypoints.size() + 1, 0);
+  for (size_t i = 0; i < nrKeypoints.size(); i++)
+    offsets[i + 1] = offsets[i] + nrKeypoints[i];
+  return offsets;
+}
+
+ConcurrentTrackBuilder::ConcurrentTrackBuilder(
+    const std::vector<size_t>& nrKeypoints)
+    : offsets_(computeOffsets(nrKeypoints)), dsf_(offsets_.back()) {}
+
+/* ************************************************************************* */
+static std::vector<size_t> countKeypoints(const KeypointsVector& keypoints) {
+  std::vector<size_t> result;
+  for (const Keypoints& kp : keypoints) result.push_back(kp.coordinates.rows());
+  return result;
+}
+
+ConcurrentTrackBuilder::ConcurrentTrackBuilder(const KeypointsVector& keypoints)
+    : ConcurrentTrackBuilder(countKeypoints(keypoints)) {}
+
+/* ************************************************************************* */
+size_t ConcurrentTrackBuilder::id(size_t i, size_t k) const {
+  if (i + 1 >= offsets_.size() || offsets_[i] + k >= offsets_[i + 1])
+    throw std::out_of_range("ConcurrentTrackBuilder: detection (" +
+                            std::to_string(i) + "," + std::to_string(k) +
+                            ") out of range");
+  return offsets_[i] + k;
+}
+
+/* ************************************************************************* */
+void ConcurrentTrackBuilder::addMatches(const IndexPair& pair,
+                                        const CorrespondenceIndices& matches) {
+  const size_t i1 = pair.first, i2 = pair.second;
+  for (Eigen::Index k = 0; k < matches.rows(); k++)
+    dsf_.merge(id(i1, matches(k, 0)), id(i2, matches(k, 1)));
+}
+
+/* ************************************************************************* */
+void ConcurrentTrackBuilder::addMatches(const MatchIndicesMap& matches) {
+  std::vector<MatchIndicesMap::const_iterator> pairs;
+  pairs.reserve(matches.size());
+  for (auto it = matches.begin(); it != matches.end(); ++it) pairs.push_back(it);
+  parallelFor(pairs.size(), [&](size_t p) {
+    addMatches(pairs[p]->first, pairs[p]->second);
+  });
+}
+
+/* ************************************************************************* */
+size_t ConcurrentTrackBuilder::forEachTrack(
+    const KeypointsVector& keypoints,
+    const std::function<void(SfmTrack2d&&)>& sink, size_t chunkSize) {
+  if (keypoints.size() + 1 != offsets_.size())
+    throw std::invalid_argument(
+        "ConcurrentTrackBuilder::forEachTrack: wrong number of images");
+  const size_t n = dsf_.size();
+
+  // Point every id directly at its root, so find() below is a single step.
+  dsf_.flatten();
+
+  // Count set sizes at the roots. Then number the sets when their smallest id
+  // comes up in a scan over all ids, which orders them by first detection.
+  constexpr size_t kNone = std::numeric_limits<size_t>::max();
+  std::vector<size_t> cursor(n, 0);
+  for (size_t x = 0; x < n; x++) ++cursor[dsf_.find(x)];
+  std::vector<size_t> start{0};
+  std::vector<char> numbered(n, false);
+  for (size_t x = 0; x < n; x++) {
+    const size_t r = dsf_.find(x);
+    if (numbered[r]) continue;
+    numbered[r] = true;
+    if (cursor[r] >= 2) {
+      const size_t size = cursor[r];
+      cursor[r] = start.back();
+      start.push_back(start.back() + size);
+    } else {
+      cursor[r] = kNone;  // singletons are not tracks
+    }
+  }
+  numbered = std::vector<char>();
+
+  // Bucket the ids by set, every bucket is sorted by id, hence by image.
+  std::vector<size_t> members(start.back());
+  for (size_t x = 0; x < n; x++) {
+    size_t& c = cursor[dsf_.find(x)];
+    if (c != kNone) members[c++] = x;
+  }
+  cursor = std::vector<size_t>();
+
+  // Assemble tracks in parallel, one chunk at a time.
+  const size_t nrSets = start.size() - 1;
+  size_t nrDiscarded = 0;
+  std::vector<SfmTrack2d> chunk;
+  std::vector<char> valid;  // not vector<bool>, written concurrently
+  for (size_t t0 = 0; t0 < nrSets; t0 += chunkSize) {
+    const size_t t1 = std::min(nrSets, t0 + chunkSize);
+    chunk.assign(t1 - t0, SfmTrack2d());
+    valid.assign(t1 - t0, true);
+    parallelFor(t1 - t0, [&](size_t t) {
+      SfmTrack2d& track = chunk[t];
+      size_t previous = offsets_.size();
+      for (size_t m = start[t0 + t]; m < start[t0 + t + 1]; m++) {
+        const size_t x = members[m];
+        const size_t i =
+            std::upper_bound(offsets_.begin(), offsets_.end(), x) -
+            offsets_.begin() - 1;
+        // Repeated image means an inconsistent track, as in hasUniqueCameras.
+        if (i == previous) {
+          valid[t] = false;
+          return;
+        }
+        previous = i;
+        track.addMeasurement(i, keypoints[i].coordinates.row(x - offsets_[i]));
+      }
+    });
+    for (size_t t = 0; t < t1 - t0; t++) {
+      if (valid[t])
+        sink(std::move(chunk[t]));
+      else
+        ++nrDiscarded;
+    }
+  }
+  return nrDiscarded;
+}
+
+/* ************************************************************************* */
+std::vector<SfmTrack2d> ConcurrentTrackBuilder::tracks(
+    const KeypointsVector& keypoints, bool verbose) {
+  std::vector<SfmTrack2d> result;
+  const size_t nrDiscarded = forEachTrack(
+      keypoints, [&result](SfmTrack2d&& track) {
+        result.push_back(std::move(track));
+      });
+  if (verbose) {
+    const size_t nrTracks = result.size() + nrDiscarded;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Concurrent Union-Find: "
+              << (nrTracks ? 100.0 * nrDiscarded / nrTracks : 0.0);
+    std::cout << "% of tracks discarded from multiple obs. in a single image."
+              << std::endl;
+  }
+  return result;
+}
+
 }  // namespace gtsfm
 
 }  // namespace gtsam
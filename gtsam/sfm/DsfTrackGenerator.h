@@ -17,10 +17,12 @@
  */
 
 #pragma once
+#include <gtsam/base/ConcurrentDSF.h>
 #include <gtsam/base/DSFMap.h>
 #include <gtsam/sfm/SfmTrack.h>
 
 #include <Eigen/Core>
+#include <functional>
 #include <map>
 #include <optional>
 #include <vector>
@@ -73,6 +75,69 @@ std::vector<SfmTrack2d> GTSAM_EXPORT tracksFromPairwiseMatches(
     const MatchIndicesMap& matches, const KeypointsVector& keypoints,
     bool verbose = false);
 
+/**
+ * @brief Builds tracks from pairwise matches that arrive in batches, using
+ * a concurrent union-find over dense keypoint ids.
+ *
+ * Every detection (i,k) gets the id offset(i) + k, and the ids are merged in a
+ * ConcurrentDSF, so different threads can add matches at the same time
+ * without locks.
+ *
+ * The matches themselves are not stored: memory is proportional to the
+ * number of keypoints, not to the number of correspondences, so matches can
+ * be streamed in and dropped batch by batch. The tracks and their filtering
+ * are the same as those of tracksFromPairwiseMatches, which drops tracks with
+ * two detections in one image, but they are ordered by their first detection
+ * (image, then keypoint), whereas tracksFromPairwiseMatches orders them by
+ * the root of their set, which depends on the order of the unions.
+ *
+ * Example:
+ *   ConcurrentTrackBuilder builder(keypoints);
+ *   for (const MatchIndicesMap& batch : batches) builder.addMatches(batch);
+ *   builder.forEachTrack(keypoints, [&](SfmTrack2d&& track) {...});
+ */
+class GTSAM_EXPORT ConcurrentTrackBuilder {
+ public:
+  /// Create from the number of keypoints in each image.
+  explicit ConcurrentTrackBuilder(const std::vector<size_t>& nrKeypoints);
+
+  /// Create from the keypoints of each image, only their number is used.
+  explicit ConcurrentTrackBuilder(const KeypointsVector& keypoints);
+
+  /// Total number of keypoints over all images.
+  size_t nrKeypoints() const { return dsf_.size(); }
+
+  /**
+   * Add the matches between images i1 and i2. This is thread-safe, and can
+   * be called concurrently for different (or the same) image pairs.
+   */
+  void addMatches(const IndexPair& pair, const CorrespondenceIndices& matches);
+
+  /// Add a batch of matches, processing image pairs in parallel.
+  void addMatches(const MatchIndicesMap& matches);
+
+  /**
+   * Call `sink` with every valid track, in order of their first detection.
+   * Tracks are assembled in parallel, in chunks of at most `chunkSize` tracks,
+   * so only one chunk of tracks is held in memory at any time.
+   * @return the number of tracks discarded for repeated images.
+   */
+  size_t forEachTrack(const KeypointsVector& keypoints,
+                      const std::function<void(SfmTrack2d&&)>& sink,
+                      size_t chunkSize = 4096);
+
+  /// Collect all valid tracks, see forEachTrack.
+  std::vector<SfmTrack2d> tracks(const KeypointsVector& keypoints,
+                                 bool verbose = false);
+
+ private:
+  std::vector<size_t> offsets_;  ///< first id of every image, and total
+  ConcurrentDSF dsf_;             ///< union-find forest over all ids
+
+  /// Dense id of detection k in image i.
+  size_t id(size_t i, size_t k) const;
+};
+
 }  // namespace gtsfm
 
 }  // namespace gtsam
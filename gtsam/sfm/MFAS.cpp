@@ -9,107 +9,57 @@
 
 #include <algorithm>
 #include <map>
+#include <queue>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
-#include <unordered_set>
 
 using namespace gtsam;
 using std::map;
 using std::pair;
 using std::unordered_map;
 using std::vector;
-using std::unordered_set;
+
+namespace {
+
+// An edge in the graph, as seen from one of its end points.
+struct Neighbor {
+  size_t node;    // index of the node at the other end
+  double weight;  // absolute weight of the edge
+};
 
 // A node in the graph.
 struct GraphNode {
-  double inWeightSum;               // Sum of absolute weights of incoming edges
-  double outWeightSum;              // Sum of absolute weights of outgoing edges
-  unordered_set<Key> inNeighbors;   // Nodes from which there is an incoming edge
-  unordered_set<Key> outNeighbors;  // Nodes to which there is an outgoing edge
+  double inWeightSum = 0;   // Sum of absolute weights of incoming edges
+  double outWeightSum = 0;  // Sum of absolute weights of outgoing edges
+  vector<Neighbor> inNeighbors;   // Nodes from which there is an incoming edge
+  vector<Neighbor> outNeighbors;  // Nodes to which there is an outgoing edge
+  bool removed = false;     // Whether the node is already in the ordering
+  size_t version = 0;       // Incremented whenever the weight sums change
+
+  // It is a root node if the inWeightSum is close to zero.
+  bool isRoot() const { return inWeightSum < 1e-8; }
 
   // Heuristic for the node that is to select nodes in MFAS.
   double heuristic() const { return (outWeightSum + 1) / (inWeightSum + 1); }
 };
 
-// A graph is a map from key to GraphNode. This function returns the graph from
-// the edgeWeights between keys.
-unordered_map<Key, GraphNode> graphFromEdges(
-    const map<MFAS::KeyPair, double>& edgeWeights) {
-  unordered_map<Key, GraphNode> graph;
-
-  for (const auto& edgeWeight : edgeWeights) {
-    // The weights can be either negative or positive. The direction of the edge
-    // is the direction of positive weight. This means that the edges is from
-    // edge.first -> edge.second if weight is positive and edge.second ->
-    // edge.first if weight is negative.
-    const MFAS::KeyPair& edge = edgeWeight.first;
-    const double& weight = edgeWeight.second;
-
-    Key edgeSource = weight >= 0 ? edge.first : edge.second;
-    Key edgeDest = weight >= 0 ? edge.second : edge.first;
-
-    // Update the in weight and neighbors for the destination.
-    graph[edgeDest].inWeightSum += std::abs(weight);
-    graph[edgeDest].inNeighbors.insert(edgeSource);
-
-    // Update the out weight and neighbors for the source.
-    graph[edgeSource].outWeightSum += std::abs(weight);
-    graph[edgeSource].outNeighbors.insert(edgeDest);
+// Candidate for the next node in the ordering: root nodes come first, then
+// nodes with a higher heuristic, and ties go to the smaller key. Candidates
+// are not updated in place, but pushed again with a newer version.
+struct Candidate {
+  bool isRoot;
+  double heuristic;
+  Key key;
+  size_t node, version;
+
+  bool operator<(const Candidate& other) const {
+    return std::tie(isRoot, heuristic, other.key) <
+           std::tie(other.isRoot, other.heuristic, key);
   }
-  return graph;
-}
-
-// Selects the next node in the ordering from the graph.
-Key selectNextNodeInOrdering(const unordered_map<Key, GraphNode>& graph) {
-  // Find the root nodes in the graph.
-  for (const auto& keyNode : graph) {
-    // It is a root node if the inWeightSum is close to zero.
-    if (keyNode.second.inWeightSum < 1e-8) {
-      // TODO(akshay-krishnan) if there are multiple roots, it is better to
-      // choose the one with highest heuristic. This is missing in the 1dsfm
-      // solution.
-      return keyNode.first;
-    }
-  }
-  // If there are no root nodes, return the node with the highest heuristic.
-  return std::max_element(graph.begin(), graph.end(),
-                          [](const std::pair<Key, GraphNode>& keyNode1,
-                             const std::pair<Key, GraphNode>& keyNode2) {
-                            return keyNode1.second.heuristic() <
-                                   keyNode2.second.heuristic();
-                          })
-      ->first;
-}
-
-// Returns the absolute weight of the edge between node1 and node2.
-double absWeightOfEdge(const Key key1, const Key key2,
-                       const map<MFAS::KeyPair, double>& edgeWeights) {
-  // Check the direction of the edge before returning.
-  return edgeWeights.find(MFAS::KeyPair(key1, key2)) != edgeWeights.end()
-             ? std::abs(edgeWeights.at(MFAS::KeyPair(key1, key2)))
-             : std::abs(edgeWeights.at(MFAS::KeyPair(key2, key1)));
-}
+};
 
-// Removes a node from the graph and updates edge weights of its neighbors.
-void removeNodeFromGraph(const Key node,
-                         const map<MFAS::KeyPair, double> edgeWeights,
-                         unordered_map<Key, GraphNode>& graph) {
-  // Update the outweights and outNeighbors of node's inNeighbors
-  for (const Key neighbor : graph[node].inNeighbors) {
-    // the edge could be either (*it, choice) with a positive weight or
-    // (choice, *it) with a negative weight
-    graph[neighbor].outWeightSum -=
-        absWeightOfEdge(node, neighbor, edgeWeights);
-    graph[neighbor].outNeighbors.erase(node);
-  }
-  // Update the inWeights and inNeighbors of node's outNeighbors
-  for (const Key neighbor : graph[node].outNeighbors) {
-    graph[neighbor].inWeightSum -= absWeightOfEdge(node, neighbor, edgeWeights);
-    graph[neighbor].inNeighbors.erase(node);
-  }
-  // Erase node.
-  graph.erase(node);
-}
+}  // namespace
 
 MFAS::MFAS(const TranslationEdges& relativeTranslations,
            const Unit3& projectionDirection) {
@@ -122,18 +72,72 @@ MFAS::MFAS(const TranslationEdges& relativeTranslations,
 }
 
 KeyVector MFAS::computeOrdering() const {
-  KeyVector ordering;  // Nodes in MFAS order (result).
+  // Index the nodes, in sorted order of their keys.
+  KeyVector keys;
+  keys.reserve(2 * edgeWeights_.size());
+  for (const auto& edgeWeight : edgeWeights_) {
+    keys.push_back(edgeWeight.first.first);
+    keys.push_back(edgeWeight.first.second);
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  auto indexOf = [&keys](Key key) {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+  };
+
+  // Create the graph from the edgeWeights. The weights can be either negative
+  // or positive. The direction of the edge is the direction of positive
+  // weight. This means that the edge is from edge.first -> edge.second if
+  // weight is positive and edge.second -> edge.first if weight is negative.
+  vector<GraphNode> graph(keys.size());
+  for (const auto& [edge, weight] : edgeWeights_) {
+    size_t source = indexOf(edge.first), dest = indexOf(edge.second);
+    if (weight < 0) std::swap(source, dest);
+    graph[dest].inWeightSum += std::abs(weight);
+    graph[dest].inNeighbors.push_back({source, std::abs(weight)});
+    graph[source].outWeightSum += std::abs(weight);
+    graph[source].outNeighbors.push_back({dest, std::abs(weight)});
+  }
 
-  // A graph is an unordered map from keys to nodes. Each node contains a list
-  // of its adjacent nodes. Create the graph from the edgeWeights.
-  unordered_map<Key, GraphNode> graph = graphFromEdges(edgeWeights_);
+  // A max-heap of candidates, of which only those with the current version
+  // of their node are valid. This finds the next node in O(log E), rather
+  // than looking at all remaining nodes.
+  std::priority_queue<Candidate> candidates;
+  auto push = [&](size_t i) {
+    const GraphNode& node = graph[i];
+    candidates.push(
+        {node.isRoot(), node.heuristic(), keys[i], i, node.version});
+  };
+  for (size_t i = 0; i < graph.size(); i++) push(i);
 
   // In each iteration, one node is removed from the graph and appended to the
-  // ordering.
-  while (!graph.empty()) {
-    Key selection = selectNextNodeInOrdering(graph);
-    removeNodeFromGraph(selection, edgeWeights_, graph);
-    ordering.push_back(selection);
+  // ordering. If there are multiple roots, the one with the highest heuristic
+  // is chosen, and otherwise the node with the highest heuristic.
+  KeyVector ordering;  // Nodes in MFAS order (result).
+  ordering.reserve(keys.size());
+  while (!candidates.empty()) {
+    const Candidate candidate = candidates.top();
+    candidates.pop();
+    GraphNode& selection = graph[candidate.node];
+    if (selection.removed || candidate.version != selection.version) continue;
+
+    // Remove the node, and update the weights of its remaining neighbors.
+    selection.removed = true;
+    ordering.push_back(candidate.key);
+    for (const Neighbor& neighbor : selection.inNeighbors) {
+      GraphNode& node = graph[neighbor.node];
+      if (node.removed) continue;
+      node.outWeightSum -= neighbor.weight;
+      node.version++;
+      push(neighbor.node);
+    }
+    for (const Neighbor& neighbor : selection.outNeighbors) {
+      GraphNode& node = graph[neighbor.node];
+      if (node.removed) continue;
+      node.inWeightSum -= neighbor.weight;
+      node.version++;
+      push(neighbor.node);
+    }
   }
   return ordering;
 }
@@ -18,6 +18,8 @@
 
 #include <SymEigsSolver.h>
 #include <cmath>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/linear/PCGSolver.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
@@ -31,6 +33,7 @@
 
 #include <Eigen/Eigenvalues>
 #include <algorithm>
+#include <chrono>
 #include <complex>
 #include <iostream>
 #include <map>
@@ -39,6 +42,11 @@
 #include <vector>
 #include <cassert>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace gtsam {
 
 // In Wrappers we have no access to this so have a default ready
@@ -57,7 +65,9 @@ ShonanAveragingParameters<d>::ShonanAveragingParameters(
       beta(beta),
       gamma(gamma),
       useHuber(false),
-      certifyOptimality(true) {
+      certifyOptimality(true),
+      matrixFreeCertification(false),
+      speculativeLevels(1) {
   // By default, we will do conjugate gradient
   lm.linearSolverType = LevenbergMarquardtParams::Iterative;
 
@@ -166,26 +176,45 @@ double ShonanAveraging<d>::costAt(size_t p, const Values &values) const {
   return graph.error(values);
 }
 
+/* ************************************************************************* */
+// Anchor prior is added here as depends on initial value (and cost is zero)
+template <size_t d>
+static void addAnchorPrior(size_t p,
+                           const ShonanAveragingParameters<d> &parameters,
+                           NonlinearFactorGraph *graph) {
+  if (parameters.alpha > 0) {
+    const size_t dim = SOn::Dimension(p);
+    const auto [i, value] = parameters.anchor;
+    auto model = noiseModel::Isotropic::Precision(dim, parameters.alpha);
+    graph->emplace_shared<PriorFactor<SOn>>(i, SOn::Lift(p, value.matrix()),
+                                            model);
+  }
+}
+
 /* ************************************************************************* */
 template <size_t d>
 std::shared_ptr<LevenbergMarquardtOptimizer>
 ShonanAveraging<d>::createOptimizerAt(size_t p, const Values &initial) const {
   // Build graph
   NonlinearFactorGraph graph = buildGraphAt(p);
+  addAnchorPrior(p, parameters_, &graph);
 
-  // Anchor prior is added here as depends on initial value (and cost is zero)
-  if (parameters_.alpha > 0) {
-    const size_t dim = SOn::Dimension(p);
-    const auto [i, value] = parameters_.anchor;
-    auto model = noiseModel::Isotropic::Precision(dim, parameters_.alpha);
-    graph.emplace_shared<PriorFactor<SOn>>(i, SOn::Lift(p, value.matrix()),
-                                           model);
-  }
   // Optimize
   return std::make_shared<LevenbergMarquardtOptimizer>(graph, initial,
                                                          parameters_.lm);
 }
 
+/* ************************************************************************* */
+template <size_t d>
+std::shared_ptr<LevenbergMarquardtOptimizer>
+ShonanAveraging<d>::createOptimizerAt(size_t p, const Values &initial,
+                                      const Ordering &ordering) const {
+  NonlinearFactorGraph graph = buildGraphAt(p);
+  addAnchorPrior(p, parameters_, &graph);
+  return std::make_shared<LevenbergMarquardtOptimizer>(graph, initial, ordering,
+                                                         parameters_.lm);
+}
+
 /* ************************************************************************* */
 template <size_t d>
 Values ShonanAveraging<d>::tryOptimizingAt(size_t p,
@@ -595,6 +624,93 @@ struct MatrixProdFunctor {
   }
 };
 
+// Call f(j) for all j in [0, n), in parallel if TBB is enabled.
+template <typename F>
+static void parallelFor(size_t n, const F &f) {
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                    [&f](const tbb::blocked_range<size_t> &range) {
+                      for (size_t j = range.begin(); j != range.end(); ++j)
+                        f(j);
+                    });
+#else
+  for (size_t j = 0; j < n; ++j) f(j);
+#endif
+}
+
+/** Matrix-free version of MatrixProdFunctor for the certificate matrix
+ * A = Lambda - Q. Only the d*d diagonal blocks of Lambda are stored, Q is
+ * applied one column at a time (it is symmetric), and the block rows of the
+ * product are computed in parallel if TBB is enabled. This avoids assembling
+ * Lambda and A, which dominates certification time on large problems. */
+template <size_t d>
+struct CertificateOperator {
+  using Block = Eigen::Matrix<double, d, d>;
+
+  // Const reference to the measurement matrix Q
+  const Sparse &Q_;
+
+  // Diagonal blocks of Lambda
+  std::vector<Block, Eigen::aligned_allocator<Block>> lambda_;
+
+  // Constructor computes the blocks of Lambda(S), cf. computeLambda
+  CertificateOperator(const Sparse &Q, const Matrix &S)
+      : Q_(Q), lambda_(Q.cols() / d) {
+    const size_t p = S.rows();
+    parallelFor(lambda_.size(), [&](size_t j) {
+      const size_t dj = d * j;
+      Block B;
+      Vector QSt(p);
+      for (size_t r = 0; r < d; r++) {
+        // Row dj+r of Q*S', using that Q is symmetric
+        QSt.setZero();
+        for (Sparse::InnerIterator it(Q_, dj + r); it; ++it)
+          QSt += it.value() * S.col(it.row());
+        B.row(r) = QSt.transpose() * S.middleCols<d>(dj);
+      }
+      lambda_[j] = 0.5 * (B + B.transpose());
+    });
+  }
+
+  int rows() const { return Q_.rows(); }
+  int cols() const { return Q_.cols(); }
+
+  // Matrix-vector multiplication operation y = A x
+  void perform_op(const double *x, double *y) const {
+    Eigen::Map<const Vector> X(x, rows());
+    Eigen::Map<Vector> Y(y, rows());
+    parallelFor(lambda_.size(), [&](size_t j) {
+      const size_t dj = d * j;
+      Y.segment<d>(dj) = lambda_[j] * X.segment<d>(dj);
+      for (size_t r = 0; r < d; r++) {
+        double QX = 0;
+        for (Sparse::InnerIterator it(Q_, dj + r); it; ++it)
+          QX += it.value() * X(it.row());
+        Y(dj + r) -= QX;
+      }
+    });
+  }
+};
+
+/// Shifted operator y = (A + sigma*I) x, for any operator with perform_op.
+template <class Operator>
+struct ShiftedOperator {
+  const Operator &A_;
+  double sigma_;
+
+  ShiftedOperator(const Operator &A, double sigma) : A_(A), sigma_(sigma) {}
+
+  int rows() const { return A_.rows(); }
+  int cols() const { return A_.cols(); }
+
+  void perform_op(const double *x, double *y) const {
+    A_.perform_op(x, y);
+    Eigen::Map<const Vector> X(x, rows());
+    Eigen::Map<Vector> Y(y, rows());
+    Y += sigma_ * X;
+  }
+};
+
 /// Function to compute the minimum eigenvalue of A using Lanczos in Spectra.
 /// This does 2 things:
 ///
@@ -622,17 +738,24 @@ struct MatrixProdFunctor {
 //   - We've been using 10^-4 for the nonnegativity tolerance
 //   - for numLanczosVectors, 20 is a good default value
 
+//   - warmStart, if given, is the minimum eigenvector from the previous level
+//   of the staircase, and is used instead of a random perturbation of S
+
+template <class Operator>
 static bool SparseMinimumEigenValue(
-    const Sparse &A, const Matrix &S, double *minEigenValue,
+    const Operator &A, const Matrix &S, double *minEigenValue,
     Vector *minEigenVector = 0, size_t *numIterations = 0,
+    const Vector *warmStart = 0, std::mt19937 *rng = 0,
     size_t maxIterations = 1000,
     double minEigenvalueNonnegativityTolerance = 10e-4,
     Eigen::Index numLanczosVectors = 20) {
+  const Eigen::Index n = A.rows();
+
   // a. Estimate the largest-magnitude eigenvalue of this matrix using Lanczos
-  MatrixProdFunctor lmOperator(A);
+  ShiftedOperator<Operator> lmOperator(A, 0);
   Spectra::SymEigsSolver<double, Spectra::SELECT_EIGENVALUE::LARGEST_MAGN,
-                         MatrixProdFunctor>
-      lmEigenValueSolver(&lmOperator, 1, std::min(numLanczosVectors, A.rows()));
+                         ShiftedOperator<Operator>>
+      lmEigenValueSolver(&lmOperator, 1, std::min(numLanczosVectors, n));
   lmEigenValueSolver.init();
 
   const int lmConverged = lmEigenValueSolver.compute(
@@ -662,12 +785,12 @@ static bool SparseMinimumEigenValue(
   //  A - 2*lambda_max*I is minEigenValue - 2*lambda_max, with corresponding
   // eigenvector v_min
 
-  MatrixProdFunctor minShiftedOperator(A, -2 * lmEigenValue);
+  ShiftedOperator<Operator> minShiftedOperator(A, -2 * lmEigenValue);
 
   Spectra::SymEigsSolver<double, Spectra::SELECT_EIGENVALUE::LARGEST_MAGN,
-                         MatrixProdFunctor>
+                         ShiftedOperator<Operator>>
       minEigenValueSolver(&minShiftedOperator, 1,
-                          std::min(numLanczosVectors, A.rows()));
+                          std::min(numLanczosVectors, n));
 
   // If S is a critical point of F, then S^T is also in the null space of S -
   // Lambda(S) (cf. Lemma 6 of the tech report), and therefore its rows are
@@ -682,9 +805,21 @@ static bool SparseMinimumEigenValue(
   // the relaxation is exact (since are starting close to a solution), while
   // simultaneously allowing the iterations to escape from this fixed point in
   // the case that the relaxation is not exact.
+  // When climbing the staircase, the minimum eigenvector of the previous level
+  // is a better direction to perturb in than a random one. A random direction
+  // is drawn from rng if given, as std::rand is not safe to share between
+  // threads.
   Vector v0 = S.row(0).transpose();
   Vector perturbation(v0.size());
-  perturbation.setRandom();
+  if (warmStart && warmStart->size() == v0.size() && warmStart->norm() > 0) {
+    perturbation = *warmStart;
+  } else if (rng) {
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    for (Eigen::Index i = 0; i < perturbation.size(); i++)
+      perturbation[i] = uniform(*rng);
+  } else {
+    perturbation.setRandom();
+  }
   perturbation.normalize();
   Vector xinit = v0 + (.03 * v0.norm()) * perturbation;  // Perturb v0 by ~3%
 
@@ -712,13 +847,24 @@ static bool SparseMinimumEigenValue(
 /* ************************************************************************* */
 template <size_t d>
 double ShonanAveraging<d>::computeMinEigenValue(const Values &values,
-                                                Vector *minEigenVector) const {
+                                                Vector *minEigenVector,
+                                                const Vector *warmStart,
+                                                std::mt19937 *rng) const {
+  gttic(ShonanAveraging_computeMinEigenValue);
   assert(values.size() == nrUnknowns());
   const Matrix S = StiefelElementMatrix(values);
-  auto A = computeA(S);
 
   double minEigenValue;
-  bool success = SparseMinimumEigenValue(A, S, &minEigenValue, minEigenVector);
+  bool success;
+  if (parameters_.getMatrixFreeCertification()) {
+    const CertificateOperator<d> A(Q_, S);
+    success = SparseMinimumEigenValue(A, S, &minEigenValue, minEigenVector, 0,
+                                      warmStart, rng);
+  } else {
+    const Sparse A = computeA(S);
+    success = SparseMinimumEigenValue(MatrixProdFunctor(A), S, &minEigenValue,
+                                      minEigenVector, 0, warmStart, rng);
+  }
   if (!success) {
     throw std::runtime_error(
         "SparseMinimumEigenValue failed to compute minimum eigenvalue.");
@@ -885,43 +1031,114 @@ Values ShonanAveraging<d>::initializeRandomlyAt(size_t p) const {
   return initializeRandomlyAt(p, kRandomNumberGenerator);
 }
 
+/* ************************************************************************* */
+// Lift Rot values to SO(p) and perturb them randomly in all p dimensions, so
+// that the optimization does not stay in the embedded SO(d) subspace.
+template <typename Rot>
+static Values PerturbedLift(size_t p, const Values &values, double sigma,
+                            std::mt19937 &rng) {
+  std::normal_distribution<double> randomNormal(0.0, sigma);
+  Values lifted;
+  for (const auto &it : values.extract<Rot>()) {
+    Vector xi(SOn::Dimension(p));
+    for (Eigen::Index k = 0; k < xi.size(); k++) xi(k) = randomNormal(rng);
+    lifted.insert(it.first,
+                  SOn::Lift(p, it.second.matrix()) * SOn::Retract(xi));
+  }
+  return lifted;
+}
+
 /* ************************************************************************* */
 template <size_t d>
-std::pair<Values, double> ShonanAveraging<d>::run(const Values &initialEstimate,
-                                                  size_t pMin,
-                                                  size_t pMax) const {
+std::pair<Values, double> ShonanAveraging<d>::run(
+    const Values &initialEstimate, size_t pMin, size_t pMax,
+    std::vector<LevelStatistics> *statistics) const {
+  using Clock = std::chrono::steady_clock;
   if (pMin < d) {
     throw std::runtime_error("pMin is smaller than the base dimension d");
   }
-  Values Qstar;
+  const bool certify =
+      !parameters_.getUseHuber() && parameters_.getCertifyOptimality();
+  if (!certify && pMin != pMax) {
+    // in this case, there is no optimality certification
+    throw std::runtime_error(
+        "When using robust norm, Shonan only tests a single rank. Set pMin = pMax");
+  }
+
+  // The graph has the same topology at every level, so compute the ordering
+  // once rather than in every iteration of every level.
+  const Ordering ordering =
+      parameters_.lm.ordering
+          ? *parameters_.lm.ordering
+          : Ordering::Create(parameters_.lm.orderingType, buildGraphAt(pMin));
+
+  // Result of optimizing and certifying one level
+  struct Level {
+    Values Qstar;
+    Vector minEigenVector;
+    LevelStatistics statistics;
+  };
+
   Values initialSOp = LiftTo<Rot>(pMin, initialEstimate);  // lift to pMin!
-  for (size_t p = pMin; p <= pMax; p++) {
-    // Optimize until convergence at this level
-    Qstar = tryOptimizingAt(p, initialSOp);
-    if (parameters_.getUseHuber() || !parameters_.getCertifyOptimality()) {
-      // in this case, there is no optimality certification
-      if (pMin != pMax) {
-        throw std::runtime_error(
-            "When using robust norm, Shonan only tests a single rank. Set pMin = pMax");
+  Vector minEigenVector;  // warm-starts the certificate at the next level
+  for (size_t p = pMin; p <= pMax;) {
+    // Levels p+1 and up, if any, start from a perturbed initial estimate.
+    const size_t nrLevels = std::min(
+        std::max<size_t>(parameters_.speculativeLevels, 1), pMax - p + 1);
+    std::vector<Values> initials{initialSOp};
+    for (size_t j = 1; j < nrLevels; j++)
+      initials.push_back(PerturbedLift<Rot>(p + j, initialEstimate, 0.1,
+                                            kRandomNumberGenerator));
+
+    // Each level certifies with its own generator, seeded here, so that the
+    // levels do not share a random number generator between threads.
+    std::vector<std::mt19937::result_type> seeds(nrLevels);
+    for (auto &seed : seeds) seed = kRandomNumberGenerator();
+
+    // Optimize and certify all levels, in parallel if TBB is enabled
+    std::vector<Level> levels(nrLevels);
+    parallelFor(nrLevels, [&](size_t j) {
+      gttic(ShonanAveraging_level);
+      Level &level = levels[j];
+      const auto t0 = Clock::now();
+      auto lm = createOptimizerAt(p + j, initials[j], ordering);
+      level.Qstar = lm->optimize();
+      const auto t1 = Clock::now();
+      double minEigenValue = 0;
+      if (certify) {
+        std::mt19937 rng(seeds[j]);
+        minEigenValue = computeMinEigenValue(
+            level.Qstar, &level.minEigenVector, &minEigenVector, &rng);
       }
-      const Values SO3Values = roundSolution(Qstar);
-      return {SO3Values, 0};
-    } else {
-      // Check certificate of global optimality
-      Vector minEigenVector;
-      double minEigenValue = computeMinEigenValue(Qstar, &minEigenVector);
-      if (minEigenValue > parameters_.optimalityThreshold) {
+      const auto t2 = Clock::now();
+      level.statistics = {p + j, lm->error(), minEigenValue,
+                          std::chrono::duration<double>(t1 - t0).count(),
+                          std::chrono::duration<double>(t2 - t1).count()};
+    });
+
+    // Return the lowest level that is at the global optimum
+    if (statistics) {
+      for (const Level &level : levels)
+        statistics->push_back(level.statistics);
+    }
+    for (const Level &level : levels) {
+      const double minEigenValue = level.statistics.minEigenValue;
+      if (!certify || minEigenValue > parameters_.optimalityThreshold) {
         // If at global optimum, round and return solution
-        const Values SO3Values = roundSolution(Qstar);
+        const Values SO3Values = roundSolution(level.Qstar);
         return {SO3Values, minEigenValue};
       }
+    }
 
-      // Not at global optimimum yet, so check whether we will go to next level
-      if (p != pMax) {
-        // Calculate initial estimate for next level by following minEigenVector
-        initialSOp =
-            initializeWithDescent(p + 1, Qstar, minEigenVector, minEigenValue);
-      }
+    // Not at global optimimum yet, so check whether we will go to next level
+    const Level &top = levels.back();
+    p += nrLevels;
+    minEigenVector = top.minEigenVector;
+    if (p <= pMax) {
+      // Calculate initial estimate for next level by following minEigenVector
+      initialSOp =
+          initializeWithDescent(p, top.Qstar, minEigenVector,
+                                top.statistics.minEigenValue);
     }
   }
   throw std::runtime_error("Shonan::run did not converge for given pMax");
@@ -32,6 +32,7 @@
 
 #include <Eigen/Sparse>
 #include <map>
+#include <random>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -59,6 +60,11 @@ struct GTSAM_EXPORT ShonanAveragingParameters {
   bool useHuber;
   /// if enabled solution optimality is certified (default true)
   bool certifyOptimality;
+  /// if enabled, certify with a matrix-free, multi-threaded Lanczos operator
+  /// instead of assembling Lambda - Q as a sparse matrix (default false)
+  bool matrixFreeCertification;
+  /// number of staircase levels optimized in parallel by run() (default 1)
+  size_t speculativeLevels;
 
   ShonanAveragingParameters(const LevenbergMarquardtParams &lm =
                                 LevenbergMarquardtParams::CeresDefaults(),
@@ -90,6 +96,14 @@ struct GTSAM_EXPORT ShonanAveragingParameters {
   void setCertifyOptimality(bool value) { certifyOptimality = value; }
   bool getCertifyOptimality() const { return certifyOptimality; }
 
+  void setMatrixFreeCertification(bool value) {
+    matrixFreeCertification = value;
+  }
+  bool getMatrixFreeCertification() const { return matrixFreeCertification; }
+
+  void setSpeculativeLevels(size_t value) { speculativeLevels = value; }
+  size_t getSpeculativeLevels() const { return speculativeLevels; }
+
   /// Print the parameters and flags used for rotation averaging.
   void print(const std::string &s = "") const {
     std::cout << (s.empty() ? s : s + " ");
@@ -131,6 +145,15 @@ class GTSAM_EXPORT ShonanAveraging {
   // We store SO(d) BetweenFactors to get noise model
   using Measurements = std::vector<BinaryMeasurement<Rot>>;
 
+  /// Statistics for one level of the Riemannian staircase, see run().
+  struct LevelStatistics {
+    size_t p;              ///< dimension of SO(p) at this level
+    double cost;           ///< cost of the local minimum at this level
+    double minEigenValue;  ///< minimum eigenvalue of the certificate, or 0
+    double optimizeTime;   ///< wall time of the optimization, in seconds
+    double certifyTime;    ///< wall time of the certification, in seconds
+  };
+
  private:
   Parameters parameters_;
   Measurements measurements_;
@@ -249,9 +272,16 @@ class GTSAM_EXPORT ShonanAveraging {
   /**
    * Compute minimum eigenvalue for optimality check.
    * @param values: should be of type SOn
+   * @param minEigenVector: if given, set to the corresponding eigenvector
+   * @param warmStart: optional eigenvector from a previous staircase level,
+   * used instead of a random perturbation to start the Lanczos iterations
+   * @param rng: optional generator for the random perturbation, which otherwise
+   * uses std::rand and so is not safe to call from several threads at once
    */
   double computeMinEigenValue(const Values &values,
-                              Vector *minEigenVector = nullptr) const;
+                              Vector *minEigenVector = nullptr,
+                              const Vector *warmStart = nullptr,
+                              std::mt19937 *rng = nullptr) const;
 
   /**
    * Compute minimum eigenvalue with accelerated power method.
@@ -350,6 +380,10 @@ class GTSAM_EXPORT ShonanAveraging {
    */
   Values tryOptimizingAt(size_t p, const Values &initial) const;
 
+  /// Version of createOptimizerAt with a given elimination ordering.
+  std::shared_ptr<LevenbergMarquardtOptimizer> createOptimizerAt(
+      size_t p, const Values &initial, const Ordering &ordering) const;
+
   /**
    * Project from SO(p) to Rot2 or Rot3
    * Values should be of type SO(p)
@@ -396,13 +430,23 @@ class GTSAM_EXPORT ShonanAveraging {
 
   /**
    * Optimize at different values of p until convergence.
+   *
+   * The elimination ordering is computed once, as the graph has the same
+   * topology at every level. If parameters.speculativeLevels > 1, that many
+   * levels are optimized in parallel: level p from the usual initialization,
+   * and the levels above it from a random perturbation of the lifted initial
+   * estimate, so that a higher level can certify without waiting for the
+   * ones below it. The lowest certified level is returned.
+   *
    * @param initial initial Rot3 values
    * @param pMin value of p to start Riemanian staircase at (default: d).
    * @param pMax maximum value of p to try (default: 10)
+   * @param statistics if given, filled with timings etc. for every level
    * @return (Rot3 values, minimum eigenvalue)
    */
-  std::pair<Values, double> run(const Values &initialEstimate, size_t pMin = d,
-                                size_t pMax = 10) const;
+  std::pair<Values, double> run(
+      const Values &initialEstimate, size_t pMin = d, size_t pMax = 10,
+      std::vector<LevelStatistics> *statistics = nullptr) const;
   /// @}
 
   /**
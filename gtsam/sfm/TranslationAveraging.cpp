@@ -0,0 +1,469 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file TranslationAveraging.cpp
+ * @date October 2026
+ * @brief Global translation averaging for large SfM problems: 1DSfM outlier
+ * rejection and a dedicated solver for translation direction measurements.
+ */
+
+#include <gtsam/base/DSFVector.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+#include <gtsam/geometry/Point3.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/sfm/MFAS.h>
+#include <gtsam/sfm/TranslationAveraging.h>
+
+#include <Eigen/Sparse>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+
+using namespace std;
+
+namespace gtsam {
+
+namespace {
+
+/* ************************************************************************* */
+// Call f(j) for j in 0...n-1, in parallel if TBB is enabled.
+template <typename F>
+void parallelFor(size_t n, const F& f) {
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                    [&f](const tbb::blocked_range<size_t>& range) {
+                      for (size_t j = range.begin(); j != range.end(); ++j)
+                        f(j);
+                    });
+#else
+  for (size_t j = 0; j < n; ++j) f(j);
+#endif
+}
+
+/* ************************************************************************* */
+// Square root information matrix of a Gaussian noise model.
+Matrix3 sqrtInformation(const SharedNoiseModel& model) {
+  if (!model) return I_3x3;
+  const auto gaussian = std::dynamic_pointer_cast<noiseModel::Gaussian>(model);
+  if (!gaussian || model->dim() != 3)
+    throw invalid_argument(
+        "TranslationAveraging: edges need 3-dimensional Gaussian noise "
+        "models.");
+  return gaussian->R();
+}
+
+/* ************************************************************************* */
+// A translation averaging problem on dense indices. Keys that are connected
+// by zero-translation edges share a single variable.
+struct Problem {
+  struct Edge {
+    size_t a, b;  // variables
+    Vector3 w_aZb;
+    Matrix3 R;  // square root information
+  };
+
+  KeyVector keys;                // sorted keys of all edges
+  std::vector<size_t> variable;  // variable of every key
+  size_t nrVariables = 0;
+  std::vector<Edge> edges;  // edges between different variables
+
+  // Gauge priors, as in TranslationRecovery::addPrior.
+  size_t origin = 0, second = 0;
+  Matrix3 originR = 100 * I_3x3, secondR = I_3x3;
+  Vector3 secondPosition = Vector3::Zero();
+
+  Problem(const TranslationAveraging::TranslationEdges& relativeTranslations,
+          double scale) {
+    for (const auto& edge : relativeTranslations) {
+      keys.push_back(edge.key1());
+      keys.push_back(edge.key2());
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // Merge the end points of zero-translation edges.
+    DSFVector same(keys.size());
+    for (const auto& edge : relativeTranslations)
+      if (edge.measured().equals(Unit3(0.0, 0.0, 0.0)))
+        same.merge(indexOf(edge.key1()), indexOf(edge.key2()));
+    variable.resize(keys.size());
+    std::vector<size_t> variableOfSet(keys.size(), keys.size());
+    for (size_t k = 0; k < keys.size(); k++) {
+      size_t& v = variableOfSet[same.find(k)];
+      if (v == keys.size()) v = nrVariables++;
+      variable[k] = v;
+    }
+
+    for (const auto& edge : relativeTranslations) {
+      const size_t a = variable[indexOf(edge.key1())],
+                   b = variable[indexOf(edge.key2())];
+      if (a == b) continue;
+      if (edges.empty()) {
+        origin = a;
+        second = b;
+        secondR = sqrtInformation(edge.noiseModel());
+        secondPosition = scale * edge.measured().point3();
+      }
+      edges.push_back(
+          {a, b, edge.measured().point3(), sqrtInformation(edge.noiseModel())});
+    }
+  }
+
+  size_t indexOf(Key key) const {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+  }
+
+  std::vector<Vector3> unknowns(const Values& values) const {
+    std::vector<Vector3> x(nrVariables, Vector3::Zero());
+    for (size_t k = 0; k < keys.size(); k++)
+      if (values.exists(keys[k])) x[variable[k]] = values.at<Point3>(keys[k]);
+    return x;
+  }
+
+  Values values(const std::vector<Vector3>& x) const {
+    Values result;
+    for (size_t k = 0; k < keys.size(); k++)
+      result.insert<Point3>(keys[k], x[variable[k]]);
+    return result;
+  }
+};
+
+/* ************************************************************************* */
+// Whitened residual e and Jacobian J of an edge, so that the Jacobians with
+// respect to Ta and Tb are -J and J.
+struct EdgeLinearization {
+  Matrix3 J;
+  Vector3 e;
+};
+
+// The chordal cost of TranslationFactor: normalize(Tb - Ta) - w_aZb.
+EdgeLinearization linearizeChordal(const Problem::Edge& edge,
+                                   const std::vector<Vector3>& x) {
+  Matrix3 H;
+  const Point3 predicted = normalize(Point3(x[edge.b] - x[edge.a]), &H);
+  return {edge.R * H, edge.R * (predicted - edge.w_aZb)};
+}
+
+// The linear cost (I - w_aZb w_aZb') (Tb - Ta), the component of Tb - Ta
+// orthogonal to w_aZb.
+EdgeLinearization linearizeLinear(const Problem::Edge& edge,
+                                  const std::vector<Vector3>& x) {
+  const Matrix3 J =
+      edge.R * (I_3x3 - edge.w_aZb * edge.w_aZb.transpose());
+  return {J, J * (x[edge.b] - x[edge.a])};
+}
+
+/* ************************************************************************* */
+// The Gauss-Newton Hessian of a Problem, stored as a sparse matrix whose
+// sparsity pattern consists of 3*3 blocks, of which only the lower triangle
+// is used. The pattern and its symbolic factorization are computed once, and
+// afterwards the blocks are accumulated directly into the non-zeros.
+class BlockHessian {
+  using Sparse = Eigen::SparseMatrix<double>;
+  using Starts = std::array<Sparse::StorageIndex, 3>;
+
+  const Problem& problem_;
+  Sparse H_;
+  std::vector<Starts> diagonal_;     // start of every diagonal block column
+  std::vector<Starts> offDiagonal_;  // same, for every off-diagonal block
+  std::vector<size_t> edgeBlock_;    // off-diagonal block of every edge
+  Eigen::SimplicialLDLT<Sparse> solver_;
+
+  // Index of the non-zero (row, col) in H_.
+  Sparse::StorageIndex position(size_t row, size_t col) const {
+    const auto begin = H_.innerIndexPtr() + H_.outerIndexPtr()[col],
+               end = H_.innerIndexPtr() + H_.outerIndexPtr()[col + 1];
+    return std::lower_bound(begin, end, row) - H_.innerIndexPtr();
+  }
+
+  Starts starts(size_t i, size_t j) const {
+    return {position(3 * i, 3 * j), position(3 * i, 3 * j + 1),
+            position(3 * i, 3 * j + 2)};
+  }
+
+  void add(const Starts& starts, const Matrix3& M) {
+    double* values = H_.valuePtr();
+    for (size_t c = 0; c < 3; c++)
+      for (size_t r = 0; r < 3; r++) values[starts[c] + r] += M(r, c);
+  }
+
+ public:
+  explicit BlockHessian(const Problem& problem) : problem_(problem) {
+    const size_t n = problem.nrVariables;
+
+    // Unique pairs of variables (i, j) with i > j, one per off-diagonal block.
+    std::vector<std::pair<size_t, size_t>> pairs;
+    pairs.reserve(problem.edges.size());
+    for (const auto& edge : problem.edges)
+      pairs.emplace_back(std::max(edge.a, edge.b), std::min(edge.a, edge.b));
+    std::vector<std::pair<size_t, size_t>> blocks = pairs;
+    std::sort(blocks.begin(), blocks.end());
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(9 * (n + blocks.size()));
+    auto addBlock = [&triplets](size_t i, size_t j) {
+      for (size_t c = 0; c < 3; c++)
+        for (size_t r = 0; r < 3; r++)
+          triplets.emplace_back(3 * i + r, 3 * j + c, 0.0);
+    };
+    for (size_t i = 0; i < n; i++) addBlock(i, i);
+    for (const auto& [i, j] : blocks) addBlock(i, j);
+    H_.resize(3 * n, 3 * n);
+    H_.setFromTriplets(triplets.begin(), triplets.end());
+    H_.makeCompressed();
+
+    diagonal_.resize(n);
+    for (size_t i = 0; i < n; i++) diagonal_[i] = starts(i, i);
+    offDiagonal_.resize(blocks.size());
+    for (size_t k = 0; k < blocks.size(); k++)
+      offDiagonal_[k] = starts(blocks[k].first, blocks[k].second);
+    edgeBlock_.resize(pairs.size());
+    for (size_t k = 0; k < pairs.size(); k++)
+      edgeBlock_[k] =
+          std::lower_bound(blocks.begin(), blocks.end(), pairs[k]) -
+          blocks.begin();
+
+    solver_.analyzePattern(H_);
+  }
+
+  /**
+   * Accumulate the Hessian and the gradient g = J'e of the edges and the
+   * gauge priors, at x.
+   * @return the values of the non-zeros, to be passed to solve().
+   */
+  std::vector<double> accumulate(
+      const std::vector<EdgeLinearization>& linearizations,
+      const std::vector<Vector3>& x, Vector* g) {
+    std::fill(H_.valuePtr(), H_.valuePtr() + H_.nonZeros(), 0.0);
+    g->setZero(3 * problem_.nrVariables);
+    for (size_t k = 0; k < linearizations.size(); k++) {
+      const auto& edge = problem_.edges[k];
+      const auto& [J, e] = linearizations[k];
+      const Matrix3 W = J.transpose() * J;
+      const Vector3 Je = J.transpose() * e;
+      add(diagonal_[edge.a], W);
+      add(diagonal_[edge.b], W);
+      add(offDiagonal_[edgeBlock_[k]], -W);
+      g->segment<3>(3 * edge.a) -= Je;
+      g->segment<3>(3 * edge.b) += Je;
+    }
+    auto addPrior = [&](size_t i, const Matrix3& R, const Vector3& mean) {
+      add(diagonal_[i], R.transpose() * R);
+      g->segment<3>(3 * i) += R.transpose() * (R * (x[i] - mean));
+    };
+    addPrior(problem_.origin, problem_.originR, Vector3::Zero());
+    addPrior(problem_.second, problem_.secondR, problem_.secondPosition);
+    return std::vector<double>(H_.valuePtr(), H_.valuePtr() + H_.nonZeros());
+  }
+
+  /**
+   * Solve (H + lambda I) delta = -g, with H given by the non-zeros returned
+   * from accumulate().
+   * @return false if the factorization failed.
+   */
+  bool solve(const std::vector<double>& values, double lambda, const Vector& g,
+             Vector* delta) {
+    std::copy(values.begin(), values.end(), H_.valuePtr());
+    for (const Starts& starts : diagonal_)
+      for (size_t c = 0; c < 3; c++) H_.valuePtr()[starts[c] + c] += lambda;
+    solver_.factorize(H_);
+    if (solver_.info() != Eigen::Success) return false;
+    *delta = solver_.solve(-g);
+    return solver_.info() == Eigen::Success && delta->allFinite();
+  }
+};
+
+/* ************************************************************************* */
+// Linearize all edges, in parallel if TBB is enabled.
+template <typename LINEARIZE>
+std::vector<EdgeLinearization> linearizeEdges(const Problem& problem,
+                                              const std::vector<Vector3>& x,
+                                              LINEARIZE linearize) {
+  std::vector<EdgeLinearization> linearizations(problem.edges.size());
+  parallelFor(problem.edges.size(), [&](size_t k) {
+    linearizations[k] = linearize(problem.edges[k], x);
+  });
+  return linearizations;
+}
+
+// The chordal cost 0.5 * sum |e|^2, including the gauge priors.
+double chordalError(const Problem& problem, const std::vector<Vector3>& x) {
+  std::vector<double> errors(problem.edges.size());
+  parallelFor(problem.edges.size(), [&](size_t k) {
+    const auto& edge = problem.edges[k];
+    const Point3 predicted = normalize(Point3(x[edge.b] - x[edge.a]));
+    errors[k] = (edge.R * (predicted - edge.w_aZb)).squaredNorm();
+  });
+  double error = 0;
+  for (double e : errors) error += e;
+  error += (problem.originR * x[problem.origin]).squaredNorm();
+  error += (problem.secondR * (x[problem.second] - problem.secondPosition))
+               .squaredNorm();
+  return 0.5 * error;
+}
+
+std::vector<Vector3> retract(const std::vector<Vector3>& x,
+                             const Vector& delta) {
+  std::vector<Vector3> result(x.size());
+  for (size_t i = 0; i < x.size(); i++)
+    result[i] = x[i] + delta.segment<3>(3 * i);
+  return result;
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+std::vector<double> TranslationAveraging::computeOutlierWeights(
+    const TranslationEdges& relativeTranslations) const {
+  const size_t m = parameters_.nrProjectionDirections;
+  std::vector<double> outlierWeights(relativeTranslations.size(), 0.0);
+  if (m == 0) return outlierWeights;
+
+  std::mt19937 rng(parameters_.seed);
+  std::vector<Unit3> directions;
+  for (size_t d = 0; d < m; d++) directions.push_back(Unit3::Random(rng));
+
+  // Every direction is an independent MFAS problem.
+  std::mutex mutex;
+  parallelFor(m, [&](size_t d) {
+    const MFAS mfas(relativeTranslations, directions[d]);
+    const auto weights = mfas.computeOutlierWeights();
+    std::vector<double> edgeWeights(relativeTranslations.size());
+    for (size_t k = 0; k < relativeTranslations.size(); k++) {
+      const auto& edge = relativeTranslations[k];
+      edgeWeights[k] = weights.at({edge.key1(), edge.key2()});
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t k = 0; k < edgeWeights.size(); k++)
+      outlierWeights[k] += edgeWeights[k];
+  });
+
+  for (double& weight : outlierWeights) weight /= m;
+  return outlierWeights;
+}
+
+/* ************************************************************************* */
+TranslationAveraging::TranslationEdges TranslationAveraging::rejectOutliers(
+    const TranslationEdges& relativeTranslations) const {
+  const std::vector<double> outlierWeights =
+      computeOutlierWeights(relativeTranslations);
+  TranslationEdges inliers;
+  for (size_t k = 0; k < relativeTranslations.size(); k++)
+    if (outlierWeights[k] <= parameters_.outlierThreshold)
+      inliers.push_back(relativeTranslations[k]);
+  return inliers;
+}
+
+/* ************************************************************************* */
+Values TranslationAveraging::initialize(
+    const TranslationEdges& relativeTranslations, double scale) const {
+  const Problem problem(relativeTranslations, scale);
+  std::vector<Vector3> x(problem.nrVariables, Vector3::Zero());
+  if (problem.edges.empty()) return problem.values(x);
+
+  // The cost is linear, so a single Gauss-Newton step from zero solves it.
+  BlockHessian hessian(problem);
+  Vector g, delta;
+  const auto values =
+      hessian.accumulate(linearizeEdges(problem, x, linearizeLinear), x, &g);
+  if (!hessian.solve(values, 0.0, g, &delta))
+    throw runtime_error(
+        "TranslationAveraging::initialize: the problem is not well-posed, "
+        "is the graph connected?");
+  return problem.values(retract(x, delta));
+}
+
+/* ************************************************************************* */
+Values TranslationAveraging::optimize(
+    const TranslationEdges& relativeTranslations, const Values& initial,
+    double scale) const {
+  const Problem problem(relativeTranslations, scale);
+  std::vector<Vector3> x = problem.unknowns(initial);
+  if (problem.edges.empty()) return problem.values(x);
+
+  BlockHessian hessian(problem);
+  double error = chordalError(problem, x);
+  double lambda = parameters_.lambdaInitial, lambdaFactor = 2.0;
+  const double lambdaUpperBound = 1e5, minModelFidelity = 1e-3;
+  Vector g, delta;
+  for (size_t iteration = 0; iteration < parameters_.maxIterations;
+       iteration++) {
+    const auto values = hessian.accumulate(
+        linearizeEdges(problem, x, linearizeChordal), x, &g);
+
+    // Increase lambda until the step decreases the error. Lambda is updated
+    // with the model fidelity as in LevenbergMarquardtOptimizer, which
+    // avoids most of the rejected steps, i.e., wasted factorizations.
+    bool accepted = false, converged = false;
+    while (!accepted && !converged && lambda <= lambdaUpperBound) {
+      if (hessian.solve(values, lambda, g, &delta)) {
+        // With (H + lambda I) delta = -g, the decrease of the linearized
+        // cost -g'delta - delta'H delta/2 simplifies to:
+        const double linearizedCostChange =
+            0.5 * (lambda * delta.squaredNorm() - g.dot(delta));
+        std::vector<Vector3> newX = retract(x, delta);
+        const double newError = chordalError(problem, newX);
+        const double costChange = error - newError;
+        // Stop if the change in cost is tiny, whether the step is taken or
+        // not, as in LevenbergMarquardtOptimizer.
+        converged =
+            std::abs(costChange) <= parameters_.absoluteErrorTol ||
+            std::abs(costChange) <= parameters_.relativeErrorTol * error;
+        if (linearizedCostChange > 0 &&
+            costChange > minModelFidelity * linearizedCostChange) {
+          const double fidelity = costChange / linearizedCostChange;
+          lambda *= std::max(1.0 / 3.0, 1.0 - std::pow(2 * fidelity - 1, 3));
+          lambdaFactor = 2.0;
+          x.swap(newX);
+          error = newError;
+          accepted = true;
+        }
+        if (accepted || converged) continue;
+      }
+      lambda *= lambdaFactor;
+      lambdaFactor *= 2;
+    }
+    if (!accepted || converged) break;
+  }
+  return problem.values(x);
+}
+
+/* ************************************************************************* */
+Values TranslationAveraging::run(
+    const TranslationEdges& relativeTranslations, double scale) const {
+  TranslationEdges inliers;
+  {
+    gttic(rejectOutliers);
+    inliers = parameters_.nrProjectionDirections > 0
+                  ? rejectOutliers(relativeTranslations)
+                  : relativeTranslations;
+  }
+  Values initial;
+  {
+    gttic(initialize);
+    initial = initialize(inliers, scale);
+  }
+  gttic(optimize);
+  return optimize(inliers, initial, scale);
+}
+
+}  // namespace gtsam
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file TranslationAveraging.h
+ * @date October 2026
+ * @brief Global translation averaging for large SfM problems: 1DSfM outlier
+ * rejection and a dedicated solver for translation direction measurements.
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Unit3.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/sfm/BinaryMeasurement.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+/// Parameters for TranslationAveraging.
+struct GTSAM_EXPORT TranslationAveragingParameters {
+  /// Number of random projection directions used for 1DSfM outlier
+  /// rejection, zero to keep all edges.
+  size_t nrProjectionDirections = 0;
+
+  /// An edge is rejected if its MFAS outlier weight, averaged over all
+  /// projection directions, is larger than this threshold.
+  double outlierThreshold = 0.1;
+
+  /// Seed of the random number generator for the projection directions.
+  std::uint64_t seed = 42;
+
+  size_t maxIterations = 100;      ///< maximum Levenberg-Marquardt iterations
+  double relativeErrorTol = 1e-5;  ///< relative decrease in error to stop
+  double absoluteErrorTol = 1e-5;  ///< absolute decrease in error to stop
+  double lambdaInitial = 1e-5;     ///< initial Levenberg-Marquardt damping
+};
+
+/**
+ * Global translation averaging, i.e., recovering camera positions from
+ * translation directions w_aZb between them, as in TranslationRecovery, but
+ * specialized so it scales to tens of thousands of cameras:
+ *  - Outlier edges are rejected with 1DSfM, i.e., MFAS along many random
+ *    projection directions, which are processed in parallel.
+ *  - Positions are initialized by the linear method, which minimizes the
+ *    components of Tb - Ta orthogonal to w_aZb, instead of randomly.
+ *  - The chordal cost of TranslationFactor is minimized with
+ *    Levenberg-Marquardt on flat arrays of 3-vectors, with the sparsity
+ *    pattern of the 3*3 blocks of the Hessian and its symbolic factorization
+ *    computed only once, rather than through NonlinearFactorGraph and Values.
+ *
+ * The gauge is fixed as in TranslationRecovery::addPrior: the first key of the
+ * first edge is at the origin, and the second one at scale * w_aZb. Edges with
+ * a zero translation direction merge their two end points into one.
+ * Edge noise models must be Gaussian, robust noise models are not supported.
+ * @ingroup sfm
+ */
+class GTSAM_EXPORT TranslationAveraging {
+ public:
+  using KeyPair = std::pair<Key, Key>;
+  using TranslationEdges = std::vector<BinaryMeasurement<Unit3>>;
+  using Parameters = TranslationAveragingParameters;
+
+ private:
+  Parameters parameters_;
+
+ public:
+  /// Construct with the given parameters.
+  explicit TranslationAveraging(const Parameters& parameters = Parameters())
+      : parameters_(parameters) {}
+
+  /// Return the parameters.
+  const Parameters& parameters() const { return parameters_; }
+
+  /**
+   * MFAS outlier weight of every edge, averaged over
+   * parameters().nrProjectionDirections random projection directions. The
+   * directions are processed in parallel if TBB is enabled.
+   * @return one weight per edge, in the order of relativeTranslations.
+   */
+  std::vector<double> computeOutlierWeights(
+      const TranslationEdges& relativeTranslations) const;
+
+  /// Return the edges whose averaged outlier weight is at most the threshold.
+  TranslationEdges rejectOutliers(
+      const TranslationEdges& relativeTranslations) const;
+
+  /**
+   * Linear initialization: minimizes the sum of squared (whitened) components
+   * of Tb - Ta orthogonal to w_aZb, with the gauge fixed as described above.
+   */
+  Values initialize(const TranslationEdges& relativeTranslations,
+                    double scale = 1.0) const;
+
+  /// Minimize the chordal cost with Levenberg-Marquardt, from initial.
+  Values optimize(const TranslationEdges& relativeTranslations,
+                  const Values& initial, double scale = 1.0) const;
+
+  /// Reject outliers (if enabled), initialize, and optimize.
+  Values run(const TranslationEdges& relativeTranslations,
+             double scale = 1.0) const;
+};
+
+}  // namespace gtsam
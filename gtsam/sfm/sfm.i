@@ -176,6 +176,10 @@ class ShonanAveragingParameters {
   bool getUseHuber() const;
   void setCertifyOptimality(bool value);
   bool getCertifyOptimality() const;
+  void setMatrixFreeCertification(bool value);
+  bool getMatrixFreeCertification() const;
+  void setSpeculativeLevels(size_t value);
+  size_t getSpeculativeLevels() const;
 };
 
 // NOTE(Varun): Not templated because each class has specializations defined.
@@ -327,6 +331,35 @@ class TranslationRecovery {
                     const double scale = 1.0) const;
 };
 
+#include <gtsam/sfm/TranslationAveraging.h>
+
+class TranslationAveragingParameters {
+  TranslationAveragingParameters();
+  size_t nrProjectionDirections;
+  double outlierThreshold;
+  uint64_t seed;
+  size_t maxIterations;
+  double relativeErrorTol;
+  double absoluteErrorTol;
+  double lambdaInitial;
+};
+
+class TranslationAveraging {
+  TranslationAveraging();
+  TranslationAveraging(const gtsam::TranslationAveragingParameters& parameters);
+  const gtsam::TranslationAveragingParameters& parameters() const;
+  gtsam::BinaryMeasurementsUnit3 rejectOutliers(
+      const gtsam::BinaryMeasurementsUnit3& relativeTranslations) const;
+  gtsam::Values initialize(
+      const gtsam::BinaryMeasurementsUnit3& relativeTranslations,
+      double scale = 1.0) const;
+  gtsam::Values optimize(
+      const gtsam::BinaryMeasurementsUnit3& relativeTranslations,
+      const gtsam::Values& initial, double scale = 1.0) const;
+  gtsam::Values run(const gtsam::BinaryMeasurementsUnit3& relativeTranslations,
+                    double scale = 1.0) const;
+};
+
 namespace gtsfm {
 
 #include <gtsam/sfm/DsfTrackGenerator.h>
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testDsfTrackGenerator.cpp
+ * @date October 2026
+ * @brief tests for the track generators from pairwise matches
+ */
+
+#include <CppUnitLite/TestHarness.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/sfm/DsfTrackGenerator.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+using namespace gtsam::gtsfm;
+
+/* ************************************************************************* */
+// Same example as in python/gtsam/tests/test_DsfTrackGenerator.py
+TEST(ConcurrentTrackBuilder, threeTracks) {
+  KeypointsVector keypoints;
+  keypoints.emplace_back((Eigen::MatrixX2d(2, 2) << 10, 20, 30, 40).finished());
+  keypoints.emplace_back(
+      (Eigen::MatrixX2d(3, 2) << 50, 60, 70, 80, 90, 100).finished());
+  keypoints.emplace_back(
+      (Eigen::MatrixX2d(2, 2) << 110, 120, 130, 140).finished());
+
+  MatchIndicesMap matches;
+  matches[IndexPair(0, 1)] = (CorrespondenceIndices(2, 2) << 0, 0, 1, 1).finished();
+  matches[IndexPair(1, 2)] = (CorrespondenceIndices(2, 2) << 2, 0, 1, 1).finished();
+
+  ConcurrentTrackBuilder builder(keypoints);
+  LONGS_EQUAL(7, builder.nrKeypoints());
+  builder.addMatches(matches);
+  const auto tracks = builder.tracks(keypoints);
+  LONGS_EQUAL(3, tracks.size());
+
+  EXPECT_LONGS_EQUAL(0, tracks[0].measurement(0).first);
+  EXPECT_LONGS_EQUAL(1, tracks[0].measurement(1).first);
+  EXPECT(assert_equal(Matrix((Matrix(2, 2) << 10, 20, 50, 60).finished()),
+                      Matrix(tracks[0].measurementMatrix())));
+  EXPECT(assert_equal(
+      Matrix((Matrix(3, 2) << 30, 40, 70, 80, 130, 140).finished()),
+      Matrix(tracks[1].measurementMatrix())));
+  EXPECT(assert_equal(Matrix((Matrix(2, 2) << 90, 100, 110, 120).finished()),
+                      Matrix(tracks[2].measurementMatrix())));
+
+  // Same result as the serial version.
+  const auto expected = tracksFromPairwiseMatches(matches, keypoints);
+  LONGS_EQUAL(expected.size(), tracks.size());
+  for (size_t t = 0; t < tracks.size(); t++)
+    EXPECT(assert_equal(Matrix(expected[t].measurementMatrix()),
+                        Matrix(tracks[t].measurementMatrix())));
+
+  // Out of range keypoints throw.
+  CHECK_EXCEPTION(
+      builder.addMatches(IndexPair(0, 1),
+                         (CorrespondenceIndices(1, 2) << 0, 3).finished()),
+      std::out_of_range);
+}
+
+/* ************************************************************************* */
+// Random matches added in several batches, compared with the serial version.
+TEST(ConcurrentTrackBuilder, batches) {
+  const size_t nrImages = 20, nrKeypoints = 50, nrBatches = 4;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> keypoint(0, nrKeypoints - 1);
+
+  // Coordinates (i, k) make tracks easy to compare.
+  KeypointsVector keypoints;
+  for (size_t i = 0; i < nrImages; i++) {
+    Eigen::MatrixX2d coordinates(nrKeypoints, 2);
+    for (size_t k = 0; k < nrKeypoints; k++) coordinates.row(k) << i, k;
+    keypoints.emplace_back(coordinates);
+  }
+
+  MatchIndicesMap all;
+  std::vector<MatchIndicesMap> batches(nrBatches);
+  for (size_t i1 = 0; i1 < nrImages; i1++) {
+    for (size_t i2 = i1 + 1; i2 < std::min(nrImages, i1 + 4); i2++) {
+      CorrespondenceIndices corr(10, 2);
+      for (int k = 0; k < 10; k++) corr.row(k) << keypoint(rng), keypoint(rng);
+      all[IndexPair(i1, i2)] = corr;
+      batches[(i1 + i2) % nrBatches][IndexPair(i1, i2)] = corr;
+    }
+  }
+
+  ConcurrentTrackBuilder builder(keypoints);
+  for (const auto& batch : batches) builder.addMatches(batch);
+  std::vector<SfmTrack2d> actual;
+  const size_t nrDiscarded = builder.forEachTrack(
+      keypoints, [&](SfmTrack2d&& track) { actual.push_back(track); }, 7);
+  EXPECT(nrDiscarded > 0);
+
+  // The serial version orders tracks by their DSF root, sort by first entry.
+  auto expected = tracksFromPairwiseMatches(all, keypoints);
+  auto first = [](const SfmTrack2d& track) {
+    const Point2& p = track.measurement(0).second;
+    return std::make_pair(p.x(), p.y());
+  };
+  std::sort(expected.begin(), expected.end(),
+            [&](const SfmTrack2d& a, const SfmTrack2d& b) {
+              return first(a) < first(b);
+            });
+  LONGS_EQUAL(expected.size(), actual.size());
+  for (size_t t = 0; t < actual.size(); t++)
+    EXPECT(assert_equal(Matrix(expected[t].measurementMatrix()),
+                        Matrix(actual[t].measurementMatrix())));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
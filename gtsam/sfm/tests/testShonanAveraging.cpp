@@ -215,6 +215,32 @@ TEST(ShonanAveraging3, CheckWithEigen) {
   // EXPECT(assert_equal(SOn(expected), initialQ4.at<SOn>(0), 1e-5));
 }
 
+/* ************************************************************************* */
+TEST(ShonanAveraging3, matrixFreeCertification) {
+  auto parameters = ShonanAveraging3::Parameters();
+  parameters.setMatrixFreeCertification(true);
+  const auto shonan = fromExampleName("toyExample.g2o", parameters);
+
+  // Same minimum eigenvalue as the assembled A at a random point...
+  static std::mt19937 rng(0);
+  const Values random =
+      ShonanAveraging3::LiftTo<Rot3>(4, kShonan.initializeRandomly(rng));
+  Vector minEigenVector;
+  const double lambda = shonan.computeMinEigenValue(random, &minEigenVector);
+  EXPECT_DOUBLES_EQUAL(kShonan.computeMinEigenValue(random), lambda, 1e-4);
+  EXPECT(lambda < 0);
+
+  // ...and at the optimum, also when warm-started.
+  const Values Qstar4 = shonan.tryOptimizingAt(4, random);
+  EXPECT_DOUBLES_EQUAL(0, shonan.computeMinEigenValue(Qstar4), 1e-4);
+  EXPECT_DOUBLES_EQUAL(
+      0, shonan.computeMinEigenValue(Qstar4, nullptr, &minEigenVector), 1e-4);
+
+  const auto result = shonan.run(shonan.initializeRandomly(rng), 3, 5);
+  EXPECT_DOUBLES_EQUAL(0, shonan.cost(result.first), 1e-3);
+  EXPECT(result.second > parameters.getOptimalityThreshold());
+}
+
 /* ************************************************************************* */
 TEST(ShonanAveraging3, initializeWithDescent) {
   const Values randomRotations = kShonan.initializeRandomly(kRandomNumberGenerator);
@@ -236,6 +262,32 @@ TEST(ShonanAveraging3, run) {
                        1e-4); // Regression test
 }
 
+/* ************************************************************************* */
+TEST(ShonanAveraging3, runSpeculative) {
+  auto parameters = ShonanAveraging3::Parameters();
+  parameters.setSpeculativeLevels(3);
+  const auto shonan = fromExampleName("toyExample.g2o", parameters);
+
+  auto initial = shonan.initializeRandomly(kRandomNumberGenerator);
+  std::vector<ShonanAveraging3::LevelStatistics> statistics;
+  auto result = shonan.run(initial, 3, 5, &statistics);
+  EXPECT_DOUBLES_EQUAL(0, shonan.cost(result.first), 1e-3);
+
+  // All levels in the batch are reported, the result is the lowest certified.
+  CHECK_EQUAL(3, statistics.size());
+  size_t p = 3;
+  for (const auto &level : statistics) {
+    EXPECT_LONGS_EQUAL(p++, level.p);
+    EXPECT(level.optimizeTime >= 0 && level.certifyTime >= 0);
+  }
+  auto certified = std::find_if(
+      statistics.begin(), statistics.end(), [&](const auto &level) {
+        return level.minEigenValue > parameters.getOptimalityThreshold();
+      });
+  CHECK(certified != statistics.end());
+  EXPECT_DOUBLES_EQUAL(certified->minEigenValue, result.second, 1e-9);
+}
+
 /* ************************************************************************* */
 namespace klaus {
 // The data in the file is the Colmap solution
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testTranslationAveraging.cpp
+ * @date October 2026
+ * @brief unit tests for global translation averaging
+ */
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/sfm/TranslationAveraging.h>
+#include <gtsam/sfm/TranslationRecovery.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <random>
+#include <set>
+#include <utility>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+auto kModel = noiseModel::Isotropic::Sigma(3, 0.01);
+
+// Random positions, with direction measurements between consecutive cameras
+// and between distinct random pairs, perturbed by noise if sigma > 0.
+TranslationAveraging::TranslationEdges RandomProblem(size_t n, size_t m,
+                                                     double sigma,
+                                                     Values* positions) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(-10, 10);
+  std::normal_distribution<double> normal(0, sigma > 0 ? sigma : 1);
+  for (size_t j = 0; j < n; j++)
+    positions->insert<Point3>(
+        j, Point3(uniform(rng), uniform(rng), uniform(rng)));
+
+  std::uniform_int_distribution<size_t> camera(0, n - 1);
+  TranslationAveraging::TranslationEdges edges;
+  std::set<std::pair<size_t, size_t>> pairs;
+  while (edges.size() < m) {
+    const size_t k = edges.size();
+    const size_t a = k + 1 < n ? k : camera(rng);
+    const size_t b = k + 1 < n ? k + 1 : camera(rng);
+    if (a == b || !pairs.emplace(std::min(a, b), std::max(a, b)).second)
+      continue;
+    Point3 direction =
+        normalize(Point3(positions->at<Point3>(b) - positions->at<Point3>(a)));
+    if (sigma > 0) direction += Point3(normal(rng), normal(rng), normal(rng));
+    edges.emplace_back(a, b, Unit3(direction), kModel);
+  }
+  return edges;
+}
+}  // namespace
+
+/* ************************************************************************* */
+// Without noise, positions are recovered up to the gauge, by the linear
+// initialization alone.
+TEST(TranslationAveraging, Noiseless) {
+  Values positions;
+  const auto edges = RandomProblem(20, 60, 0, &positions);
+
+  const double scale = 2.0;
+  const TranslationAveraging averaging;
+  const Values initial = averaging.initialize(edges, scale);
+  const Values result = averaging.run(edges, scale);
+
+  const Point3 T0 = positions.at<Point3>(0);
+  const double s = scale / (positions.at<Point3>(1) - T0).norm();
+  for (size_t j = 0; j < 20; j++) {
+    const Point3 expected = s * (positions.at<Point3>(j) - T0);
+    EXPECT(assert_equal(expected, initial.at<Point3>(j), 1e-6));
+    EXPECT(assert_equal(expected, result.at<Point3>(j), 1e-6));
+  }
+}
+
+/* ************************************************************************* */
+// With noise, the result should be the same as that of TranslationRecovery.
+TEST(TranslationAveraging, CompareTranslationRecovery) {
+  Values positions;
+  const auto edges = RandomProblem(20, 80, 0.02, &positions);
+
+  TranslationAveraging::Parameters parameters;
+  parameters.relativeErrorTol = 1e-10;
+  parameters.absoluteErrorTol = 1e-10;
+  const TranslationAveraging averaging(parameters);
+  const Values initial = averaging.initialize(edges);
+  const Values actual = averaging.optimize(edges, initial);
+
+  LevenbergMarquardtParams lmParams;
+  lmParams.relativeErrorTol = 1e-10;
+  lmParams.absoluteErrorTol = 1e-10;
+  const Values expected =
+      TranslationRecovery(lmParams).run(edges, 1.0, {}, initial);
+  EXPECT(assert_equal(expected, actual, 1e-5));
+}
+
+/* ************************************************************************* */
+// A reversed edge is rejected by MFAS along many projection directions.
+TEST(TranslationAveraging, RejectOutliers) {
+  Values positions;
+  auto edges = RandomProblem(20, 100, 0, &positions);
+  const size_t outlier = 50;
+  edges[outlier] = BinaryMeasurement<Unit3>(
+      edges[outlier].key1(), edges[outlier].key2(),
+      Unit3(-edges[outlier].measured().point3()), kModel);
+
+  TranslationAveraging::Parameters parameters;
+  parameters.nrProjectionDirections = 48;
+  const TranslationAveraging averaging(parameters);
+  const vector<double> weights = averaging.computeOutlierWeights(edges);
+  EXPECT_LONGS_EQUAL(100, weights.size());
+  EXPECT(weights[outlier] > parameters.outlierThreshold);
+
+  const auto inliers = averaging.rejectOutliers(edges);
+  for (const auto& edge : inliers)
+    EXPECT(!edge.measured().equals(edges[outlier].measured()));
+  EXPECT(inliers.size() >= 90);
+}
+
+/* ************************************************************************* */
+// Zero-translation edges merge their end points, as in TranslationRecovery.
+TEST(TranslationAveraging, ZeroTranslation) {
+  TranslationAveraging::TranslationEdges edges;
+  edges.emplace_back(0, 1, Unit3(1, 0, 0), kModel);
+  edges.emplace_back(1, 2, Unit3(0, 0, 0), kModel);
+  edges.emplace_back(2, 3, Unit3(0, 1, 0), kModel);
+  edges.emplace_back(0, 3, Unit3(1, 1, 0), kModel);
+
+  const Values result = TranslationAveraging().run(edges, 3.0);
+  EXPECT(assert_equal(Point3(0, 0, 0), result.at<Point3>(0), 1e-6));
+  EXPECT(assert_equal(Point3(3, 0, 0), result.at<Point3>(1), 1e-6));
+  EXPECT(assert_equal(Point3(3, 0, 0), result.at<Point3>(2), 1e-6));
+  EXPECT(assert_equal(Point3(3, 3, 0), result.at<Point3>(3), 1e-6));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -20,12 +20,14 @@
 
 #pragma once
 
+#include <gtsam/geometry/BatchProjection.h>
 #include <gtsam/geometry/PinholeCamera.h>
 #include <gtsam/geometry/Point2.h>
 #include <gtsam/geometry/Point3.h>
 #include <gtsam/geometry/Pose3.h>
 #include <gtsam/nonlinear/NonlinearFactor.h>
 #include <gtsam/linear/BinaryJacobianFactor.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/NoiseModel.h>
 #include <gtsam/base/concepts.h>
 #include <gtsam/base/Manifold.h>
@@ -156,7 +158,80 @@ public:
       b.setZero();
       //TODO Print the exception via logging
     }
+    return createFactor(H1, H2, b);
+  }
+
+  /**
+   * Linearize many factors at once, with the same result as calling
+   * linearize on each of them. If CAMERA is a PinholeCamera with a
+   * calibration supported by BatchProjection, and LANDMARK is a Point3, all
+   * projections and their Jacobians are computed in one batch.
+   *
+   * This is an explicit opt-in: NonlinearFactorGraph::linearize, and hence
+   * the optimizers, still call linearize factor by factor. Callers that keep
+   * their projection factors in a vector, as timeSFMBAL does, can call this
+   * instead and assemble the GaussianFactorGraph themselves.
+   */
+  static GaussianFactorGraph Linearize(const std::vector<shared_ptr>& factors,
+                                       const Values& values) {
+    GaussianFactorGraph linear;
+    linear.reserve(factors.size());
+    using Batch = internal::CameraBatch<CAMERA, LANDMARK>;
+    if constexpr (Batch::value && Batch::kCalibration) {
+      gttic(GeneralSFMFactor_Linearize_batch);
+      // Process in chunks, so that the batch arrays stay in cache
+      constexpr size_t kChunk = 128;
+      BatchProjection<typename Batch::Calibration> batch;
+      for (size_t start = 0; start < factors.size(); start += kChunk) {
+        const size_t n = std::min(kChunk, factors.size() - start);
+        batch.resize(n);
+        for (size_t k = 0; k < n; k++) {
+          const This& factor = *factors[start + k];
+          const CAMERA& camera = values.at<CAMERA>(factor.key1());
+          batch.set(k, camera.pose(), camera.calibration(),
+                    values.at<LANDMARK>(factor.key2()));
+        }
+        batch.project(true, true);
+        for (size_t k = 0; k < n; k++) {
+          const This& factor = *factors[start + k];
+          if (!factor.active(values)) {
+            linear.push_back(std::shared_ptr<JacobianFactor>());
+            continue;
+          }
+          JacobianC H1;
+          JacobianL H2;
+          Vector2 b;
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+          if (!batch.inFront(k)) {
+            H1.setZero();
+            H2.setZero();
+            b.setZero();
+          } else
+#endif
+          {
+            H1 << batch.Dpose(k), batch.Dcal(k);
+            H2 = batch.Dpoint(k);
+            b = factor.measured() - batch.uv(k);
+          }
+          linear.push_back(factor.createFactor(H1, H2, b));
+        }
+      }
+    } else {
+      for (const shared_ptr& factor : factors)
+        linear.push_back(factor->linearize(values));
+    }
+    return linear;
+  }
 
+  /** return the measured */
+  inline const Point2 measured() const {
+    return measured_;
+  }
+
+private:
+  /// Whiten the linearized system, and create the Jacobian factor.
+  std::shared_ptr<GaussianFactor> createFactor(JacobianC& H1, JacobianL& H2,
+                                               Vector2& b) const {
     // Whiten the system if needed
     const SharedNoiseModel& noiseModel = this->noiseModel();
     if (noiseModel && !noiseModel->isUnit()) {
@@ -173,15 +248,10 @@ public:
       model = std::static_pointer_cast<noiseModel::Constrained>(noiseModel)->unit();
     }
 
-    return std::make_shared<BinaryJacobianFactor<2, DimC, DimL> >(key1, H1, key2, H2, b, model);
+    return std::make_shared<BinaryJacobianFactor<2, DimC, DimL> >(
+        this->key1(), H1, this->key2(), H2, b, model);
   }
 
-  /** return the measured */
-  inline const Point2 measured() const {
-    return measured_;
-  }
-
-private:
 #if GTSAM_ENABLE_BOOST_SERIALIZATION
   /** Serialization function */
   friend class boost::serialization::access;
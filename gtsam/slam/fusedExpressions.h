@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file fusedExpressions.h
+ * @brief Common fused expressions for geometry/slam/sfm problems, mirroring
+ *        the ones in expressions.h
+ * @date October 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/nonlinear/FusedExpression.h>
+
+namespace gtsam {
+namespace fused {
+
+using Pose3_ = Leaf<Pose3>;
+using Rot3_ = Leaf<Rot3>;
+using Point3_ = Leaf<Point3>;
+
+/// Function objects wrapping the geometry methods, so calls are inlined.
+struct TransformTo {
+  Point3 operator()(const Pose3& x, const Point3& p, OptionalJacobian<3, 6> H1,
+                    OptionalJacobian<3, 3> H2) const {
+    return x.transformTo(p, H1, H2);
+  }
+};
+
+struct TransformFrom {
+  Point3 operator()(const Pose3& x, const Point3& p, OptionalJacobian<3, 6> H1,
+                    OptionalJacobian<3, 3> H2) const {
+    return x.transformFrom(p, H1, H2);
+  }
+};
+
+struct Rotate {
+  Point3 operator()(const Rot3& R, const Point3& p, OptionalJacobian<3, 3> H1,
+                    OptionalJacobian<3, 3> H2) const {
+    return R.rotate(p, H1, H2);
+  }
+};
+
+struct Unrotate {
+  Point3 operator()(const Rot3& R, const Point3& p, OptionalJacobian<3, 3> H1,
+                    OptionalJacobian<3, 3> H2) const {
+    return R.unrotate(p, H1, H2);
+  }
+};
+
+struct Project {
+  Point2 operator()(const Point3& p, OptionalJacobian<2, 3> H) const {
+    return PinholeBase::Project(p, H);
+  }
+};
+
+template <class CALIBRATION>
+struct Uncalibrate {
+  Point2 operator()(const CALIBRATION& K, const Point2& p,
+                    OptionalJacobian<2, CALIBRATION::dimension> Dcal,
+                    OptionalJacobian<2, 2> Dp) const {
+    return K.uncalibrate(p, Dcal, Dp);
+  }
+};
+
+/// Calibrated projection, fused into a single node as in project3.
+template <class CALIBRATION>
+struct Project3 {
+  Point2 operator()(const Pose3& x, const Point3& p, const CALIBRATION& K,
+                    OptionalJacobian<2, 6> Dpose, OptionalJacobian<2, 3> Dpoint,
+                    OptionalJacobian<2, CALIBRATION::dimension> Dcal) const {
+    return PinholeCamera<CALIBRATION>(x, K).project(p, Dpose, Dpoint, Dcal);
+  }
+};
+
+template <class X, class P>
+Function<Point3, TransformTo, X, P> transformTo(const X& x, const P& p) {
+  return {TransformTo(), x, p};
+}
+
+template <class X, class P>
+Function<Point3, TransformFrom, X, P> transformFrom(const X& x, const P& p) {
+  return {TransformFrom(), x, p};
+}
+
+template <class R, class P>
+Function<Point3, Rotate, R, P> rotate(const R& r, const P& p) {
+  return {Rotate(), r, p};
+}
+
+template <class R, class P>
+Function<Point3, Unrotate, R, P> unrotate(const R& r, const P& p) {
+  return {Unrotate(), r, p};
+}
+
+template <class P>
+Function<Point2, Project, P> project(const P& p_cam) {
+  return {Project(), p_cam};
+}
+
+template <class K, class P>
+Function<Point2, Uncalibrate<typename K::Type>, K, P> uncalibrate(
+    const K& k, const P& xy_hat) {
+  return {Uncalibrate<typename K::Type>(), k, xy_hat};
+}
+
+template <class X, class P, class K>
+Function<Point2, Project3<typename K::Type>, X, P, K> project3(const X& x,
+                                                               const P& p,
+                                                               const K& k) {
+  return {Project3<typename K::Type>(), x, p, k};
+}
+
+}  // namespace fused
+}  // namespace gtsam
@@ -490,6 +490,32 @@ TEST(GeneralSFMFactor, BinaryJacobianFactor) {
   }
 }
 
+/* ************************************************************************* */
+// Batch linearization should be the same as linearizing factor by factor.
+TEST(GeneralSFMFactor, Linearize) {
+  vector<Point3> landmarks = genPoint3();
+  vector<GeneralCamera> cameras = genCameraVariableCalibration();
+
+  Values values;
+  for (size_t i = 0; i < cameras.size(); ++i)
+    values.insert(X(i), cameras[i]);
+  for (size_t j = 0; j < landmarks.size(); ++j)
+    values.insert(L(j), landmarks[j]);
+
+  const SharedNoiseModel model = noiseModel::Isotropic::Sigma(2, 0.5);
+  vector<Projection::shared_ptr> factors;
+  for (size_t i = 0; i < cameras.size(); ++i)
+    for (size_t j = 0; j < landmarks.size(); ++j)
+      factors.push_back(std::make_shared<Projection>(
+          cameras[i].project(landmarks[j]) + Point2(0.3, -0.2), model, X(i),
+          L(j)));
+
+  const GaussianFactorGraph actual = Projection::Linearize(factors, values);
+  EXPECT_LONGS_EQUAL(factors.size(), actual.size());
+  for (size_t k = 0; k < factors.size(); ++k)
+    EXPECT(assert_equal(*factors[k]->linearize(values), *actual[k], 1e-9));
+}
+
 /* ************************************************************************* */
 // Do a thorough test of BinaryJacobianFactor
 TEST( GeneralSFMFactor, BinaryJacobianFactor2 ) {
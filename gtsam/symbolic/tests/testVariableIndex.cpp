@@ -16,6 +16,7 @@
  * @date    Sep 26, 2010
  */
 
+#include <gtsam/inference/FlatVariableIndex.h>
 #include <gtsam/inference/VariableIndex.h>
 #include <gtsam/symbolic/SymbolicFactorGraph.h>
 #include <gtsam/base/TestableAssertions.h>
@@ -139,6 +140,121 @@ TEST(VariableIndex, deep_copy) {
   EXPECT(assert_equal(expectedRemoved, clone));
 }
 
+/* ************************************************************************* */
+TEST(FlatVariableIndex, augment) {
+  auto fg1 = testGraph1(), fg2 = testGraph2();
+  SymbolicFactorGraph fgCombined;
+  fgCombined.push_back(fg1);
+  fgCombined.push_back(fg2);
+
+  // Keys of fg2 interleave with those of fg1.
+  FlatVariableIndex expected(VariableIndex{fgCombined});
+  FlatVariableIndex actual(fg1);
+  actual.augment(fg2);
+
+  LONGS_EQUAL(8, actual.size());
+  LONGS_EQUAL(16, actual.nEntries());
+  LONGS_EQUAL(8, actual.nFactors());
+  EXPECT(assert_equal(expected, actual));
+  EXPECT(assert_equal(expected, FlatVariableIndex(fgCombined)));
+
+  // Iteration visits every variable of VariableIndex once.
+  VariableIndex variableIndex(fgCombined);
+  size_t count = 0;
+  for (const auto& [key, factors] : actual) {
+    EXPECT(variableIndex[key] == factors);
+    ++count;
+  }
+  EXPECT_LONGS_EQUAL(variableIndex.size(), count);
+
+  FactorIndices expectedFactors{3, 4, 6};
+  EXPECT(expectedFactors == actual[3]);
+  EXPECT(actual.find(7) == actual.end());
+  CHECK_EXCEPTION(actual[7], std::invalid_argument);
+
+  // An existing factor involving new and existing keys.
+  actual.augmentExistingFactor(2, KeySet{4, 7});
+  variableIndex.augmentExistingFactor(2, KeySet{4, 7});
+  EXPECT(assert_equal(FlatVariableIndex(variableIndex), actual));
+}
+
+/* ************************************************************************* */
+TEST(FlatVariableIndex, augment2) {
+  auto fg1 = testGraph1(), fg2 = testGraph2();
+
+  SymbolicFactorGraph fgCombined;
+  fgCombined.push_back(fg1);
+  fgCombined.push_back(SymbolicFactor::shared_ptr()); // Add an extra empty factor
+  fgCombined.push_back(fg2);
+
+  FlatVariableIndex expected(fgCombined);
+
+  FactorIndices newIndices {5, 6, 7, 8};
+  FlatVariableIndex actual(fg1);
+  actual.augment(fg2, newIndices);
+
+  LONGS_EQUAL(8, actual.size());
+  LONGS_EQUAL(16, actual.nEntries());
+  LONGS_EQUAL(9, actual.nFactors());
+  EXPECT(assert_equal(expected, actual));
+}
+
+/* ************************************************************************* */
+TEST(FlatVariableIndex, remove) {
+  auto fg1 = testGraph1(), fg2 = testGraph2();
+
+  SymbolicFactorGraph fgCombined; fgCombined.push_back(fg1); fgCombined.push_back(fg2);
+  SymbolicFactorGraph fg2removed(fgCombined);
+  fg2removed.remove(0); fg2removed.remove(1); fg2removed.remove(2); fg2removed.remove(3);
+
+  FlatVariableIndex expected(fg2removed);
+  FlatVariableIndex actual(fgCombined);
+  vector<size_t> indices{0, 1, 2, 3};
+  actual.remove(indices.begin(), indices.end(), fg1);
+  std::list<Key> unusedVariables{9, 0};
+  actual.removeUnusedVariables(unusedVariables.begin(), unusedVariables.end());
+  CHECK(assert_equal(expected, actual));
+
+  // Variables that are still used can not be removed.
+  std::list<Key> usedVariables{3};
+  CHECK_EXCEPTION(
+      actual.removeUnusedVariables(usedVariables.begin(), usedVariables.end()),
+      std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(FlatVariableIndex, manyVariables) {
+  // Enough variables to grow the hash table, and to remove keys whose slots
+  // are in the middle of probe sequences.
+  SymbolicFactorGraph chain;
+  for (Key j = 0; j + 1 < 1000; j++) chain.push_factor(j, j + 1);
+  VariableIndex expected(chain);
+  FlatVariableIndex actual(chain);
+
+  // Remove the factors of every third variable, and then the variables.
+  vector<size_t> indices;
+  SymbolicFactorGraph removed;
+  KeyVector unused;
+  for (Key j = 0; j + 1 < 1000; j += 3) {
+    indices.push_back(j);
+    removed.push_back(chain[j]);
+    if (j % 2 == 0) {
+      indices.push_back(j + 1);
+      removed.push_back(chain[j + 1]);
+      unused.push_back(j + 1);
+    }
+  }
+  expected.remove(indices.begin(), indices.end(), removed);
+  actual.remove(indices.begin(), indices.end(), removed);
+  expected.removeUnusedVariables(unused.begin(), unused.end());
+  actual.removeUnusedVariables(unused.begin(), unused.end());
+
+  EXPECT(assert_equal(FlatVariableIndex(expected), actual));
+  for (Key j : unused) EXPECT(actual.find(j) == actual.end());
+  for (const auto& [key, factors] : expected)
+    EXPECT(actual[key] == factors);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
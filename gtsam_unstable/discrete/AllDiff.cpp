@@ -14,7 +14,7 @@
 namespace gtsam {
 
 /* ************************************************************************* */
-AllDiff::AllDiff(const DiscreteKeys& dkeys) : Constraint(dkeys.indices()) {
+AllDiff::AllDiff(const DiscreteKeys& dkeys) : Constraint(dkeys) {
   for (const DiscreteKey& dkey : dkeys) cardinalities_.insert(dkey);
 }
 
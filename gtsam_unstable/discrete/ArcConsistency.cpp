@@ -0,0 +1,346 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ *  @file ArcConsistency.cpp
+ *  @brief Incremental arc-consistency propagation with bitset domains
+ *  @date October 2026
+ */
+
+#include <gtsam/discrete/DecisionTreeFactor.h>
+#include <gtsam/discrete/TableFactor.h>
+#include <gtsam_unstable/discrete/AllDiff.h>
+#include <gtsam_unstable/discrete/ArcConsistency.h>
+#include <gtsam_unstable/discrete/BinaryAllDiff.h>
+
+#include <limits>
+#include <stdexcept>
+
+namespace gtsam {
+
+namespace {
+constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+/**
+ * Call f(tuple) for every assignment to dkeys on which the factor is
+ * non-zero, with tuple[k] the value of dkeys[k]. Decision trees and tables
+ * are read from their stored non-zero leaves and entries, so the zeros are
+ * never visited; other factors are evaluated on the whole Cartesian product.
+ */
+template <class F>
+void forEachNonZero(const DiscreteFactor& factor, const DiscreteKeys& dkeys,
+                    F f) {
+  const size_t arity = dkeys.size();
+  std::vector<size_t> tuple(arity, 0);
+
+  // Call g(tuple) for all values of the variables not in fixed.
+  auto expand = [&](const std::map<Key, size_t>& fixed, auto g) {
+    std::vector<size_t> free;
+    for (size_t k = 0; k < arity; k++) {
+      const auto it = fixed.find(dkeys[k].first);
+      if (it != fixed.end()) {
+        tuple[k] = it->second;
+      } else {
+        tuple[k] = 0;
+        free.push_back(k);
+      }
+    }
+    while (true) {
+      g(tuple);
+      // Advance the mixed-radix counter, last variable fastest.
+      size_t m = free.size();
+      while (m-- > 0) {
+        const size_t k = free[m];
+        if (++tuple[k] < dkeys[k].second) break;
+        tuple[k] = 0;
+      }
+      if (m == kNone) break;
+    }
+  };
+
+  if (auto tree = dynamic_cast<const DecisionTreeFactor*>(&factor)) {
+    // A leaf fixes the variables on its path, the others are free.
+    tree->visitWith([&](const Assignment<Key>& assignment, double value) {
+      if (value != 0.0) expand(assignment, f);
+    });
+  } else if (auto table = dynamic_cast<const TableFactor*>(&factor)) {
+    const Eigen::SparseVector<double> entries = table->sparseTable();
+    for (TableFactor::SparseIt it(entries); it; ++it)
+      if (it.value() != 0.0) expand(table->findAssignments(it.index()), f);
+  } else {
+    DiscreteValues x;
+    expand({}, [&](const std::vector<size_t>& t) {
+      for (size_t k = 0; k < arity; k++) x[dkeys[k].first] = t[k];
+      if (factor.evaluate(x) != 0.0) f(t);
+    });
+  }
+}
+}  // namespace
+
+/* ************************************************************************* */
+ArcConsistency::ArcConsistency(const CSP& csp) {
+  // Number the variables in key order.
+  std::map<Key, size_t> cardinalities;
+  for (const auto& factor : csp) {
+    if (!factor) continue;
+    for (const DiscreteKey& dkey : factor->discreteKeys())
+      cardinalities.emplace(dkey);
+  }
+  size_t nrWords = 0;
+  for (const auto& [key, cardinality] : cardinalities) {
+    index_[key] = keys_.size();
+    keys_.push_back(key);
+    cardinality_.push_back(cardinality);
+    offset_.push_back(nrWords);
+    size_.push_back(cardinality);
+    nrWords += (cardinality + 63) / 64;
+  }
+  words_.resize(nrWords, 0);
+  for (size_t i = 0; i < keys_.size(); i++)
+    for (size_t v = 0; v < cardinality_[i]; v++)
+      words_[offset_[i] + v / 64] |= uint64_t(1) << (v % 64);
+  watchers_.resize(keys_.size());
+
+  for (const auto& factor : csp) {
+    if (!factor) continue;
+    Propagator propagator;
+    for (Key key : factor->keys()) propagator.vars.push_back(index_.at(key));
+
+    if (std::dynamic_pointer_cast<AllDiff>(factor) ||
+        std::dynamic_pointer_cast<BinaryAllDiff>(factor)) {
+      propagator.allDiff = true;
+    } else if (propagator.vars.size() == 1) {
+      // Unary constraints are applied right away.
+      const size_t i = propagator.vars[0];
+      for (size_t v = 0; v < cardinality_[i]; v++) {
+        DiscreteValues x;
+        x[keys_[i]] = v;
+        if (has(i, v) && factor->evaluate(x) == 0.0) remove(i, v, kNone);
+      }
+      continue;
+    } else {
+      // Store the allowed tuples, and which of them support each value.
+      const size_t arity = propagator.vars.size();
+      DiscreteKeys dkeys;
+      propagator.supports.resize(arity);
+      propagator.residues.resize(arity);
+      for (size_t k = 0; k < arity; k++) {
+        const size_t i = propagator.vars[k];
+        dkeys.emplace_back(keys_[i], cardinality_[i]);
+        propagator.supports[k].resize(cardinality_[i]);
+        propagator.residues[k].resize(cardinality_[i], kNone);
+      }
+      forEachNonZero(*factor, dkeys, [&](const std::vector<size_t>& tuple) {
+        const size_t t = propagator.tuples.size() / arity;
+        for (size_t k = 0; k < arity; k++) {
+          propagator.tuples.push_back(tuple[k]);
+          propagator.supports[k][tuple[k]].push_back(t);
+        }
+      });
+    }
+
+    const size_t p = propagators_.size();
+    for (size_t i : propagator.vars) watchers_[i].push_back(p);
+    propagators_.push_back(std::move(propagator));
+    queued_.push_back(false);
+  }
+
+  // Everything needs to be revised once.
+  for (size_t p = 0; p < propagators_.size(); p++) enqueue(p);
+}
+
+/* ************************************************************************* */
+Domains ArcConsistency::domains() const {
+  Domains result;
+  for (size_t i = 0; i < keys_.size(); i++) {
+    Domain domain(DiscreteKey(keys_[i], cardinality_[i]));
+    for (size_t v = 0; v < cardinality_[i]; v++)
+      if (!has(i, v)) domain.erase(v);
+    result.emplace(keys_[i], domain);
+  }
+  return result;
+}
+
+/* ************************************************************************* */
+void ArcConsistency::enqueue(size_t p) {
+  if (queued_[p]) return;
+  queued_[p] = true;
+  queue_.push_back(p);
+}
+
+/* ************************************************************************* */
+bool ArcConsistency::remove(size_t i, size_t value, size_t except) {
+  words_[offset_[i] + value / 64] &= ~(uint64_t(1) << (value % 64));
+  trail_.emplace_back(i, value);
+  if (--size_[i] == 0) {
+    wipeout_ = true;
+    return false;
+  }
+  for (size_t p : watchers_[i])
+    if (p != except) enqueue(p);
+  return true;
+}
+
+/* ************************************************************************* */
+bool ArcConsistency::valid(const Propagator& propagator, size_t t) const {
+  const size_t arity = propagator.vars.size();
+  for (size_t k = 0; k < arity; k++)
+    if (!has(propagator.vars[k], propagator.tuples[t * arity + k]))
+      return false;
+  return true;
+}
+
+/* ************************************************************************* */
+// Both cases iterate to a fixed point of the propagator itself, so it does
+// not need to be queued again for its own removals.
+bool ArcConsistency::revise(size_t p) {
+  Propagator& propagator = propagators_[p];
+  const size_t arity = propagator.vars.size();
+  bool changed = true;
+  if (propagator.allDiff) {
+    while (changed) {
+      changed = false;
+      for (size_t i : propagator.vars) {
+        if (size_[i] != 1) continue;
+        size_t value = 0;
+        while (!has(i, value)) ++value;
+        for (size_t j : propagator.vars) {
+          if (j == i || !has(j, value)) continue;
+          if (!remove(j, value, p)) return false;
+          changed = changed || size_[j] == 1;
+        }
+      }
+    }
+    // Pigeonhole: the variables need at least as many distinct values.
+    std::vector<bool> used;
+    size_t nrUsed = 0;
+    for (size_t i : propagator.vars) {
+      if (used.size() < cardinality_[i]) used.resize(cardinality_[i], false);
+      for (size_t v = 0; v < cardinality_[i]; v++)
+        if (has(i, v) && !used[v]) {
+          used[v] = true;
+          ++nrUsed;
+        }
+    }
+    if (nrUsed < arity) wipeout_ = true;
+    return !wipeout_;
+  }
+
+  while (changed) {
+    changed = false;
+    for (size_t k = 0; k < arity; k++) {
+      const size_t i = propagator.vars[k];
+      for (size_t v = 0; v < cardinality_[i]; v++) {
+        if (!has(i, v)) continue;
+        size_t& residue = propagator.residues[k][v];
+        if (residue != kNone && valid(propagator, residue)) continue;
+        bool supported = false;
+        for (size_t t : propagator.supports[k][v]) {
+          if (valid(propagator, t)) {
+            residue = t;
+            supported = true;
+            break;
+          }
+        }
+        if (supported) continue;
+        if (!remove(i, v, p)) return false;
+        changed = true;
+      }
+    }
+  }
+  return true;
+}
+
+/* ************************************************************************* */
+bool ArcConsistency::propagate() {
+  while (!wipeout_ && !queue_.empty()) {
+    const size_t p = queue_.front();
+    queue_.pop_front();
+    queued_[p] = false;
+    revise(p);
+  }
+  if (wipeout_) {
+    for (size_t p : queue_) queued_[p] = false;
+    queue_.clear();
+  }
+  return !wipeout_;
+}
+
+/* ************************************************************************* */
+void ArcConsistency::push() { levels_.push_back(trail_.size()); }
+
+/* ************************************************************************* */
+void ArcConsistency::pop() {
+  if (levels_.empty())
+    throw std::runtime_error("ArcConsistency::pop: no matching push");
+  const size_t level = levels_.back();
+  levels_.pop_back();
+  while (trail_.size() > level) {
+    const auto [i, value] = trail_.back();
+    trail_.pop_back();
+    words_[offset_[i] + value / 64] |= uint64_t(1) << (value % 64);
+    ++size_[i];
+  }
+  for (size_t p : queue_) queued_[p] = false;
+  queue_.clear();
+  wipeout_ = false;
+}
+
+/* ************************************************************************* */
+bool ArcConsistency::assign(Key j, size_t value) {
+  const size_t i = index_.at(j);
+  if (wipeout_ || !has(i, value)) return false;
+  for (size_t v = 0; v < cardinality_[i]; v++)
+    if (v != value && has(i, v)) remove(i, v, kNone);
+  return propagate();
+}
+
+/* ************************************************************************* */
+bool ArcConsistency::search() {
+  ++nrNodes_;
+  // Branch on the unassigned variable with the smallest domain.
+  size_t best = kNone;
+  for (size_t i = 0; i < keys_.size(); i++)
+    if (size_[i] > 1 && (best == kNone || size_[i] < size_[best])) best = i;
+  if (best == kNone) return true;
+
+  std::vector<size_t> values;
+  for (size_t v = 0; v < cardinality_[best]; v++)
+    if (has(best, v)) values.push_back(v);
+  for (size_t v : values) {
+    push();
+    if (assign(keys_[best], v) && search()) return true;
+    pop();
+  }
+  return false;
+}
+
+/* ************************************************************************* */
+std::optional<DiscreteValues> ArcConsistency::solve() {
+  nrNodes_ = 0;
+  for (size_t p = 0; p < propagators_.size(); p++) enqueue(p);
+  if (!propagate()) return {};
+
+  // Keep the changes made by the search in the current level.
+  const size_t nrLevels = levels_.size();
+  if (!search()) return {};
+  levels_.resize(nrLevels);
+
+  DiscreteValues result;
+  for (size_t i = 0; i < keys_.size(); i++) {
+    size_t value = 0;
+    while (!has(i, value)) ++value;
+    result[keys_[i]] = value;
+  }
+  return result;
+}
+
+}  // namespace gtsam
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ *  @file ArcConsistency.h
+ *  @brief Incremental arc-consistency propagation with bitset domains
+ *  @date October 2026
+ */
+
+#pragma once
+
+#include <gtsam/discrete/DiscreteValues.h>
+#include <gtsam_unstable/discrete/CSP.h>
+#include <gtsam_unstable/discrete/Domain.h>
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Queue-based propagation engine for a CSP.
+ *
+ * CSP::runArcConsistency copies Domain objects and revisits every variable
+ * after any change (AC-1). This engine instead keeps all domains as bitsets
+ * in one flat array, and only revisits the constraints of variables whose
+ * domain actually changed (AC-3). Table constraints, i.e., any factor other
+ * than an AllDiff, are revised with residual supports as in AC-2001, which
+ * makes repeated revisions cheap. AllDiff constraints remove the values of
+ * assigned variables from the other domains.
+ *
+ * Every value removal is recorded on a trail, so that the domains can be
+ * restored cheaply when backtracking. This is used by `solve`, which does
+ * depth-first search while maintaining arc consistency (MAC).
+ *
+ * Any factor with a zero entry is treated as a hard constraint, nonzero
+ * entries are all considered allowed.
+ */
+class GTSAM_UNSTABLE_EXPORT ArcConsistency {
+ private:
+  /// A constraint, either an AllDiff or a table of allowed tuples.
+  struct Propagator {
+    std::vector<size_t> vars;  ///< dense variable indices
+    bool allDiff = false;
+    /// Allowed tuples, flattened with vars.size() entries per tuple.
+    std::vector<uint32_t> tuples;
+    /// Per position and value, the tuples that support the value.
+    std::vector<std::vector<std::vector<size_t>>> supports;
+    /// Per position and value, the last support found (AC-2001 residue).
+    std::vector<std::vector<size_t>> residues;
+  };
+
+  KeyVector keys_;                   ///< key per dense variable index
+  std::map<Key, size_t> index_;      ///< dense variable index per key
+  std::vector<size_t> cardinality_;  ///< per variable
+  std::vector<size_t> offset_;       ///< first word of each domain in words_
+  std::vector<uint64_t> words_;      ///< all domain bitsets
+  std::vector<size_t> size_;         ///< number of values in each domain
+
+  std::vector<Propagator> propagators_;
+  std::vector<std::vector<size_t>> watchers_;  ///< propagators per variable
+
+  std::deque<size_t> queue_;   ///< propagators to revise
+  std::vector<bool> queued_;   ///< whether a propagator is in queue_
+
+  /// Removed (variable, value) pairs, and the trail size at each level.
+  std::vector<std::pair<size_t, size_t>> trail_;
+  std::vector<size_t> levels_;
+
+  bool wipeout_ = false;  ///< whether some domain is empty
+  size_t nrNodes_ = 0;    ///< number of search nodes in the last solve
+
+ public:
+  /// Create from a CSP, applying all unary constraints immediately.
+  explicit ArcConsistency(const CSP& csp);
+
+  /// Number of variables.
+  size_t nrVariables() const { return keys_.size(); }
+
+  /// Current number of values in the domain of j.
+  size_t nrValues(Key j) const { return size_[index_.at(j)]; }
+
+  /// Check whether the domain of j contains a value.
+  bool contains(Key j, size_t value) const {
+    return has(index_.at(j), value);
+  }
+
+  /// Current domains, e.g., to use with CSP::partiallyApply.
+  Domains domains() const;
+
+  /**
+   * Revise queued constraints until a fixed point is reached.
+   * After construction all constraints are queued.
+   * @return false if a domain became empty, i.e., the CSP is infeasible.
+   */
+  bool propagate();
+
+  /// Start a new level: changes from now on can be undone with pop().
+  void push();
+
+  /// Undo all domain changes since the matching push().
+  void pop();
+
+  /**
+   * Restrict the domain of j to a single value and propagate.
+   * Call push() first to be able to undo this.
+   * @return false if this made the CSP infeasible.
+   */
+  bool assign(Key j, size_t value);
+
+  /**
+   * Find a feasible assignment by depth-first search, maintaining arc
+   * consistency and branching on the variable with the smallest domain.
+   * On success, the domains are left at the solution.
+   * @return the assignment, or nothing if the CSP is infeasible.
+   */
+  std::optional<DiscreteValues> solve();
+
+  /// Number of search nodes visited by the last call to solve().
+  size_t nrNodes() const { return nrNodes_; }
+
+ private:
+  /// Check whether the domain of variable i contains a value.
+  bool has(size_t i, size_t value) const {
+    return (words_[offset_[i] + value / 64] >> (value % 64)) & 1;
+  }
+
+  /// Remove a value, return false if the domain became empty.
+  bool remove(size_t i, size_t value, size_t except);
+
+  /// Add a propagator to the queue, unless already there.
+  void enqueue(size_t p);
+
+  /// Revise all domains in the scope of a propagator.
+  bool revise(size_t p);
+
+  /// Check whether a tuple of a table is still allowed by the domains.
+  bool valid(const Propagator& propagator, size_t t) const;
+
+  /// Recursive part of solve().
+  bool search();
+};
+
+}  // namespace gtsam
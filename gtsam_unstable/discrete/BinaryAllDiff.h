@@ -23,7 +23,7 @@ class BinaryAllDiff : public Constraint {
  public:
   /// Constructor
   BinaryAllDiff(const DiscreteKey& key1, const DiscreteKey& key2)
-      : Constraint(key1.first, key2.first),
+      : Constraint(key1, key2),
         cardinality0_(key1.second),
         cardinality1_(key2.second) {}
 
@@ -7,6 +7,7 @@
 
 #include <gtsam/base/Testable.h>
 #include <gtsam/discrete/DiscreteBayesNet.h>
+#include <gtsam_unstable/discrete/ArcConsistency.h>
 #include <gtsam_unstable/discrete/CSP.h>
 #include <gtsam_unstable/discrete/Domain.h>
 
@@ -39,8 +40,8 @@ bool CSP::runArcConsistency(const VariableIndex& index,
   return changed;
 }
 
-// TODO(dellaert): This is AC1, which is inefficient as any change will cause
-// the algorithm to revisit *all* variables again. Implement AC3.
+// This is AC1, which is inefficient as any change will cause the algorithm to
+// revisit *all* variables again. See ArcConsistency for a queue-based version.
 Domains CSP::runArcConsistency(size_t cardinality, size_t maxIterations) const {
   // Create VariableIndex
   VariableIndex index(*this);
@@ -85,4 +86,8 @@ CSP CSP::partiallyApply(const Domains& domains) const {
   }
   return new_csp;
 }
+
+std::optional<DiscreteValues> CSP::solve() const {
+  return ArcConsistency(*this).solve();
+}
 }  // namespace gtsam
@@ -11,6 +11,8 @@
 #include <gtsam_unstable/discrete/AllDiff.h>
 #include <gtsam_unstable/discrete/SingleValue.h>
 
+#include <optional>
+
 namespace gtsam {
 
 /**
@@ -71,6 +73,14 @@ class GTSAM_UNSTABLE_EXPORT CSP : public DiscreteFactorGraph {
    * Create a new CSP, applying the given Domain constraints.
    */
   CSP partiallyApply(const Domains& domains) const;
+
+  /**
+   * Find a feasible assignment by backtracking search, using the incremental
+   * ArcConsistency engine to propagate after every choice. Unlike optimize,
+   * this ignores soft preferences and only respects zero entries.
+   * @return the assignment, or nothing if the CSP is infeasible.
+   */
+  std::optional<DiscreteValues> solve() const;
 };  // CSP
 
 }  // namespace gtsam
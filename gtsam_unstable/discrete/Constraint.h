@@ -46,6 +46,20 @@ class GTSAM_UNSTABLE_EXPORT Constraint : public DiscreteFactor {
   /// Construct n-way constraint factor.
   Constraint(const KeyVector& js) : DiscreteFactor(js) {}
 
+  /// Construct unary constraint factor, recording the cardinality.
+  Constraint(const DiscreteKey& dkey)
+      : DiscreteFactor(KeyVector{dkey.first}, {{dkey.first, dkey.second}}) {}
+
+  /// Construct binary constraint factor, recording the cardinalities.
+  Constraint(const DiscreteKey& dkey1, const DiscreteKey& dkey2)
+      : DiscreteFactor(KeyVector{dkey1.first, dkey2.first},
+                       {{dkey1.first, dkey1.second},
+                        {dkey2.first, dkey2.second}}) {}
+
+  /// Construct n-way constraint factor, recording the cardinalities.
+  Constraint(const DiscreteKeys& dkeys)
+      : DiscreteFactor(dkeys.indices(), dkeys.cardinalities()) {}
+
   /// construct from container
   template <class KeyIterator>
   Constraint(KeyIterator beginKey, KeyIterator endKey)
@@ -26,14 +26,14 @@ class GTSAM_UNSTABLE_EXPORT Domain : public Constraint {
 
   // Constructor on Discrete Key initializes an "all-allowed" domain
   Domain(const DiscreteKey& dkey)
-      : Constraint(dkey.first), cardinality_(dkey.second) {
+      : Constraint(dkey), cardinality_(dkey.second) {
     for (size_t v = 0; v < cardinality_; v++) values_.insert(v);
   }
 
   // Constructor on Discrete Key with single allowed value
   // Consider SingleValue constraint
   Domain(const DiscreteKey& dkey, size_t v)
-      : Constraint(dkey.first), cardinality_(dkey.second) {
+      : Constraint(dkey), cardinality_(dkey.second) {
     values_.insert(v);
   }
 
@@ -29,11 +29,11 @@ class GTSAM_UNSTABLE_EXPORT SingleValue : public Constraint {
 
   /// Construct from key, cardinality, and given value.
   SingleValue(Key key, size_t n, size_t value)
-      : Constraint(key), cardinality_(n), value_(value) {}
+      : Constraint(DiscreteKey(key, n)), cardinality_(n), value_(value) {}
 
   /// Construct from DiscreteKey and given value.
   SingleValue(const DiscreteKey& dkey, size_t value)
-      : Constraint(dkey.first), cardinality_(dkey.second), value_(value) {}
+      : Constraint(dkey), cardinality_(dkey.second), value_(value) {}
 
   // print
   void print(const std::string& s = "", const KeyFormatter& formatter =
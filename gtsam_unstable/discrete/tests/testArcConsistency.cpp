@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/*
+ * @file testArcConsistency.cpp
+ * @brief Unit tests for the incremental arc-consistency engine
+ * @date October 2026
+ */
+
+#include <CppUnitLite/TestHarness.h>
+#include <gtsam/base/Testable.h>
+#include <gtsam/discrete/DecisionTreeFactor.h>
+#include <gtsam/discrete/TableFactor.h>
+#include <gtsam_unstable/discrete/ArcConsistency.h>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// Same problem as in testCSP: three states, three colors, Arizona fixed.
+TEST(ArcConsistency, AllDiff) {
+  size_t nrColors = 3;
+  DiscreteKey ID(0, nrColors), AZ(1, nrColors), UT(2, nrColors);
+  CSP csp;
+  csp.addAllDiff(ID & UT & AZ);
+  csp.addSingleValue(AZ, 2);
+
+  ArcConsistency ac(csp);
+  LONGS_EQUAL(3, ac.nrVariables());
+  LONGS_EQUAL(1, ac.nrValues(AZ.first));  // unary constraints applied at once
+  EXPECT(ac.propagate());
+  LONGS_EQUAL(2, ac.nrValues(ID.first));
+  LONGS_EQUAL(2, ac.nrValues(UT.first));
+  EXPECT(!ac.contains(UT.first, 2));
+
+  // Domains can be used with partiallyApply, as the AC-1 version.
+  const Domains domains = ac.domains();
+  LONGS_EQUAL(2, domains.at(ID.first).nrValues());
+  LONGS_EQUAL(1, domains.at(AZ.first).nrValues());
+
+  // Assigning ID propagates to UT, and can be undone.
+  ac.push();
+  EXPECT(ac.assign(ID.first, 1));
+  LONGS_EQUAL(1, ac.nrValues(UT.first));
+  EXPECT(ac.contains(UT.first, 0));
+  ac.pop();
+  LONGS_EQUAL(2, ac.nrValues(ID.first));
+  LONGS_EQUAL(2, ac.nrValues(UT.first));
+
+  // Any solution is feasible.
+  auto solution = csp.solve();
+  CHECK(solution);
+  EXPECT_DOUBLES_EQUAL(1, csp(*solution), 1e-9);
+}
+
+/* ************************************************************************* */
+// Three mutually different variables with only two colors is infeasible.
+TEST(ArcConsistency, Infeasible) {
+  DiscreteKey A(0, 2), B(1, 2), C(2, 2);
+  CSP csp;
+  csp.addAllDiff(A, B);
+  csp.addAllDiff(B, C);
+  csp.addAllDiff(A, C);
+
+  ArcConsistency ac(csp);
+  EXPECT(ac.propagate());  // arc consistency alone does not see this
+  EXPECT(!ac.solve());
+  EXPECT(!csp.solve());
+
+  // A single AllDiff over all three catches it without search.
+  CSP csp2;
+  csp2.addAllDiff(A & B & C);
+  EXPECT(!ArcConsistency(csp2).propagate());
+}
+
+/* ************************************************************************* */
+// N-queens with binary table constraints, which need search.
+TEST(ArcConsistency, Queens) {
+  const size_t n = 8;
+  CSP csp;
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = i + 1; j < n; j++) {
+      vector<double> table;
+      for (size_t a = 0; a < n; a++)
+        for (size_t b = 0; b < n; b++)
+          table.push_back(a != b && a + j != b + i && a + i != b + j);
+      csp.add(DiscreteKey(i, n) & DiscreteKey(j, n), table);
+    }
+  }
+
+  ArcConsistency ac(csp);
+  auto solution = ac.solve();
+  CHECK(solution);
+  EXPECT_DOUBLES_EQUAL(1, csp(*solution), 1e-9);
+  EXPECT(ac.nrNodes() > 1);
+  // The domains are left at the solution.
+  for (size_t i = 0; i < n; i++) LONGS_EQUAL(1, ac.nrValues(i));
+}
+
+/* ************************************************************************* */
+// Tables are read from their non-zero entries. A decision tree leaf can leave
+// variables free, here B and C when A = 0, as the tree splits on A first.
+TEST(ArcConsistency, Tables) {
+  DiscreteKey A(2, 3), B(1, 3), C(0, 3);
+  // Allowed: A = 0 with any B and C, or A = 1 and B = C.
+  vector<double> table;
+  for (size_t a = 0; a < 3; a++)
+    for (size_t b = 0; b < 3; b++)
+      for (size_t c = 0; c < 3; c++)
+        table.push_back(a == 0 || (a == 1 && b == c));
+  const DecisionTreeFactor tree(A & B & C, table);
+  EXPECT(tree.nrLeaves() < table.size());
+
+  for (const bool sparse : {false, true}) {
+    CSP csp;
+    if (sparse)
+      csp.push_back(std::make_shared<TableFactor>(A & B & C, table));
+    else
+      csp.push_back(std::make_shared<DecisionTreeFactor>(tree));
+    csp.addSingleValue(C, 2);
+
+    ArcConsistency ac(csp);
+    EXPECT(ac.propagate());
+    LONGS_EQUAL(2, ac.nrValues(A.first));
+    EXPECT(!ac.contains(A.first, 2));
+    LONGS_EQUAL(3, ac.nrValues(B.first));
+
+    // With A = 1, B has to equal C.
+    EXPECT(ac.assign(A.first, 1));
+    LONGS_EQUAL(1, ac.nrValues(B.first));
+    EXPECT(ac.contains(B.first, 2));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -124,6 +124,11 @@ TEST(schedulingExample, test) {
   // print MPE, commented out as unit tests don't print
   //  s.printAssignment(MPE);
 
+  // Find a feasible schedule with arc-consistency and backtracking search
+  auto feasible = s.solve();
+  CHECK(feasible);
+  EXPECT(s(*feasible) > 0);
+
   // Commented out as does not work yet
   // s.runArcConsistency(8,10,true);
 
@@ -0,0 +1,377 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    OutOfCoreBayesTree.h
+ * @brief   Keeps the conditionals of cold cliques of a Gaussian Bayes tree in
+ *          a file, within a memory budget.
+ * @date    Oct 19, 2026
+ */
+
+#pragma once
+
+#include <gtsam/inference/BayesTree.h>
+#include <gtsam/linear/GaussianConditional.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * Keeps the conditionals of the least recently used cliques of a Bayes tree of
+ * GaussianConditionals, such as a GaussianBayesTree or the tree of ISAM2, in a
+ * file, so that the conditionals in memory stay within a budget of bytes.
+ * Conditionals smaller than kMinPagedBytes always stay in memory, as a paged
+ * out clique still takes a few hundred bytes, and their cliques are not
+ * tracked.
+ *
+ * The structure of the tree stays in memory: a paged out clique keeps its
+ * parent and children, and its conditional is replaced by one with the same
+ * keys and dimensions but no rows, and so no matrix. The matrix is read back
+ * from the file when the clique is needed by optimize(), marginalFactor() or
+ * pageIn(). Cliques are paged out in least recently used order, and the
+ * cliques of a tree are first used from the leaves up, so the old parts of a
+ * map are paged out as whole subtrees. The file is reused for a clique that is
+ * paged out again with the same conditional, and is removed by the destructor.
+ *
+ * Code that reads the conditionals directly, such as BayesTree::optimize,
+ * needs the cliques it reaches to be paged in first, with pageIn() or
+ * pageInAll(). ISAM2::update re-eliminates the top of its tree from the factors
+ * and from the cached marginals of the subtrees below, so with relinearization
+ * disabled it does not read the conditionals, and can run while cliques are
+ * paged out. The back-substitution of ISAM2 itself, in getDelta,
+ * calculateEstimate and the relinearization check of update, can spread to any
+ * clique, and needs pageInAll(); optimize() gives the full solution without
+ * it. Call track() after the tree changes.
+ *
+ * This class is not thread-safe.
+ */
+template <class BAYESTREE>
+class OutOfCoreBayesTree {
+ public:
+  typedef typename BAYESTREE::Clique Clique;
+  typedef typename BAYESTREE::sharedClique sharedClique;
+  typedef typename BAYESTREE::sharedConditional sharedConditional;
+  typedef typename BAYESTREE::Eliminate Eliminate;
+  typedef typename BAYESTREE::EliminationTraitsType EliminationTraitsType;
+
+  /// Conditionals with smaller matrices are not paged out, or counted
+  static constexpr size_t kMinPagedBytes = 4096;
+
+ private:
+  typedef std::list<const Clique*> Recency;
+
+  /** The paging state of a clique that is large enough to page out */
+  struct Entry {
+    std::weak_ptr<Clique> clique;
+    bool resident = true;
+    size_t bytes = 0;                           // of the matrix in memory, if resident
+    typename Recency::iterator position;        // in recency_, if resident
+    bool hasRecord = false;                     // in the file
+    size_t offset = 0, recordBytes = 0;         // of the record
+    std::weak_ptr<GaussianConditional> written; // the conditional in the record
+    sharedConditional stub;                     // the conditional while paged out
+    SharedDiagonal model;                       // of the conditional while paged out
+  };
+
+  BAYESTREE& bayesTree_;
+  std::string path_;
+  size_t budget_;
+  std::fstream file_;
+  size_t fileSize_ = 0;
+  std::multimap<size_t, size_t> freeRecords_;   // byte size to offset
+  std::unordered_map<const Clique*, Entry> entries_;
+  Recency recency_;                             // resident cliques, least recent first
+  size_t residentBytes_ = 0;
+  size_t nrPagedOut_ = 0;
+
+ public:
+  /**
+   * Page out the cliques of a Bayes tree until their conditionals take at most
+   * budget bytes in memory.
+   * @param bayesTree The Bayes tree, which must outlive this object
+   * @param path The file to store the conditionals in, which is overwritten
+   * @param budget The bytes of conditional matrices to keep in memory
+   */
+  OutOfCoreBayesTree(BAYESTREE& bayesTree, const std::string& path, size_t budget)
+      : bayesTree_(bayesTree), path_(path), budget_(budget) {
+    file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_)
+      throw std::runtime_error("OutOfCoreBayesTree: could not open " + path_);
+    track();
+  }
+
+  /** Page in all cliques and remove the file */
+  ~OutOfCoreBayesTree() {
+    try {
+      pageInAll();
+    } catch (...) {
+    }
+    file_.close();
+    std::remove(path_.c_str());
+  }
+
+  OutOfCoreBayesTree(const OutOfCoreBayesTree&) = delete;
+  OutOfCoreBayesTree& operator=(const OutOfCoreBayesTree&) = delete;
+
+  /// The bytes of conditional matrices in memory
+  size_t residentBytes() const { return residentBytes_; }
+
+  /// The number of cliques whose conditionals are in the file
+  size_t nrPagedOut() const { return nrPagedOut_; }
+
+  /// The budget of bytes of conditional matrices in memory
+  size_t budget() const { return budget_; }
+
+  /// Change the budget, and page out cliques to meet it
+  void setBudget(size_t budget) {
+    budget_ = budget;
+    enforceBudget();
+  }
+
+  /**
+   * Start tracking the cliques added to the tree since the last call, and page
+   * out cliques to meet the budget. New cliques are looked for from the roots
+   * down to the first tracked clique of each path, as ISAM2 only replaces the
+   * top of its tree. Cliques too small to page out are not tracked, so the
+   * walk also passes through those above the tracked cliques. Cliques that
+   * were removed from the tree are forgotten, and their records reused.
+   */
+  void track() {
+    std::vector<const Clique*> removed;
+    for (const auto& [key, entry] : entries_)
+      if (entry.clique.expired()) removed.push_back(key);
+    for (const Clique* key : removed) forget(key);
+
+    // post-order, so that the leaves are the least recently used
+    std::vector<std::pair<sharedClique, bool> > stack;
+    for (const sharedClique& root : bayesTree_.roots()) stack.emplace_back(root, false);
+    while (!stack.empty()) {
+      const auto [clique, expanded] = stack.back();
+      stack.pop_back();
+      if (expanded) {
+        const size_t bytes = matrixBytes(*clique->conditional());
+        if (bytes < kMinPagedBytes) continue;
+        Entry& entry = entries_[clique.get()];
+        entry.clique = clique;
+        entry.bytes = bytes;
+        entry.position = recency_.insert(recency_.end(), clique.get());
+        residentBytes_ += entry.bytes;
+        continue;
+      }
+      if (isTracked(clique.get())) continue;
+      stack.emplace_back(clique, true);
+      for (const sharedClique& child : clique->children) stack.emplace_back(child, false);
+    }
+    enforceBudget();
+  }
+
+  /** Page out the least recently used cliques until the budget is met */
+  void enforceBudget() {
+    while (residentBytes_ > budget_ && !recency_.empty()) {
+      const Clique* key = recency_.front();
+      Entry& entry = entries_.at(key);
+      const sharedClique clique = entry.clique.lock();
+      if (!clique) {
+        forget(key);
+        continue;
+      }
+      pageOut(*clique, entry);
+    }
+  }
+
+  /**
+   * Page in the cliques of the given variables, their ancestors, and the
+   * children of these, e.g., before reading the conditionals of the variables.
+   */
+  void pageIn(const KeyVector& keys) {
+    for (Key key : keys) {
+      const auto node = bayesTree_.nodes().find(key);
+      if (node == bayesTree_.nodes().end()) continue;  // a new variable
+      for (sharedClique clique = node->second; clique; clique = clique->parent()) {
+        install(*clique);
+        for (const sharedClique& child : clique->children) install(*child);
+      }
+    }
+  }
+
+  /** Page in all cliques */
+  void pageInAll() {
+    std::vector<sharedClique> stack(bayesTree_.roots().begin(), bayesTree_.roots().end());
+    while (!stack.empty()) {
+      const sharedClique clique = stack.back();
+      stack.pop_back();
+      install(*clique);
+      stack.insert(stack.end(), clique->children.begin(), clique->children.end());
+    }
+  }
+
+  /**
+   * Solve the Bayes tree by back-substitution. The cliques that are paged out
+   * are read and solved without being paged in, so that a full solve does not
+   * push the recently used cliques out of memory.
+   */
+  VectorValues optimize() {
+    VectorValues result;
+    std::vector<sharedClique> stack(bayesTree_.roots().rbegin(), bayesTree_.roots().rend());
+    while (!stack.empty()) {
+      const sharedClique clique = stack.back();
+      stack.pop_back();
+      const sharedConditional conditional = use(*clique);
+      result.insert(conditional->solve(result));
+      stack.insert(stack.end(), clique->children.rbegin(), clique->children.rend());
+    }
+    return result;
+  }
+
+  /** Compute the marginal of a variable, paging in its clique and its ancestors */
+  sharedConditional marginalFactor(Key j,
+      const Eliminate& function = EliminationTraitsType::DefaultEliminate) {
+    for (sharedClique clique = bayesTree_[j]; clique; clique = clique->parent()) install(*clique);
+    const sharedConditional marginal = bayesTree_.marginalFactor(j, function);
+    enforceBudget();
+    return marginal;
+  }
+
+  /** Compute the marginal covariance of a variable */
+  Matrix marginalCovariance(Key j) {
+    return marginalFactor(j)->information().inverse();
+  }
+
+ private:
+  static size_t matrixBytes(const GaussianConditional& conditional) {
+    return conditional.matrixObject().full().size() * sizeof(double);
+  }
+
+  bool isTracked(const Clique* key) const {
+    const auto it = entries_.find(key);
+    return it != entries_.end() && !it->second.clique.expired();
+  }
+
+  /** The entry of a tracked clique, or null for a clique that is resident */
+  Entry* find(const Clique& clique) {
+    const auto it = entries_.find(&clique);
+    if (it == entries_.end() || it->second.clique.expired()) return nullptr;
+    return &it->second;
+  }
+
+  /** Stop tracking a clique that is no longer in the tree */
+  void forget(const Clique* key) {
+    Entry& entry = entries_.at(key);
+    if (entry.resident) {
+      recency_.erase(entry.position);
+      residentBytes_ -= entry.bytes;
+    } else {
+      --nrPagedOut_;
+    }
+    if (entry.hasRecord) freeRecords_.emplace(entry.recordBytes, entry.offset);
+    entries_.erase(key);
+  }
+
+  /** Find space in the file for a record of the given bytes */
+  size_t allocate(size_t bytes) {
+    const auto it = freeRecords_.lower_bound(bytes);
+    if (it == freeRecords_.end()) {
+      fileSize_ += bytes;
+      return fileSize_ - bytes;
+    }
+    const size_t offset = it->second;
+    if (it->first > bytes) freeRecords_.emplace(it->first - bytes, offset + bytes);
+    freeRecords_.erase(it);
+    return offset;
+  }
+
+  void pageOut(Clique& clique, Entry& entry) {
+    const sharedConditional conditional = clique.conditional();
+    if (entry.written.lock() != conditional) {
+      // the record is missing or holds a previous conditional
+      if (entry.hasRecord) freeRecords_.emplace(entry.recordBytes, entry.offset);
+      const Matrix full = conditional->matrixObject().full();
+      entry.recordBytes = full.size() * sizeof(double);
+      entry.offset = allocate(entry.recordBytes);
+      file_.seekp(entry.offset);
+      file_.write(reinterpret_cast<const char*>(full.data()), entry.recordBytes);
+      if (!file_)
+        throw std::runtime_error("OutOfCoreBayesTree: could not write to " + path_);
+      entry.hasRecord = true;
+      entry.written = conditional;
+    }
+
+    std::vector<DenseIndex> dims;
+    for (auto it = conditional->begin(); it != conditional->end(); ++it)
+      dims.push_back(conditional->getDim(it));
+    entry.stub = std::make_shared<GaussianConditional>(conditional->keys(),
+        conditional->nrFrontals(), VerticalBlockMatrix(dims, 0, true));
+    entry.model = conditional->get_model();
+    clique.conditional() = entry.stub;
+    clique.deleteCachedShortcuts();
+
+    recency_.erase(entry.position);
+    entry.resident = false;
+    residentBytes_ -= entry.bytes;
+    ++nrPagedOut_;
+  }
+
+  /** Read the conditional of a paged out clique from the file */
+  sharedConditional read(const Entry& entry) {
+    const GaussianConditional& stub = *entry.stub;
+    std::vector<DenseIndex> dims;
+    for (auto it = stub.begin(); it != stub.end(); ++it) dims.push_back(stub.getDim(it));
+    const DenseIndex cols = stub.matrixObject().cols();
+    VerticalBlockMatrix Ab(dims, entry.recordBytes / sizeof(double) / cols, true);
+    file_.seekg(entry.offset);
+    file_.read(reinterpret_cast<char*>(Ab.matrix().data()), entry.recordBytes);
+    if (!file_)
+      throw std::runtime_error("OutOfCoreBayesTree: could not read from " + path_);
+    return std::make_shared<GaussianConditional>(stub.keys(), stub.nrFrontals(), Ab, entry.model);
+  }
+
+  /** The conditional of a clique, read without paging it in if paged out */
+  sharedConditional use(const Clique& clique) {
+    Entry* entry = find(clique);
+    if (!entry) return clique.conditional();
+    if (!entry->resident) return read(*entry);
+    recency_.splice(recency_.end(), recency_, entry->position);
+    return clique.conditional();
+  }
+
+  /** Page in a clique, and mark it as the most recently used */
+  void install(Clique& clique) {
+    Entry* found = find(clique);
+    if (!found) return;
+    Entry& entry = *found;
+    if (entry.resident) {
+      recency_.splice(recency_.end(), recency_, entry.position);
+      return;
+    }
+    const sharedConditional conditional = read(entry);
+    clique.conditional() = conditional;
+    entry.written = conditional;
+    entry.stub.reset();
+    entry.model.reset();
+    entry.resident = true;
+    entry.bytes = entry.recordBytes;
+    entry.position = recency_.insert(recency_.end(), &clique);
+    residentBytes_ += entry.bytes;
+    --nrPagedOut_;
+  }
+};
+
+}  // namespace gtsam
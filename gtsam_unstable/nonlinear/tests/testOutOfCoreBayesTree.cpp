@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testOutOfCoreBayesTree.cpp
+ * @brief   Unit tests for paging the conditionals of a Bayes tree to a file
+ * @date    Oct 19, 2026
+ */
+
+#include <gtsam_unstable/nonlinear/OutOfCoreBayesTree.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/linear/GaussianBayesTree.h>
+#include <gtsam/nonlinear/ISAM2.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <CppUnitLite/TestHarness.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+
+/// Path of the file the conditionals are paged to
+string pagePath() {
+  return (filesystem::temp_directory_path() / "testOutOfCoreBayesTree.bin").string();
+}
+
+/// An n x n grid of poses with perturbed relative pose measurements
+void createGrid(NonlinearFactorGraph& graph, Values& values, size_t n = 10) {
+  graph.addPrior(0, Pose2(), model);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      const Key key = i * n + j;
+      const double noise = 0.05 * sin(3.0 * key);
+      if (j + 1 < n)
+        graph.emplace_shared<BetweenFactor<Pose2> >(key, key + 1, Pose2(1 + noise, noise, noise), model);
+      if (i + 1 < n)
+        graph.emplace_shared<BetweenFactor<Pose2> >(key, key + n, Pose2(noise, 1 - noise, -noise), model);
+      values.insert(key, Pose2(j + 0.1 * cos(key), i + 0.1 * sin(key), 0.05 * cos(2.0 * key)));
+    }
+  }
+}
+
+/// The number of rows of the conditional of the clique of a variable
+template <class BAYESTREE>
+size_t rows(const BAYESTREE& bayesTree, Key j) {
+  return bayesTree[j]->conditional()->rows();
+}
+
+/// The number of cliques that are large enough to be paged out
+template <class BAYESTREE>
+size_t nrPageable(const BAYESTREE& bayesTree) {
+  size_t count = 0;
+  for (const auto& [key, clique] : bayesTree.nodes())
+    if (clique->conditional()->front() == key &&
+        clique->conditional()->matrixObject().full().size() * sizeof(double) >=
+            OutOfCoreBayesTree<BAYESTREE>::kMinPagedBytes)
+      ++count;
+  return count;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST( OutOfCoreBayesTree, gaussianBayesTree )
+{
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(graph, values);
+  const GaussianBayesTree::shared_ptr bayesTree =
+      graph.linearize(values)->eliminateMultifrontal();
+  const VectorValues expected = bayesTree->optimize();
+  const Key j = bayesTree->roots().front()->conditional()->front();
+  const Matrix expectedCovariance = bayesTree->marginalFactor(j)->information().inverse();
+  bayesTree->deleteCachedShortcuts();
+  const size_t pageable = nrPageable(*bayesTree);
+  CHECK(pageable > 0);
+
+  {
+    // with no budget, the large conditionals are paged out and stay paged out
+    OutOfCoreBayesTree<GaussianBayesTree> outOfCore(*bayesTree, pagePath(), 0);
+    LONGS_EQUAL(pageable, outOfCore.nrPagedOut());
+    LONGS_EQUAL(0, outOfCore.residentBytes());
+    LONGS_EQUAL(0, rows(*bayesTree, j));
+
+    EXPECT(assert_equal(expected, outOfCore.optimize()));
+    EXPECT(assert_equal(expectedCovariance, outOfCore.marginalCovariance(j)));
+    LONGS_EQUAL(pageable, outOfCore.nrPagedOut());
+
+    // the cliques of a variable and its ancestors are paged in on request
+    outOfCore.setBudget(1 << 20);
+    outOfCore.pageIn(KeyVector{j});
+    EXPECT(rows(*bayesTree, j) > 0);
+    EXPECT(outOfCore.nrPagedOut() < pageable);
+    EXPECT(outOfCore.residentBytes() > 0);
+
+    // once paged in, the tree is the same as before
+    outOfCore.pageInAll();
+    LONGS_EQUAL(0, outOfCore.nrPagedOut());
+    EXPECT(assert_equal(expected, bayesTree->optimize()));
+
+    // paging out again reuses the file
+    outOfCore.setBudget(0);
+    EXPECT(assert_equal(expected, outOfCore.optimize()));
+  }
+
+  // the destructor pages the tree back in
+  EXPECT(rows(*bayesTree, j) > 0);
+  EXPECT(assert_equal(expected, bayesTree->optimize()));
+  EXPECT(!filesystem::exists(pagePath()));
+}
+
+/* ************************************************************************* */
+TEST( OutOfCoreBayesTree, isam2 )
+{
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(graph, values);
+  const ISAM2Params params(ISAM2GaussNewtonParams(0.0));
+  ISAM2 isam(params), reference(params);
+  isam.update(graph, values);
+  reference.update(graph, values);
+  const VectorValues expected = isam.getDelta();
+  const Key j = isam.roots().front()->conditional()->front();
+  const Matrix expectedCovariance = isam.marginalCovariance(j);
+  const size_t pageable = nrPageable(isam);
+  CHECK(pageable > 0);
+
+  OutOfCoreBayesTree<ISAM2> outOfCore(isam, pagePath(), 0);
+  LONGS_EQUAL(pageable, outOfCore.nrPagedOut());
+  EXPECT(assert_equal(expected, outOfCore.optimize()));
+  EXPECT(assert_equal(expectedCovariance, outOfCore.marginalCovariance(j)));
+
+  // a loop closure moves the whole map, so the tree is paged in to update it
+  NonlinearFactorGraph loopClosure;
+  loopClosure.emplace_shared<BetweenFactor<Pose2> >(99, 0, Pose2(-9, -9, 0), model);
+  outOfCore.pageInAll();
+  isam.update(loopClosure);
+  reference.update(loopClosure);
+  const size_t pageableAfter = nrPageable(isam);
+  outOfCore.track();
+  LONGS_EQUAL(pageableAfter, outOfCore.nrPagedOut());
+  EXPECT(assert_equal(reference.getDelta(), outOfCore.optimize()));
+}
+
+/* ************************************************************************* */
+TEST( OutOfCoreBayesTree, isam2Incremental )
+{
+  // a 20x20 grid, of which the last three rows are added incrementally
+  const size_t n = 20, split = 17 * n;
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(graph, values, n);
+  NonlinearFactorGraph firstRows, lastRows;
+  for (const auto& factor : graph) {
+    const KeyVector& keys = factor->keys();
+    (*max_element(keys.begin(), keys.end()) < split ? firstRows : lastRows).push_back(factor);
+  }
+  Values firstValues, lastValues;
+  for (Key key = 0; key < n * n; ++key)
+    (key < split ? firstValues : lastValues).insert(key, values.at<Pose2>(key));
+
+  // without relinearization, ISAM2::update does not read the conditionals
+  ISAM2Params params(ISAM2GaussNewtonParams(0.0));
+  params.enableRelinearization = false;
+  ISAM2 isam(params), reference(params);
+  isam.update(firstRows, firstValues);
+  reference.update(firstRows, firstValues);
+
+  OutOfCoreBayesTree<ISAM2> outOfCore(isam, pagePath(), 0);
+  CHECK(outOfCore.nrPagedOut() > 0);
+  isam.update(lastRows, lastValues);
+  reference.update(lastRows, lastValues);
+
+  // the cliques that the update replaced are forgotten, the new ones paged out
+  outOfCore.track();
+  LONGS_EQUAL(nrPageable(reference), outOfCore.nrPagedOut());
+  EXPECT(assert_equal(reference.getDelta(), outOfCore.optimize()));
+
+  // the cliques of the new variables are paged in on request
+  const KeyVector keys = lastRows.keyVector();
+  outOfCore.pageIn(keys);
+  for (Key key : keys)
+    EXPECT(assert_equal(*reference[key]->conditional(), *isam[key]->conditional()));
+
+  // once paged in, the tree is the same as the reference
+  outOfCore.pageInAll();
+  LONGS_EQUAL(0, outOfCore.nrPagedOut());
+  for (const auto& [key, clique] : reference.nodes())
+    EXPECT(assert_equal(*clique->conditional(), *isam[key]->conditional()));
+  EXPECT(assert_equal(reference.getDelta(), isam.getDelta()));
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
+/* ************************************************************************* */
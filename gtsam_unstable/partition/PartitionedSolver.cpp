@@ -0,0 +1,294 @@
+/*
+ * PartitionedSolver.cpp
+ *
+ *   Created on: Oct 19, 2026
+ *  Description: optimize a nonlinear factor graph by nested dissection into
+ *               submaps, which are optimized independently and marginalized
+ *               onto their separators (Tectonic SAM)
+ */
+
+#include <gtsam/config.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/linear/GaussianBayesNet.h>
+#include <gtsam/linear/GaussianBayesTree.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/nonlinear/LinearContainerFactor.h>
+#include <gtsam/nonlinear/NonlinearOptimizer.h>
+
+#include "PartitionedSolver.h"
+
+#include <metis.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+using namespace std;
+
+namespace gtsam { namespace partition {
+
+  typedef PartitionedSolver::Submap Submap;
+
+  namespace {
+
+  /* ************************************************************************* */
+  /** call f(i) for i in [0, n), in parallel if TBB is available */
+  template <class F>
+  void parallelFor(size_t n, const F& f) {
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(size_t(0), n, f);
+#else
+    for (size_t i = 0; i < n; ++i) f(i);
+#endif
+  }
+
+  /* ************************************************************************* */
+  /** the state of the recursive dissection */
+  struct Dissection {
+    const KeyVector& keys;                       // the key of each variable
+    const vector<vector<size_t> >& neighbors;    // the adjacency of the variables
+    size_t maxVariables;
+    vector<pair<Submap*, size_t> > owners;       // the node and depth of each variable
+    vector<idx_t> position;                      // scratch, -1 outside of a call
+
+    Dissection(const KeyVector& keys_in, const vector<vector<size_t> >& neighbors_in, size_t maxVariables_in)
+    : keys(keys_in), neighbors(neighbors_in), maxVariables(maxVariables_in),
+      owners(keys_in.size()), position(keys_in.size(), -1) {}
+
+    /** split the variables into two parts and their separator with METIS */
+    void bisect(const vector<size_t>& variables, vector<size_t>& A, vector<size_t>& B, vector<size_t>& C) {
+      idx_t n = variables.size();
+      for (idx_t i = 0; i < n; ++i) position[variables[i]] = i;
+      vector<idx_t> xadj(1, 0), adjncy;
+      for (size_t j : variables) {
+        for (size_t k : neighbors[j])
+          if (position[k] >= 0) adjncy.push_back(position[k]);
+        xadj.push_back(adjncy.size());
+      }
+      for (size_t j : variables) position[j] = -1;
+
+      vector<idx_t> part(n, 0);
+      if (adjncy.empty()) {
+        // no edges: any split has an empty separator
+        fill(part.begin() + n / 2, part.end(), 1);
+      } else {
+        idx_t options[METIS_NOPTIONS];
+        METIS_SetDefaultOptions(options);
+        vector<idx_t> vwgt(n, 1);
+        idx_t sepsize;
+        if (METIS_ComputeVertexSeparator(&n, xadj.data(), adjncy.data(), vwgt.data(), options, &sepsize,
+            part.data()) != METIS_OK)
+          throw runtime_error("PartitionedSolver: METIS failed to compute a vertex separator");
+      }
+      for (idx_t i = 0; i < n; ++i)
+        (part[i] == 0 ? A : part[i] == 1 ? B : C).push_back(variables[i]);
+    }
+
+    /** dissect the variables recursively until the parts are small enough */
+    Submap::shared_ptr dissect(const vector<size_t>& variables, size_t depth) {
+      auto submap = std::make_shared<Submap>();
+      vector<size_t> frontals, A, B;
+      if (variables.size() > maxVariables) bisect(variables, A, B, frontals);
+      if (A.empty() || B.empty()) {
+        // small enough, or METIS could not split it
+        frontals = variables;
+      } else {
+        submap->children.push_back(dissect(A, depth + 1));
+        submap->children.push_back(dissect(B, depth + 1));
+      }
+      for (size_t j : frontals) {
+        submap->frontals.push_back(keys[j]);
+        owners[j] = make_pair(submap.get(), depth);
+      }
+      return submap;
+    }
+  };
+
+  /* ************************************************************************* */
+  /** the variables of ancestors involved in the factors of each subtree */
+  KeySet findBoundaries(Submap& submap, const NonlinearFactorGraph& graph) {
+    KeySet boundary;
+    for (const Submap::shared_ptr& child : submap.children) {
+      const KeySet childBoundary = findBoundaries(*child, graph);
+      boundary.insert(childBoundary.begin(), childBoundary.end());
+    }
+    for (size_t i : submap.factors)
+      boundary.insert(graph[i]->begin(), graph[i]->end());
+    for (Key key : submap.frontals) boundary.erase(key);
+    submap.boundary.assign(boundary.begin(), boundary.end());
+    return boundary;
+  }
+
+  /* ************************************************************************* */
+  /** the result of optimizing and eliminating a submap, on the way up */
+  struct EliminatedSubmap {
+    Values values;                    // the local solution, later the final frontals
+    GaussianBayesNet conditional;     // the frontals given the boundary
+    NonlinearFactorGraph marginal;    // on the boundary, for the parent
+    vector<EliminatedSubmap> children;
+  };
+
+  /* ************************************************************************* */
+  /** the conditionals of a clique and its subtree, parents last */
+  void appendConditionals(const GaussianBayesTree::sharedClique& clique, GaussianBayesNet& bayesNet) {
+    for (const GaussianBayesTree::sharedClique& child : clique->children) appendConditionals(child, bayesNet);
+    bayesNet.push_back(clique->conditional());
+  }
+
+  /* ************************************************************************* */
+  void eliminateUp(const Submap& submap, const NonlinearFactorGraph& graph, const Values& estimate,
+      const GaussNewtonParams& params, EliminatedSubmap& eliminated) {
+    eliminated.children.resize(submap.children.size());
+    parallelFor(submap.children.size(), [&](size_t i) {
+      eliminateUp(*submap.children[i], graph, estimate, params, eliminated.children[i]);
+    });
+
+    NonlinearFactorGraph local;
+    for (size_t i : submap.factors) local.push_back(graph[i]);
+    for (EliminatedSubmap& child : eliminated.children) {
+      local.push_back(child.marginal);
+      child.marginal = NonlinearFactorGraph();
+    }
+    if (local.empty()) return;
+
+    Values& values = eliminated.values;
+    for (Key key : local.keys()) values.insert(key, estimate.at(key));
+    VectorValues fixed;
+    for (Key key : submap.boundary) fixed.insert(key, Vector::Zero(values.at(key).dim()));
+
+    // optimize the frontals with the boundary fixed, with Gauss-Newton steps
+    // that reuse the partial elimination, and keep the last elimination
+    GaussianFactorGraph marginal;
+    double error = local.error(values);
+    bool converged = false;
+    for (size_t iteration = 0;; ++iteration) {
+      const GaussianFactorGraph::shared_ptr linear = local.linearize(values);
+      if (submap.frontals.empty()) {
+        marginal = *linear;
+        break;
+      }
+      const auto [bayesTree, remaining] = linear->eliminatePartialMultifrontal(submap.frontals);
+      eliminated.conditional = GaussianBayesNet();
+      for (const GaussianBayesTree::sharedClique& root : bayesTree->roots())
+        appendConditionals(root, eliminated.conditional);
+      marginal = *remaining;
+      if (converged || iteration == params.maxIterations) break;
+
+      Values next = values.retract(eliminated.conditional.optimize(fixed));
+      const double newError = local.error(next);
+      if (newError > error) break;
+      converged = checkConvergence(params.relativeErrorTol, params.absoluteErrorTol, params.errorTol,
+          error, newError);
+      values = std::move(next);
+      error = newError;
+    }
+    for (const GaussianFactor::shared_ptr& factor : marginal)
+      if (factor && !factor->empty())
+        eliminated.marginal.emplace_shared<LinearContainerFactor>(factor, eliminated.values);
+  }
+
+  /* ************************************************************************* */
+  void substituteDown(const Submap& submap, const Values& boundaryValues, EliminatedSubmap& eliminated) {
+    Values frontals;
+    if (!submap.frontals.empty()) {
+      VectorValues given;
+      for (Key key : submap.boundary)
+        given.insert(key, eliminated.values.at(key).localCoordinates_(boundaryValues.at(key)));
+      const VectorValues delta = eliminated.conditional.optimize(given);
+      for (Key key : submap.frontals) frontals.insert(key, eliminated.values.at(key));
+      frontals = frontals.retract(delta);
+    }
+
+    vector<Values> childBoundaries(submap.children.size());
+    for (size_t i = 0; i < submap.children.size(); ++i)
+      for (Key key : submap.children[i]->boundary)
+        childBoundaries[i].insert(key, frontals.exists(key) ? frontals.at(key) : boundaryValues.at(key));
+    eliminated.values = frontals;
+    eliminated.conditional = GaussianBayesNet();
+
+    parallelFor(submap.children.size(), [&](size_t i) {
+      substituteDown(*submap.children[i], childBoundaries[i], eliminated.children[i]);
+    });
+  }
+
+  /* ************************************************************************* */
+  void collect(const EliminatedSubmap& eliminated, Values& result) {
+    result.update(eliminated.values);
+    for (const EliminatedSubmap& child : eliminated.children) collect(child, result);
+  }
+
+  }  // namespace
+
+  /* ************************************************************************* */
+  PartitionedSolver::PartitionedSolver(const NonlinearFactorGraph& graph,
+      const PartitionedSolverParams& params) : graph_(graph), params_(params) {
+    gttic(PartitionedSolver_dissect);
+    const KeySet keySet = graph_.keys();
+    const KeyVector keys(keySet.begin(), keySet.end());
+    FastMap<Key, size_t> indices;
+    for (size_t j = 0; j < keys.size(); ++j) indices.emplace(keys[j], j);
+
+    // the variables are adjacent if they share a factor
+    vector<vector<size_t> > neighbors(keys.size());
+    for (const NonlinearFactor::shared_ptr& factor : graph_) {
+      if (!factor) continue;
+      for (Key key1 : *factor)
+        for (Key key2 : *factor)
+          if (key1 != key2) neighbors[indices.at(key1)].push_back(indices.at(key2));
+    }
+    for (vector<size_t>& adjacent : neighbors) {
+      sort(adjacent.begin(), adjacent.end());
+      adjacent.erase(unique(adjacent.begin(), adjacent.end()), adjacent.end());
+    }
+
+    vector<size_t> variables(keys.size());
+    for (size_t j = 0; j < keys.size(); ++j) variables[j] = j;
+    Dissection dissection(keys, neighbors, max<size_t>(params_.maxVariablesPerSubmap, 1));
+    root_ = dissection.dissect(variables, 0);
+
+    // each factor belongs to the deepest node of its variables, which all lie
+    // on the path from that node to the root
+    for (size_t i = 0; i < graph_.size(); ++i) {
+      if (!graph_[i] || graph_[i]->empty()) continue;
+      pair<Submap*, size_t> owner(root_.get(), 0);
+      for (Key key : *graph_[i]) {
+        const pair<Submap*, size_t>& candidate = dissection.owners[indices.at(key)];
+        if (candidate.second >= owner.second) owner = candidate;
+      }
+      owner.first->factors.push_back(i);
+    }
+    findBoundaries(*root_, graph_);
+  }
+
+  /* ************************************************************************* */
+  Values PartitionedSolver::iterate(const Values& estimate) const {
+    gttic(PartitionedSolver_iterate);
+    EliminatedSubmap eliminated;
+    eliminateUp(*root_, graph_, estimate, params_.submapParams, eliminated);
+    substituteDown(*root_, Values(), eliminated);
+    Values result = estimate;
+    collect(eliminated, result);
+    return result;
+  }
+
+  /* ************************************************************************* */
+  Values PartitionedSolver::optimize(const Values& initial) const {
+    Values estimate = initial;
+    double error = graph_.error(estimate);
+    for (size_t iteration = 0; iteration < params_.maxIterations; ++iteration) {
+      Values next = iterate(estimate);
+      const double newError = graph_.error(next);
+      if (newError > error) break;
+      estimate = std::move(next);
+      if (checkConvergence(params_.relativeErrorTol, params_.absoluteErrorTol, 0.0, error, newError))
+        break;
+      error = newError;
+    }
+    return estimate;
+  }
+
+}} //namespace
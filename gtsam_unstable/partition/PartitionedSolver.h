@@ -0,0 +1,95 @@
+/*
+ * PartitionedSolver.h
+ *
+ *   Created on: Oct 19, 2026
+ *  Description: optimize a nonlinear factor graph by nested dissection into
+ *               submaps, which are optimized independently and marginalized
+ *               onto their separators (Tectonic SAM)
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/GaussNewtonOptimizer.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam_unstable/dllexport.h>
+
+#include <memory>
+#include <vector>
+
+namespace gtsam { namespace partition {
+
+  /** Parameters of PartitionedSolver */
+  struct GTSAM_UNSTABLE_EXPORT PartitionedSolverParams {
+    /// Parts of the graph with more variables are dissected further
+    size_t maxVariablesPerSubmap = 500;
+
+    /// The maximum number of passes over the dissection tree
+    size_t maxIterations = 10;
+
+    /// The passes stop when the graph error decreases less than this, relative
+    double relativeErrorTol = 1e-5;
+
+    /// The passes stop when the graph error decreases less than this
+    double absoluteErrorTol = 1e-5;
+
+    /// Parameters of the optimization of the variables of each node
+    GaussNewtonParams submapParams;
+  };
+
+  /**
+   * Optimizes a nonlinear factor graph that is too large for a single solver,
+   * as in Tectonic SAM (Ni, Steedly and Dellaert, ICRA 2007). The variables are
+   * dissected recursively with METIS vertex separators, as in FindSeparator,
+   * into a tree whose leaves are submaps and whose inner nodes are the
+   * separators between them. Each factor belongs to the deepest node of its
+   * variables.
+   *
+   * Each pass over the tree goes up and then down:
+   * - Up: each node optimizes its own variables with Gauss-Newton, given its
+   *   factors, the marginals of its children, and the current estimate of the
+   *   variables of its ancestors. It then eliminates its variables from these
+   *   factors, linearized at its local solution. The remaining factors, on the
+   *   variables of its ancestors, are passed up as LinearContainerFactors. The
+   *   children of a node are processed in parallel with TBB, and no node holds
+   *   more than its own factors and the marginals of its children.
+   * - Down: each node updates its variables by back-substitution, given the
+   *   final values of the ancestor variables.
+   *
+   * The marginals are linearized at the local solutions, so a pass is
+   * approximate. When the passes converge, the result is a local minimum of
+   * the whole graph.
+   */
+  class GTSAM_UNSTABLE_EXPORT PartitionedSolver {
+  public:
+
+    /** A node of the dissection tree */
+    struct Submap {
+      typedef std::shared_ptr<Submap> shared_ptr;
+      KeyVector frontals;     ///< the variables eliminated by this node
+      KeyVector boundary;     ///< the variables of ancestors that its factors involve
+      FactorIndices factors;  ///< the factors of the graph that belong to this node
+      std::vector<shared_ptr> children;
+    };
+
+  private:
+    NonlinearFactorGraph graph_;
+    PartitionedSolverParams params_;
+    Submap::shared_ptr root_;
+
+  public:
+    /** Dissect the variables of a graph into submaps */
+    PartitionedSolver(const NonlinearFactorGraph& graph,
+        const PartitionedSolverParams& params = PartitionedSolverParams());
+
+    /** The root of the dissection tree */
+    const Submap::shared_ptr& root() const { return root_; }
+
+    /** Optimize the graph, starting from the initial values of all variables */
+    Values optimize(const Values& initial) const;
+
+    /** Do a single pass up and down the dissection tree */
+    Values iterate(const Values& estimate) const;
+  };
+
+}} //namespace
@@ -0,0 +1,87 @@
+/*
+ * testPartitionedSolver.cpp
+ *
+ *   Created on: Oct 19, 2026
+ *  Description: unit tests for the partitioned solver
+ */
+
+#include <gtsam_unstable/partition/PartitionedSolver.h>
+
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/nonlinear/GaussNewtonOptimizer.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+using namespace gtsam::partition;
+
+namespace {
+  /** a grid of n*n poses with perturbed relative pose measurements between neighbors */
+  void createGrid(size_t n, NonlinearFactorGraph& graph, Values& initial) {
+    const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+    graph.addPrior(0, Pose2(), model);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        const Key key = i * n + j;
+        const double noise = 0.05 * sin(3.0 * key);
+        if (j + 1 < n)
+          graph.emplace_shared<BetweenFactor<Pose2> >(key, key + 1, Pose2(1 + noise, noise, noise), model);
+        if (i + 1 < n)
+          graph.emplace_shared<BetweenFactor<Pose2> >(key, key + n, Pose2(noise, 1 - noise, -noise), model);
+        initial.insert(key, Pose2(j + 0.1 * cos(key), i + 0.1 * sin(key), 0.05 * cos(2.0 * key)));
+      }
+    }
+  }
+
+  void collectFrontals(const PartitionedSolver::Submap& submap, KeyVector& frontals) {
+    frontals.insert(frontals.end(), submap.frontals.begin(), submap.frontals.end());
+    for (const PartitionedSolver::Submap::shared_ptr& child : submap.children)
+      collectFrontals(*child, frontals);
+  }
+}
+
+/* ************************************************************************* */
+TEST ( PartitionedSolver, dissection )
+{
+  NonlinearFactorGraph graph;
+  Values initial;
+  createGrid(10, graph, initial);
+  PartitionedSolverParams params;
+  params.maxVariablesPerSubmap = 10;
+  PartitionedSolver solver(graph, params);
+
+  // every variable is eliminated by exactly one node, and the root separates
+  // two submaps with no more than ten variables in each leaf
+  KeyVector frontals;
+  collectFrontals(*solver.root(), frontals);
+  sort(frontals.begin(), frontals.end());
+  EXPECT(frontals == initial.keys());
+  LONGS_EQUAL(2, solver.root()->children.size());
+  EXPECT(solver.root()->boundary.empty());
+  EXPECT(!solver.root()->children.front()->boundary.empty());
+}
+
+/* ************************************************************************* */
+TEST ( PartitionedSolver, optimize )
+{
+  NonlinearFactorGraph graph;
+  Values initial;
+  createGrid(10, graph, initial);
+  const Values expected = GaussNewtonOptimizer(graph, initial).optimize();
+
+  // the passes converge to the Gauss-Newton solution of the whole graph
+  PartitionedSolverParams params;
+  params.maxVariablesPerSubmap = 10;
+  const Values actual = PartitionedSolver(graph, params).optimize(initial);
+  EXPECT(assert_equal(expected, actual, 1e-4));
+  EXPECT_DOUBLES_EQUAL(graph.error(expected), graph.error(actual), 1e-4);
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
+/* ************************************************************************* */
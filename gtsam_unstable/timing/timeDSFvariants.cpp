@@ -17,13 +17,16 @@
  */
 
 #include <gtsam/base/timing.h>
+#include <gtsam/base/ConcurrentDSF.h>
 #include <gtsam/base/DSFVector.h>
 #include <gtsam_unstable/base/DSF.h>
 #include <gtsam/base/DSFMap.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <random>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -34,7 +37,10 @@ int main(int argc, char* argv[]) {
 
   // Create CSV file for results
   ofstream os("dsf-timing.csv");
-  os << "images,points,matches,Base,Map,BTree" << endl;
+  os << "images,points,matches,Base,Map,Concurrent,ConcurrentThreads" << endl;
+
+  // number of threads for the concurrent DSF
+  const size_t nrThreads = std::max(1u, std::thread::hardware_concurrency());
 
   // loop over number of images
   vector<size_t> ms {10, 20, 30, 40, 50, 100, 200, 300, 400, 500, 1000};
@@ -87,11 +93,47 @@ int main(int argc, char* argv[]) {
       gttoc_(dsftime);
       tictoc_getNode(dsftimeNode, dsftime);
       dsftime = dsftimeNode->secs();
-      os << dsftime << endl;
+      os << dsftime << ",";
       cout << "DSFMap: " << dsftime << " s" << endl;
       tictoc_reset_();
     }
 
+    {
+      // ConcurrentDSF version, single thread
+      double dsftime = 0;
+      gttic_(dsftime);
+      ConcurrentDSF dsf(N); // Allow for N keys
+      for(const Match& m: matches)
+        dsf.merge(m.first, m.second);
+      gttoc_(dsftime);
+      tictoc_getNode(dsftimeNode, dsftime);
+      dsftime = dsftimeNode->secs();
+      os << dsftime << ",";
+      cout << "ConcurrentDSF: " << dsftime << " s" << endl;
+      tictoc_reset_();
+    }
+
+    {
+      // ConcurrentDSF version, matches split over threads
+      double dsftime = 0;
+      gttic_(dsftime);
+      ConcurrentDSF dsf(N); // Allow for N keys
+      vector<thread> threads;
+      for (size_t t = 0; t < nrThreads; t++)
+        threads.emplace_back([&, t]() {
+          for (size_t k = t; k < matches.size(); k += nrThreads)
+            dsf.merge(matches[k].first, matches[k].second);
+        });
+      for (auto& thread : threads) thread.join();
+      gttoc_(dsftime);
+      tictoc_getNode(dsftimeNode, dsftime);
+      dsftime = dsftimeNode->secs();
+      os << dsftime << endl;
+      cout << "ConcurrentDSF, " << nrThreads << " threads: " << dsftime << " s"
+           << endl;
+      tictoc_reset_();
+    }
+
     if (false) {
       // DSF version, functional
       double dsftime = 0;
@@ -128,6 +170,44 @@ int main(int argc, char* argv[]) {
 
   }
 
+  {
+    // Adversarial sequential merges: merging a chain from its end, and then
+    // finding all keys in random order. Linking roots by key builds a single
+    // path here, so the cost is in how shallow the linking keeps the trees.
+    const size_t N = 1000000;
+    cout << "\nChain of " << N << " keys, merged from its end" << endl;
+    vector<size_t> keys(N);
+    for (size_t k = 0; k < N; k++) keys[k] = k;
+    std::mt19937 rng;
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    {
+      double dsftime = 0;
+      gttic_(dsftime);
+      DSFBase dsf(N);
+      for (size_t k = N - 1; k-- > 0;) dsf.merge(k, k + 1);
+      for (size_t k : keys) dsf.find(k);
+      gttoc_(dsftime);
+      tictoc_getNode(dsftimeNode, dsftime);
+      dsftime = dsftimeNode->secs();
+      cout << "DSFBase: " << dsftime << " s" << endl;
+      tictoc_reset_();
+    }
+
+    {
+      double dsftime = 0;
+      gttic_(dsftime);
+      ConcurrentDSF dsf(N);
+      for (size_t k = N - 1; k-- > 0;) dsf.merge(k, k + 1);
+      for (size_t k : keys) dsf.find(k);
+      gttoc_(dsftime);
+      tictoc_getNode(dsftimeNode, dsftime);
+      dsftime = dsftimeNode->secs();
+      cout << "ConcurrentDSF: " << dsftime << " s" << endl;
+      tictoc_reset_();
+    }
+  }
+
   return 0;
 
 }
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testFixedExtendedKalmanFilter.cpp
+ * @brief Test the fixed-size EKF against ExtendedKalmanFilter
+ * @date October 2026
+ */
+
+#include <gtsam/nonlinear/FixedExtendedKalmanFilter.h>
+#include <gtsam/nonlinear/ExtendedKalmanFilter.h>
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/geometry/Point2.h>
+#include <gtsam/geometry/Pose2.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace gtsam;
+
+using symbol_shorthand::X;
+
+/* ************************************************************************* */
+// Same example as ExtendedKalmanFilter.linear, with factors and functions.
+TEST( FixedExtendedKalmanFilter, linear ) {
+  const Point2 difference(1.0, 0.0);
+  const Matrix2 Q = 0.01 * I_2x2, R = 0.0625 * I_2x2;
+  const auto modelQ = noiseModel::Diagonal::Sigmas(Vector2(0.1, 0.1), true);
+  const auto modelR = noiseModel::Diagonal::Sigmas(Vector2(0.25, 0.25), true);
+  const auto P_initial = noiseModel::Diagonal::Sigmas(Vector2(0.1, 0.1));
+
+  for (auto method : {KalmanFilter::QR, KalmanFilter::CHOLESKY}) {
+    FixedExtendedKalmanFilter<Point2> ekf1(Point2(0, 0), P_initial, method);
+    FixedExtendedKalmanFilter<Point2> ekf2(Point2(0, 0), Matrix2(0.01 * I_2x2),
+                                           method);
+    const auto f = [&](const Point2& x, OptionalJacobian<2, 2> H) {
+      if (H) H->setIdentity();
+      return Point2(x + difference);
+    };
+    const auto h = [](const Point2& x, OptionalJacobian<2, 2> H) {
+      if (H) H->setIdentity();
+      return x;
+    };
+
+    for (size_t k = 1; k <= 3; k++) {
+      const Point2 expected(k, 0.0);
+      EXPECT(assert_equal(
+          expected, ekf1.predict(BetweenFactor<Point2>(X(k - 1), X(k),
+                                                       difference, modelQ))));
+      EXPECT(assert_equal(expected, ekf2.predict(f, Q)));
+      EXPECT(assert_equal(ekf1.covariance(), ekf2.covariance(), 1e-9));
+
+      EXPECT(assert_equal(
+          expected, ekf1.update(PriorFactor<Point2>(X(k), expected, modelR))));
+      EXPECT(assert_equal(expected, ekf2.update(h, expected, R)));
+      EXPECT(assert_equal(ekf1.covariance(), ekf2.covariance(), 1e-9));
+    }
+  }
+}
+
+/* ************************************************************************* */
+// Factors on Pose2 give the same estimates as ExtendedKalmanFilter.
+TEST( FixedExtendedKalmanFilter, factors ) {
+  const Pose2 x0(1, 2, 0.3), odometry(1, 0.1, 0.2);
+  const auto P0 = noiseModel::Gaussian::Covariance(
+      (Matrix3() << 0.1, 0.01, 0, 0.01, 0.2, 0.02, 0, 0.02, 0.05).finished());
+  const auto modelQ = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  const auto modelR = noiseModel::Diagonal::Sigmas(Vector3(0.3, 0.3, 0.1));
+
+  for (auto method : {KalmanFilter::QR, KalmanFilter::CHOLESKY}) {
+    ExtendedKalmanFilter<Pose2> expected(X(0), x0, P0);
+    FixedExtendedKalmanFilter<Pose2> actual(x0, P0, method);
+
+    Pose2 truth = x0;
+    for (size_t k = 1; k <= 5; k++) {
+      const BetweenFactor<Pose2> motion(X(k - 1), X(k), odometry, modelQ);
+      EXPECT(assert_equal(expected.predict(motion), actual.predict(motion),
+                          1e-9));
+
+      truth = truth * odometry;
+      const Pose2 z = truth * Pose2(0.1, -0.1, 0.02 * k);
+      const PriorFactor<Pose2> measurement(X(k), z, modelR);
+      EXPECT(assert_equal(expected.update(measurement),
+                          actual.update(measurement), 1e-9));
+      const Matrix information = expected.Density()->information();
+      EXPECT(assert_equal(information, Matrix(actual.covariance().inverse()),
+                          1e-6));
+    }
+  }
+}
+
+/* ************************************************************************* */
+// Nonlinear motion and measurement functions with fixed-size Jacobians.
+TEST( FixedExtendedKalmanFilter, functions ) {
+  const Pose2 x0(1, 2, 0.3), odometry(1, 0.1, 0.2);
+  const Matrix3 P0 = Vector3(0.1, 0.2, 0.05).asDiagonal();
+  const Matrix3 Q = Vector3(0.01, 0.01, 0.0025).asDiagonal();
+  const Matrix2 R = 0.09 * I_2x2;
+
+  const auto f = [&](const Pose2& x, OptionalJacobian<3, 3> H) {
+    return x.compose(odometry, H);
+  };
+  const auto h = [](const Pose2& x, OptionalJacobian<2, 3> H) {
+    return x.translation(H);
+  };
+
+  FixedExtendedKalmanFilter<Pose2> qr(x0, P0, KalmanFilter::QR);
+  FixedExtendedKalmanFilter<Pose2> cholesky(x0, P0, KalmanFilter::CHOLESKY);
+
+  // Prediction is the composition, and propagates the covariance
+  const Matrix3 F = odometry.inverse().AdjointMap();
+  EXPECT(assert_equal(x0 * odometry, qr.predict(f, Q)));
+  EXPECT(assert_equal(x0 * odometry, cholesky.predict(f, Q)));
+  const Matrix3 expected = F * P0 * F.transpose() + Q;
+  EXPECT(assert_equal(expected, qr.covariance(), 1e-9));
+  EXPECT(assert_equal(expected, cholesky.covariance(), 1e-9));
+
+  // A position measurement moves the estimate towards it
+  const Point2 z = (x0 * odometry).translation() + Point2(0.2, -0.1);
+  const Pose2 updated = qr.update(h, z, R);
+  EXPECT(assert_equal(updated, cholesky.update(h, z, R), 1e-9));
+  EXPECT(assert_equal(qr.covariance(), cholesky.covariance(), 1e-9));
+  EXPECT((updated.translation() - z).norm() < Point2(0.2, -0.1).norm());
+  EXPECT(qr.covariance().trace() < expected.trace());
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testFusedExpressionFactor.cpp
+ * @date October 2026
+ * @brief unit tests for fused, compile-time expressions
+ */
+
+#include <CppUnitLite/TestHarness.h>
+#include <gtsam/base/Testable.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/ExpressionFactorGraph.h>
+#include <gtsam/nonlinear/FusedExpressionFactor.h>
+#include <gtsam/nonlinear/factorTesting.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/expressions.h>
+#include <gtsam/slam/fusedExpressions.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+const Point2 kMeasured(310, 250);
+const SharedNoiseModel kModel = noiseModel::Isotropic::Sigma(2, 0.5);
+
+Values CameraValues() {
+  Values values;
+  values.insert(1, Pose3(Rot3::Ypr(0.1, 0.2, 0.3), Point3(1, 2, 3)));
+  values.insert(2, Point3(4, 5, 16));
+  values.insert(3, Cal3_S2(500, 480, 0.1, 320, 240));
+  return values;
+}
+
+// Compare a fused factor with an ExpressionFactor: keys, error, unwhitened
+// error with Jacobians, and linearization.
+bool CompareFactors(const NoiseModelFactor& expected,
+                    const NoiseModelFactor& actual, const Values& values) {
+  if (expected.keys() != actual.keys()) return false;
+  if (std::abs(expected.error(values) - actual.error(values)) > 1e-9)
+    return false;
+  const size_t n = expected.size();
+  std::vector<Matrix> H1(n), H2(n);
+  if (!assert_equal(expected.unwhitenedError(values, H1),
+                    actual.unwhitenedError(values, H2), 1e-9))
+    return false;
+  for (size_t i = 0; i < n; i++)
+    if (!assert_equal(H1[i], H2[i], 1e-9)) return false;
+  return assert_equal(*expected.linearize(values), *actual.linearize(values),
+                      1e-9);
+}
+
+template <class E>
+FusedExpressionFactor<E> MakeFactor(const SharedNoiseModel& model,
+                                    const typename E::Type& z, const E& h) {
+  return FusedExpressionFactor<E>(model, z, h);
+}
+}  // namespace
+
+/* ************************************************************************* */
+// Uncalibrated projection as a tree of fused nodes.
+TEST(FusedExpressionFactor, Tree) {
+  const Values values = CameraValues();
+  const ExpressionFactor<Point2> expected(
+      kModel, kMeasured,
+      uncalibrate(Cal3_S2_(3), project(transformTo(Pose3_(1), Point3_(2)))));
+
+  const auto h = fused::uncalibrate(
+      fused::Leaf<Cal3_S2>(3),
+      fused::project(fused::transformTo(fused::Pose3_(1), fused::Point3_(2))));
+  const auto actual = MakeFactor(kModel, kMeasured, h);
+  EXPECT(CompareFactors(expected, actual, values));
+  EXPECT_CORRECT_FACTOR_JACOBIANS(actual, values, 1e-7, 1e-5);
+}
+
+/* ************************************************************************* */
+// Calibrated projection fused into one node, with a constant calibration.
+TEST(FusedExpressionFactor, Project3Constant) {
+  const Values values = CameraValues();
+  const Cal3_S2 K = values.at<Cal3_S2>(3);
+  const ExpressionFactor<Point2> expected(
+      kModel, kMeasured, project3(Pose3_(1), Point3_(2), Cal3_S2_(K)));
+
+  const auto actual = MakeFactor(
+      kModel, kMeasured,
+      fused::project3(fused::Pose3_(1), fused::Point3_(2),
+                      fused::Constant<Cal3_S2>(K)));
+  EXPECT_LONGS_EQUAL(2, actual.size());
+  EXPECT(CompareFactors(expected, actual, values));
+}
+
+/* ************************************************************************* */
+// Lie group operations, with a key appearing twice in the tree.
+TEST(FusedExpressionFactor, LieOperations) {
+  Values values;
+  values.insert(1, Pose3(Rot3::Ypr(0.1, 0.2, 0.3), Point3(1, 2, 3)));
+  values.insert(2, Pose3(Rot3::Ypr(-0.3, 0.1, 0.2), Point3(2, 1, 0)));
+  const Pose3 measured(Rot3::Ypr(0.2, 0.1, 0), Point3(1, 0, -1));
+  const auto model = noiseModel::Isotropic::Sigma(6, 0.1);
+
+  const BetweenFactor<Pose3> expected(1, 2, measured, model);
+  const fused::Pose3_ x1(1), x2(2);
+  EXPECT(CompareFactors(expected,
+                        MakeFactor(model, measured, fused::between(x1, x2)),
+                        values));
+  EXPECT(CompareFactors(expected,
+                        MakeFactor(model, measured, fused::inverse(x1) * x2),
+                        values));
+
+  const ExpressionFactor<Pose3> expected2(
+      model, measured, Pose3_(1) * Pose3_(2) * Pose3_(1));
+  EXPECT(CompareFactors(
+      expected2, MakeFactor(model, measured, fused::compose(x1 * x2, x1)),
+      values));
+}
+
+/* ************************************************************************* */
+// An Expression<T> as a sub-tree of a fused expression.
+TEST(FusedExpressionFactor, Wrapped) {
+  const Values values = CameraValues();
+  const ExpressionFactor<Point2> expected(
+      kModel, kMeasured,
+      uncalibrate(Cal3_S2_(3), project(transformTo(Pose3_(1), Point3_(2)))));
+
+  const Point3_ p_cam = transformTo(Pose3_(1), Point3_(2));
+  const auto h = fused::uncalibrate(fused::Leaf<Cal3_S2>(3),
+                                    fused::project(fused::wrap(p_cam)));
+  EXPECT(CompareFactors(expected, MakeFactor(kModel, kMeasured, h), values));
+}
+
+/* ************************************************************************* */
+// Robust and constrained noise models are handled as in ExpressionFactor.
+TEST(FusedExpressionFactor, NoiseModels) {
+  const Values values = CameraValues();
+  const auto h = fused::project3(fused::Pose3_(1), fused::Point3_(2),
+                                 fused::Leaf<Cal3_S2>(3));
+  for (const SharedNoiseModel& model :
+       {SharedNoiseModel(noiseModel::Robust::Create(
+            noiseModel::mEstimator::Huber::Create(1.0), kModel)),
+        SharedNoiseModel(noiseModel::Constrained::MixedSigmas(Vector2(0, 1)))}) {
+    const ExpressionFactor<Point2> expected(
+        model, kMeasured, project3(Pose3_(1), Point3_(2), Cal3_S2_(3)));
+    EXPECT(CompareFactors(expected, MakeFactor(model, kMeasured, h), values));
+  }
+
+  CHECK_EXCEPTION(MakeFactor(noiseModel::Unit::Create(3), kMeasured, h),
+                  std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(FusedExpressionFactor, ExpressionFactorGraph) {
+  const Values values = CameraValues();
+  ExpressionFactorGraph graph;
+  graph.addExpressionFactor(
+      project3(Pose3_(1), Point3_(2), Cal3_S2_(3)), kMeasured, kModel);
+  graph.addExpressionFactor(fused::project3(fused::Pose3_(1), fused::Point3_(2),
+                                            fused::Leaf<Cal3_S2>(3)),
+                            kMeasured, kModel);
+  EXPECT_LONGS_EQUAL(2, graph.size());
+  EXPECT_DOUBLES_EQUAL(graph[0]->error(values), graph[1]->error(values), 1e-9);
+  const auto linear = graph.linearize(values);
+  EXPECT(assert_equal(*linear->at(0), *linear->at(1), 1e-9));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
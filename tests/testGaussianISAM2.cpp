@@ -306,6 +306,23 @@ TEST(ISAM2, slamlike_solution_gaussnewton)
   CHECK(isam_check(fullgraph, fullinit, isam, *this, result_));
 }
 
+/* ************************************************************************* */
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+TEST(ISAM2, slamlike_solution_metis)
+{
+  // Some updates of this small problem affect enough of the tree to be batch
+  // steps, which are then ordered with METIS
+  ISAM2Params params(ISAM2GaussNewtonParams(0.001), 0.0, 0, false);
+  params.batchOrderingType = Ordering::METIS;
+  Values fullinit;
+  NonlinearFactorGraph fullgraph;
+  ISAM2 isam = createSlamlikeISAM2(&fullinit, &fullgraph, params);
+
+  // Compare solutions
+  CHECK(isam_check(fullgraph, fullinit, isam, *this, result_));
+}
+#endif
+
 /* ************************************************************************* */
 TEST(ISAM2, slamlike_solution_dogleg)
 {
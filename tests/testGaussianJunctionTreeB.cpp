@@ -241,6 +241,38 @@ TEST(GaussianJunctionTreeB, optimizeMultiFrontal2) {
 //  EXPECT(assert_equal(expected, actual3));
 //}
 
+/* ************************************************************************* */
+TEST(GaussianJunctionTreeB, eliminateByLevel) {
+  // A star with 300 leaves, wide enough to batch the partial Cholesky of the
+  // leaf cliques, one of which is constrained and eliminated with QR
+  GaussianFactorGraph fg;
+  const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.2, 0.3));
+  Ordering ordering;
+  for (size_t i = 1; i <= 300; ++i) {
+    Matrix3 A;
+    for (int r = 0; r < 3; ++r)
+      for (int c = 0; c < 3; ++c) A(r, c) = sin(i + 3.0 * r + 7.0 * c * c);
+    fg.emplace_shared<JacobianFactor>(L(i), I_3x3, X(0), A,
+                                      Vector3(1.0, i, 2.0), model);
+    fg.emplace_shared<JacobianFactor>(
+        L(i), 2 * I_3x3, Vector3::Constant(0.5),
+        i == 50 ? noiseModel::Constrained::All(3) : model);
+    ordering.push_back(L(i));
+  }
+  fg.emplace_shared<JacobianFactor>(X(0), I_3x3, Vector3::Zero(), model);
+  ordering.push_back(X(0));
+
+  // The default EliminatePreferCholesky batches, a wrapper of it does not
+  const auto expected = fg.eliminateMultifrontal(
+      ordering, [](const GaussianFactorGraph& factors, const Ordering& keys) {
+        return EliminatePreferCholesky(factors, keys);
+      });
+  const auto actual = fg.eliminateMultifrontal(ordering);
+  EXPECT_LONGS_EQUAL(expected->size(), actual->size());
+  EXPECT(assert_equal(*expected, *actual, 1e-9));
+  EXPECT(assert_equal(expected->optimize(), actual->optimize(), 1e-9));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -24,7 +24,10 @@
 #include <gtsam/nonlinear/DoglegOptimizer.h>
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/IncompleteCholeskyPreconditioner.h>
 #include <gtsam/linear/NoiseModel.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/geometry/Pose2.h>
 #include <gtsam/base/Matrix.h>
@@ -550,6 +553,91 @@ TEST(NonlinearOptimizer, subclass_solver) {
   EXPECT(assert_equal(expected, actual, 1e-4));
 }
 
+/* ************************************************************************* */
+// Pose graph on a circle with a chord every 5 poses, from a poor initial guess
+static std::pair<NonlinearFactorGraph, Values> createCircle(size_t n) {
+  NonlinearFactorGraph graph;
+  Values initial;
+  const auto model = noiseModel::Isotropic::Sigma(3, 0.1);
+  auto pose = [n](size_t i) {
+    const double theta = 2 * M_PI * i / n;
+    return Pose2(10 * cos(theta), 10 * sin(theta), theta + M_PI_2);
+  };
+  graph.addPrior(X(0), pose(0), model);
+  for (size_t i = 0; i < n; ++i) {
+    const size_t j = (i + 1) % n;
+    graph.emplace_shared<BetweenFactor<Pose2>>(
+        X(i), X(j), pose(i).between(pose(j)), model);
+    if (i % 5 == 0)
+      graph.emplace_shared<BetweenFactor<Pose2>>(
+          X(i), X((i + n / 2) % n), pose(i).between(pose((i + n / 2) % n)),
+          model);
+    initial.insert(X(i), pose(i).retract(Vector3(0.3 * sin(3.0 * i), 0.5,
+                                                 0.3 * cos(5.0 * i))));
+  }
+  return {graph, initial};
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, IterativeLMWarmStart) {
+  const auto [graph, initial] = createCircle(40);
+  const Values expected = LevenbergMarquardtOptimizer(graph, initial).optimize();
+
+  auto pcg = std::make_shared<PCGSolverParameters>(
+      std::make_shared<BlockJacobiPreconditionerParameters>());
+  pcg->epsilon_rel = 1e-8;
+  pcg->epsilon_abs = 0.0;
+  LevenbergMarquardtParams params;
+  params.linearSolverType = NonlinearOptimizerParams::Iterative;
+  params.iterativeParams = pcg;
+  params.relativeErrorTol = 1e-10;
+  params.absoluteErrorTol = 1e-10;
+
+  // Plain iterative LM, solving the damped system from zero
+  EXPECT(assert_equal(expected,
+                      LevenbergMarquardtOptimizer(graph, initial, params)
+                          .optimize(), 1e-4));
+
+  // Passing lambda to PCG and updating the preconditioner
+  params.reusePreconditioner = true;
+  LevenbergMarquardtOptimizer reuse(graph, initial, params);
+  EXPECT(assert_equal(expected, reuse.optimize(), 1e-4));
+
+  // Also with warm starts and inexact Newton steps, in fewer PCG iterations
+  params.warmStart = true;
+  params.inexactNewton = true;
+  LevenbergMarquardtOptimizer inexact(graph, initial, params);
+  EXPECT(assert_equal(expected, inexact.optimize(), 1e-4));
+  EXPECT(inexact.getLinearIterations() < reuse.getLinearIterations());
+
+  // Diagonal damping with an incomplete Cholesky preconditioner
+  params.diagonalDamping = true;
+  pcg->preconditioner =
+      std::make_shared<IncompleteCholeskyPreconditionerParameters>();
+  EXPECT(assert_equal(expected,
+                      LevenbergMarquardtOptimizer(graph, initial, params)
+                          .optimize(), 1e-4));
+}
+
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, LMCacheCliqueHessians) {
+  const auto [graph, initial] = createCircle(40);
+  for (const bool diagonalDamping : {false, true}) {
+    LevenbergMarquardtParams params;
+    params.diagonalDamping = diagonalDamping;
+    LevenbergMarquardtOptimizer expected(graph, initial, params);
+    const Values expectedResult = expected.optimize();
+
+    // Same lambda trials, adding lambda to the cached clique Hessians
+    params.cacheCliqueHessians = true;
+    LevenbergMarquardtOptimizer actual(graph, initial, params);
+    EXPECT(assert_equal(expectedResult, actual.optimize(), 1e-9));
+    EXPECT_LONGS_EQUAL(expected.iterations(), actual.iterations());
+    EXPECT_LONGS_EQUAL(expected.getInnerIterations(),
+                       actual.getInnerIterations());
+  }
+}
+
 /* ************************************************************************* */
 TEST( NonlinearOptimizer, logfile )
 {
@@ -118,6 +118,14 @@ TEST( GaussianFactorGraphSystem, multiply_getb)
   Vector actualb;
   gfgs.getb(actualb);
   EXPECT(assert_equal(expectedb, actualb, 1e-3));
+
+  // Same with the block-CSR kernel
+  GaussianFactorGraphSystem csr(simpleGFG, dummyPreconditioner, keyInfo,
+                                lambda, ConjugateGradientParameters::BLOCK_CSR);
+  csr.multiply(p, actualAp);
+  EXPECT(assert_equal(expectedAp, actualAp, 1e-3));
+  csr.getb(actualb);
+  EXPECT(assert_equal(expectedb, actualb, 1e-3));
 }
 
 /* ************************************************************************* */
@@ -160,6 +168,31 @@ TEST(PCGSolver, blockjacobi) {
   DOUBLES_EQUAL(0, fg.error(actualPCG), tol);
 }
 
+/* ************************************************************************* */
+// Test Block-Jacobi Precondioner with the block-CSR kernel
+TEST(PCGSolver, blockCSR) {
+  LevenbergMarquardtParams params;
+  params.linearSolverType = LevenbergMarquardtParams::Iterative;
+  auto pcg = std::make_shared<PCGSolverParameters>(
+      std::make_shared<BlockJacobiPreconditionerParameters>());
+  pcg->blas_kernel = ConjugateGradientParameters::BLOCK_CSR;
+  params.iterativeParams = pcg;
+
+  NonlinearFactorGraph fg = example::createReallyNonlinearFactorGraph();
+
+  Point2 x0(10, 10);
+  Values c0;
+  c0.insert(X(1), x0);
+
+  Values actualPCG = LevenbergMarquardtOptimizer(fg, c0, params).optimize();
+
+  DOUBLES_EQUAL(0, fg.error(actualPCG), tol);
+
+  // The kernel is kept when copying parameters
+  EXPECT(PCGSolverParameters(*pcg).blas_kernel ==
+         ConjugateGradientParameters::BLOCK_CSR);
+}
+
 /* ************************************************************************* */
 // Test Incremental Subgraph PCG Solver
 TEST(PCGSolver, subgraph) {
@@ -180,6 +213,36 @@ TEST(PCGSolver, subgraph) {
   DOUBLES_EQUAL(0, fg.error(actualPCG), tol);
 }
 
+/* ************************************************************************* */
+// Test that lambda damps the system solved by optimize
+TEST(PCGSolver, dampedOptimize) {
+  const GaussianFactorGraph gfg = example::createGaussianFactorGraph();
+  const KeyInfo keyInfo(gfg);
+
+  // H + diag(lambda) is the Hessian of gfg with priors sqrt(lambda) x = 0
+  std::map<Key, Vector> lambda;
+  GaussianFactorGraph damped = gfg;
+  for (const Key key : gfg.keys()) {
+    lambda.emplace(key, Vector2::Constant(0.5 + key % 4));
+    damped.emplace_shared<JacobianFactor>(
+        key, Matrix(lambda[key].cwiseSqrt().asDiagonal()), Vector2::Zero());
+  }
+
+  PCGSolverParameters pcg(
+      std::make_shared<BlockJacobiPreconditionerParameters>());
+  pcg.epsilon_abs = 0.0;
+  pcg.epsilon_rel = 1e-12;
+  const VectorValues actual =
+      PCGSolver(pcg).optimize(gfg, keyInfo, lambda, keyInfo.x0());
+  EXPECT(assert_equal(damped.optimize(), actual, 1e-6));
+
+  // Without damping, the solution is the undamped one
+  const VectorValues undamped = PCGSolver(pcg).optimize(
+      gfg, keyInfo, std::map<Key, Vector>(), keyInfo.x0());
+  EXPECT(assert_equal(gfg.optimize(), undamped, 1e-6));
+  EXPECT((undamped - actual).norm() > 1e-3);
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -22,7 +22,10 @@
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/linear/Preconditioner.h>
+#include <gtsam/linear/IncompleteCholeskyPreconditioner.h>
+#include <gtsam/linear/MultigridPreconditioner.h>
 #include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/SubgraphPreconditioner.h>
 #include <gtsam/geometry/Point2.h>
 
 using namespace std;
@@ -126,6 +129,207 @@ TEST(PCGSolver, simpleLinearSystem) {
   EXPECT(assert_equal(expectedSolution, deltaPCGJacobi, 1e-5));
   //deltaPCGJacobi.print("PCG Jacobi");
 
+  // With IC(0), ICT and multigrid preconditioners
+  pcg->preconditioner =
+      std::make_shared<gtsam::IncompleteCholeskyPreconditionerParameters>();
+  VectorValues deltaPCGIC0 = PCGSolver(*pcg).optimize(simpleGFG);
+  EXPECT(assert_equal(expectedSolution, deltaPCGIC0, 1e-5));
+
+  pcg->preconditioner =
+      std::make_shared<gtsam::IncompleteCholeskyPreconditionerParameters>(true);
+  VectorValues deltaPCGICT = PCGSolver(*pcg).optimize(simpleGFG);
+  EXPECT(assert_equal(expectedSolution, deltaPCGICT, 1e-5));
+
+  pcg->preconditioner =
+      std::make_shared<gtsam::MultigridPreconditionerParameters>();
+  VectorValues deltaPCGMultigrid = PCGSolver(*pcg).optimize(simpleGFG);
+  EXPECT(assert_equal(expectedSolution, deltaPCGMultigrid, 1e-5));
+}
+
+/* ************************************************************************* */
+// Grid of size x size variables of dimension 2, with relative measurements
+// between neighbours and a weak prior on every variable.
+static GaussianFactorGraph createGrid(size_t size) {
+  GaussianFactorGraph gfg;
+  const SharedDiagonal model = noiseModel::Isotropic::Sigma(2, 0.1);
+  const SharedDiagonal prior = noiseModel::Isotropic::Sigma(2, 10.0);
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      const Key key = i * size + j;
+      const Matrix2 R = (Matrix2() << 1.0, 0.1 * i, -0.1 * j, 1.0).finished();
+      gfg.emplace_shared<JacobianFactor>(
+          key, I_2x2, Vector2(std::sin(key), std::cos(key)), prior);
+      if (j + 1 < size)
+        gfg.emplace_shared<JacobianFactor>(key, -R, key + 1, I_2x2,
+                                           Vector2(1.0, 0.0), model);
+      if (i + 1 < size)
+        gfg.emplace_shared<JacobianFactor>(key, -R, key + size, I_2x2,
+                                           Vector2(0.0, 1.0), model);
+    }
+  }
+  return gfg;
+}
+
+/* ************************************************************************* */
+TEST(PCGSolver, grid) {
+  const GaussianFactorGraph gfg = createGrid(12);
+  const VectorValues expected = gfg.optimize();
+
+  PCGSolverParameters pcg;
+  pcg.maxIterations = 500;
+  pcg.epsilon_abs = 0.0;
+  pcg.epsilon_rel = 1e-12;
+
+  pcg.preconditioner =
+      std::make_shared<IncompleteCholeskyPreconditionerParameters>();
+  EXPECT(assert_equal(expected, PCGSolver(pcg).optimize(gfg), 1e-5));
+
+  pcg.preconditioner =
+      std::make_shared<IncompleteCholeskyPreconditionerParameters>(true, 1e-3);
+  EXPECT(assert_equal(expected, PCGSolver(pcg).optimize(gfg), 1e-5));
+
+  auto multigrid = std::make_shared<MultigridPreconditionerParameters>();
+  multigrid->coarsestSize = 10;
+  pcg.preconditioner = multigrid;
+  EXPECT(assert_equal(expected, PCGSolver(pcg).optimize(gfg), 1e-5));
+}
+
+/* ************************************************************************* */
+TEST(IncompleteCholeskyPreconditioner, completeFill) {
+  // Without dropping, ICT is the complete Cholesky factorization
+  const GaussianFactorGraph gfg = createGrid(5);
+  const KeyInfo keyInfo(gfg);
+  IncompleteCholeskyPreconditioner ict(
+      IncompleteCholeskyPreconditionerParameters(true, 0.0));
+  ict.build(gfg, keyInfo, std::map<Key, Vector>());
+  EXPECT_DOUBLES_EQUAL(0.0, ict.shift(), 1e-9);
+
+  const Vector y = Vector::LinSpaced(keyInfo.numCols(), -1.0, 1.0);
+  Vector z(y.size()), x(y.size());
+  ict.solve(y, z);
+  ict.transposeSolve(z, x);
+  const Matrix hessian = gfg.hessian(keyInfo.ordering()).first;
+  EXPECT(assert_equal(y, Vector(hessian * x), 1e-8));
+
+  // IC(0) keeps the sparsity of the lower triangle of the Hessian
+  IncompleteCholeskyPreconditioner ic0;
+  ic0.build(gfg, keyInfo, std::map<Key, Vector>());
+  EXPECT_LONGS_EQUAL(25 + 2 * 5 * 4, ic0.nrBlocks());
+  EXPECT(ict.nrBlocks() > ic0.nrBlocks());
+}
+
+/* ************************************************************************* */
+TEST(MultigridPreconditioner, hierarchy) {
+  const GaussianFactorGraph gfg = createGrid(12);
+  const KeyInfo keyInfo(gfg);
+  MultigridPreconditionerParameters parameters;
+  parameters.coarsestSize = 10;
+  MultigridPreconditioner multigrid(parameters);
+  multigrid.build(gfg, keyInfo, std::map<Key, Vector>());
+  CHECK(multigrid.nrLevels() >= 2);
+  EXPECT_LONGS_EQUAL(144, multigrid.matrix(0).size());
+  for (size_t l = 1; l < multigrid.nrLevels(); l++)
+    EXPECT(multigrid.matrix(l).size() < multigrid.matrix(l - 1).size());
+
+  // M^{-1} is symmetric positive definite
+  const size_t n = keyInfo.numCols();
+  Matrix Minv(n, n);
+  Vector x;
+  for (size_t j = 0; j < n; j++) {
+    multigrid.precondition(Vector::Unit(n, j), x);
+    Minv.col(j) = x;
+  }
+  EXPECT(assert_equal(Matrix(Minv.transpose()), Minv, 1e-9));
+  EXPECT(Minv.llt().info() == Eigen::Success);
+}
+
+/* ************************************************************************* */
+TEST(SubgraphPreconditioner, tree) {
+  // On a chain, the spanning tree is the whole graph, so M is the Hessian
+  GaussianFactorGraph gfg;
+  const SharedDiagonal model = noiseModel::Isotropic::Sigma(2, 0.1);
+  gfg.emplace_shared<JacobianFactor>(0, I_2x2, Vector2(1.0, 2.0), model);
+  for (Key key = 0; key + 1 < 10; key++) {
+    const Matrix2 R = (Matrix2() << 1.0, 0.1 * key, 0.0, 1.0).finished();
+    gfg.emplace_shared<JacobianFactor>(key, -R, key + 1, I_2x2,
+                                       Vector2(1.0, std::sin(key)), model);
+  }
+  const KeyInfo keyInfo(gfg);
+  SubgraphPreconditioner subgraph;
+  subgraph.build(gfg, keyInfo, std::map<Key, Vector>());
+
+  const Vector y = Vector::LinSpaced(keyInfo.numCols(), -1.0, 1.0);
+  Vector x;
+  subgraph.precondition(y, x);
+  const Matrix hessian = gfg.hessian(keyInfo.ordering()).first;
+  EXPECT(assert_equal(y, Vector(hessian * x), 1e-8));
+
+  // so PCG converges in one iteration
+  PCGSolverParameters pcg(std::make_shared<SubgraphPreconditionerParameters>());
+  pcg.epsilon_abs = 0.0;
+  pcg.epsilon_rel = 1e-12;
+  PCGSolver solver(pcg);
+  EXPECT(assert_equal(gfg.optimize(), solver.optimize(gfg), 1e-8));
+  EXPECT(solver.iterations() <= 2);
+}
+
+/* ************************************************************************* */
+TEST(PCGSolver, damping) {
+  const GaussianFactorGraph gfg = createGrid(8);
+  const KeyInfo keyInfo(gfg);
+
+  // H + diag(lambda) is the Hessian of gfg with priors sqrt(lambda) x = 0
+  std::map<Key, Vector> lambda;
+  GaussianFactorGraph damped = gfg;
+  for (const Key key : gfg.keys()) {
+    lambda.emplace(key, Vector2(1.0 + key, 2.0));
+    damped.emplace_shared<JacobianFactor>(
+        key, Matrix(lambda[key].cwiseSqrt().asDiagonal()), Vector2::Zero());
+  }
+  const VectorValues expected = damped.optimize();
+
+  PCGSolverParameters pcg;
+  pcg.maxIterations = 500;
+  pcg.epsilon_abs = 0.0;
+  pcg.epsilon_rel = 1e-12;
+
+  auto multigrid = std::make_shared<MultigridPreconditionerParameters>();
+  multigrid->coarsestSize = 10;
+  SubgraphBuilderParameters builderParameters;
+  builderParameters.skeletonWeight = SubgraphBuilderParameters::EQUAL;
+  const std::vector<std::shared_ptr<PreconditionerParameters>> preconditioners{
+      std::make_shared<BlockJacobiPreconditionerParameters>(),
+      std::make_shared<IncompleteCholeskyPreconditionerParameters>(),
+      multigrid,
+      std::make_shared<SubgraphPreconditionerParameters>(builderParameters)};
+  for (const auto& preconditioner : preconditioners) {
+    pcg.preconditioner = preconditioner;
+    PCGSolver solver(pcg);
+    EXPECT(assert_equal(
+        expected, solver.optimize(gfg, keyInfo, lambda, keyInfo.x0()), 1e-5));
+
+    // Update the damping of an undamped build, and warm start
+    solver.build(gfg, keyInfo, std::map<Key, Vector>());
+    solver.updateDamping(gfg, keyInfo, lambda);
+    const VectorValues actual =
+        solver.solve(gfg, keyInfo, lambda, 2.0 * expected, 1e-12);
+    EXPECT(assert_equal(expected, actual, 1e-5));
+  }
+
+  // Updating the damping is the same as building with it
+  const size_t n = keyInfo.numCols();
+  const Vector y = Vector::LinSpaced(n, -1.0, 1.0);
+  for (const auto& preconditioner : preconditioners) {
+    auto built = createPreconditioner(preconditioner);
+    built->build(gfg, keyInfo, lambda);
+    auto updated = createPreconditioner(preconditioner);
+    updated->build(gfg, keyInfo, std::map<Key, Vector>());
+    CHECK(updated->updateDamping(keyInfo, lambda));
+    Vector expectedX(n), actualX(n);
+    built->precondition(y, expectedX);
+    updated->precondition(y, actualX);
+    EXPECT(assert_equal(expectedX, actualX, 1e-9));
+  }
 }
 
 /* ************************************************************************* */
@@ -18,6 +18,8 @@
 
 #include <gtsam/slam/expressions.h>
 #include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/FusedExpressionFactor.h>
+#include <gtsam/slam/fusedExpressions.h>
 #include <gtsam/slam/ProjectionFactor.h>
 #include <gtsam/slam/GeneralSFMFactor.h>
 #include <gtsam/geometry/Pose3.h>
@@ -79,6 +81,20 @@ int main() {
           project3(x, p, K));
   time("Ternary(Leaf,Leaf,Leaf)     : ", f3, values);
 
+  // Fused expressions, same trees
+  auto h4 = fused::uncalibrate(
+      fused::Leaf<Cal3_S2>(3),
+      fused::project(fused::transformTo(fused::Pose3_(1), fused::Point3_(2))));
+  NonlinearFactor::shared_ptr f4 =
+      std::make_shared<FusedExpressionFactor<decltype(h4)> >(model, z, h4);
+  time("Fused Bin(Leaf,Un(Bin(..)))  : ", f4, values);
+
+  auto h5 = fused::project3(fused::Pose3_(1), fused::Point3_(2),
+                                  fused::Leaf<Cal3_S2>(3));
+  NonlinearFactor::shared_ptr f5 =
+      std::make_shared<FusedExpressionFactor<decltype(h5)> >(model, z, h5);
+  time("Fused Ternary(Leaf,Leaf,Leaf): ", f5, values);
+
   // CALIBRATED
 
   // Dedicated factor
@@ -103,5 +119,35 @@ int main() {
       std::make_shared<ExpressionFactor<Point2> >(model, z,
           Point2_(myProject, x, p));
   time("Binary(Leaf,Leaf)           : ", g3, values);
+
+  // BATCH
+
+  // Dedicated factor, linearized one by one
+  typedef GeneralSFMFactor<PinholeCamera<Cal3_S2>, Point3> SfmFactor;
+  Values cameraValues;
+  cameraValues.insert(1, PinholeCamera<Cal3_S2>(Pose3(), *fixedK));
+  cameraValues.insert(2, Point3(0, 0, 1));
+  auto h1 = std::make_shared<SfmFactor>(z, model, 1, 2);
+  time("GeneralSFMFactor<Camera,P>  : ", h1, cameraValues);
+
+  // Same factor, 1000 times in a graph, linearized one by one or with
+  // BatchProjection
+  {
+    const std::vector<SfmFactor::shared_ptr> factors(1000, h1);
+    NonlinearFactorGraph graph;
+    for (const auto& factor : factors) graph.push_back(factor);
+    long timeLog = clock();
+    for (int i = 0; i < n / 1000; i++) graph.linearize(cameraValues);
+    long timeLog2 = clock();
+    for (int i = 0; i < n / 1000; i++)
+      SfmFactor::Linearize(factors, cameraValues);
+    long timeLog3 = clock();
+    cout << "NonlinearFactorGraph::linearize: "
+         << (double)(timeLog2 - timeLog) / CLOCKS_PER_SEC * 1000000 / n
+         << " musecs/call" << endl;
+    cout << "GeneralSFMFactor::Linearize : "
+         << (double)(timeLog3 - timeLog2) / CLOCKS_PER_SEC * 1000000 / n
+         << " musecs/call" << endl;
+  }
   return 0;
 }
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeDiscreteElimination.cpp
+ * @brief   Time sparse (TableFactor) vs decision tree discrete elimination
+ *          on a CSP-style problem where most assignments are infeasible.
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/discrete/DiscreteBayesNet.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/discrete/TableFactor.h>
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+/**
+ * Create a chain of n variables with k values each, constrained by
+ * x_i + x_{i+1} = x_{i+2} mod k, plus random soft preferences on each variable.
+ * Only 1/k of the entries of every ternary constraint are nonzero.
+ */
+DiscreteFactorGraph createCSP(size_t n, size_t k, bool sparse) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0.1, 1.0);
+
+  DiscreteFactorGraph graph;
+  for (size_t i = 0; i + 2 < n; i++) {
+    DiscreteKeys keys{{i, k}, {i + 1, k}, {i + 2, k}};
+    vector<double> table(k * k * k, 0.0);
+    for (size_t a = 0; a < k; a++)
+      for (size_t b = 0; b < k; b++) table[(a * k + b) * k + (a + b) % k] = 1;
+    if (sparse)
+      graph.push_back(std::make_shared<TableFactor>(keys, table));
+    else
+      graph.push_back(std::make_shared<DecisionTreeFactor>(keys, table));
+  }
+  for (size_t i = 0; i < n; i++) {
+    vector<double> table(k);
+    for (auto& p : table) p = uniform(rng);
+    if (sparse)
+      graph.push_back(std::make_shared<TableFactor>(DiscreteKey(i, k), table));
+    else
+      graph.push_back(
+          std::make_shared<DecisionTreeFactor>(DiscreteKey(i, k), table));
+  }
+  return graph;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t n = 100, k = 12, trials = 3;
+
+  Ordering ordering;
+  for (size_t i = 0; i < n; i++) ordering.push_back(i);
+
+  const DiscreteFactorGraph dense = createCSP(n, k, false),
+                            sparse = createCSP(n, k, true);
+
+  DiscreteValues x;
+  for (size_t i = 0; i < n; i++) x[i] = 0;
+
+  for (size_t i = 0; i < trials; i++) {
+    DiscreteBayesNet::shared_ptr bn1, bn2;
+    {
+      gttic_(EliminateDiscrete);
+      bn1 = dense.eliminateSequential(ordering, EliminateDiscrete);
+    }
+    {
+      gttic_(EliminateDiscreteTable);
+      bn2 = sparse.eliminateSequential(ordering, EliminateDiscreteTable);
+    }
+    tictoc_finishedIteration_();
+    if (i == 0)
+      cout << "log p(x=0): " << bn1->logProbability(x) << " (decision tree), "
+           << bn2->logProbability(x) << " (table)" << endl;
+  }
+
+  tictoc_print_();
+  return 0;
+}
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeKalmanFilter.cpp
+ * @brief   time KalmanFilter and ExtendedKalmanFilter vs their fixed-size
+ *          counterparts
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/linear/FixedKalmanFilter.h>
+#include <gtsam/linear/KalmanFilter.h>
+#include <gtsam/nonlinear/ExtendedKalmanFilter.h>
+#include <gtsam/nonlinear/FixedExtendedKalmanFilter.h>
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace gtsam;
+
+// Constant velocity model of a 2D point, with state (x, y, vx, vy), an
+// acceleration control and position measurements.
+static const double dt = 0.1;
+static const Matrix4 F = (Matrix4() << 1, 0, dt, 0,  //
+                          0, 1, 0, dt,               //
+                          0, 0, 1, 0,                //
+                          0, 0, 0, 1).finished();
+static const Eigen::Matrix<double, 4, 2> B =
+    (Eigen::Matrix<double, 4, 2>() << 0.5 * dt * dt, 0, 0, 0.5 * dt * dt, dt,
+     0, 0, dt)
+        .finished();
+static const Eigen::Matrix<double, 2, 4> H =
+    (Eigen::Matrix<double, 2, 4>() << 1, 0, 0, 0, 0, 1, 0, 0).finished();
+static const Vector4 sigmasQ(0.01, 0.01, 0.1, 0.1);
+static const Vector2 sigmasR(0.3, 0.3);
+
+static Vector2 Measurement(size_t k) { return Vector2(0.1 * k, 0.05 * k); }
+
+// Both return the final mean, so the loops are not removed.
+static Vector runKalmanFilter(size_t n, KalmanFilter::Factorization method) {
+  const KalmanFilter kf(4, method);
+  const auto modelQ = noiseModel::Diagonal::Sigmas(sigmasQ);
+  const auto modelR = noiseModel::Diagonal::Sigmas(sigmasR);
+  const Matrix F_ = F, B_ = B, H_ = H;
+  const Vector u = Vector2(0.1, 0);
+  KalmanFilter::State p = kf.init(Vector4::Zero(), SharedDiagonal(modelQ));
+  for (size_t k = 0; k < n; k++) {
+    p = kf.predict(p, F_, B_, u, modelQ);
+    p = kf.update(p, H_, Measurement(k + 1), modelR);
+  }
+  return p->mean();
+}
+
+static Vector4 runFixedKalmanFilter(size_t n,
+                                    KalmanFilter::Factorization method) {
+  const FixedKalmanFilter<4> kf(method);
+  const Vector2 u(0.1, 0);
+  FixedKalmanFilter<4>::State p = kf.init(Vector4::Zero(), sigmasQ);
+  for (size_t k = 0; k < n; k++) {
+    p = kf.predict(p, F, B, u, sigmasQ);
+    p = kf.update(p, H, Vector2(Measurement(k + 1)), sigmasR);
+  }
+  return kf.mean(p);
+}
+
+// Pose2 EKF with odometry and pose measurements.
+static const Pose2 odometry(0.1, 0, 0.01);
+static const SharedDiagonal modelOdometry =
+    noiseModel::Diagonal::Sigmas(Vector3(0.01, 0.01, 0.005));
+static const SharedDiagonal modelPose =
+    noiseModel::Diagonal::Sigmas(Vector3(0.3, 0.3, 0.1));
+
+static Pose2 PoseMeasurement(size_t k) {
+  return Pose2(0.1 * k, 0.01 * k, 0.01 * k);
+}
+
+static Pose2 runExtendedKalmanFilter(size_t n) {
+  ExtendedKalmanFilter<Pose2> ekf(0, Pose2(), modelOdometry);
+  Pose2 x;
+  for (size_t k = 0; k < n; k++) {
+    ekf.predict(BetweenFactor<Pose2>(k, k + 1, odometry, modelOdometry));
+    x = ekf.update(PriorFactor<Pose2>(k + 1, PoseMeasurement(k + 1), modelPose));
+  }
+  return x;
+}
+
+static Pose2 runFixedExtendedKalmanFilter(size_t n,
+                                          KalmanFilter::Factorization method) {
+  FixedExtendedKalmanFilter<Pose2> ekf(Pose2(), modelOdometry, method);
+  Pose2 x;
+  for (size_t k = 0; k < n; k++) {
+    ekf.predict(BetweenFactor<Pose2>(k, k + 1, odometry, modelOdometry));
+    x = ekf.update(PriorFactor<Pose2>(k + 1, PoseMeasurement(k + 1), modelPose));
+  }
+  return x;
+}
+
+// The same filter, with the models given as functions.
+static Pose2 runFixedExtendedKalmanFilterFunctions(
+    size_t n, KalmanFilter::Factorization method) {
+  FixedExtendedKalmanFilter<Pose2> ekf(Pose2(), modelOdometry, method);
+  const auto f = [](const Pose2& x, OptionalJacobian<3, 3> H) {
+    return x.compose(odometry, H);
+  };
+  const auto h = [](const Pose2& x, OptionalJacobian<3, 3> H) {
+    if (H) H->setIdentity();
+    return x;
+  };
+  const Matrix3 Q = modelOdometry->covariance(), R = modelPose->covariance();
+  Pose2 x;
+  for (size_t k = 0; k < n; k++) {
+    ekf.predict(f, Q);
+    x = ekf.update(h, PoseMeasurement(k + 1), R);
+  }
+  return x;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t n = argc > 1 ? stoul(argv[1]) : 100000;
+  cout << n << " steps" << endl;
+
+  {
+    gttic_(KalmanFilter_QR);
+    cout << runKalmanFilter(n, KalmanFilter::QR).transpose() << endl;
+  }
+  {
+    gttic_(FixedKalmanFilter_QR);
+    cout << runFixedKalmanFilter(n, KalmanFilter::QR).transpose() << endl;
+  }
+  {
+    gttic_(KalmanFilter_CHOLESKY);
+    cout << runKalmanFilter(n, KalmanFilter::CHOLESKY).transpose() << endl;
+  }
+  {
+    gttic_(FixedKalmanFilter_CHOLESKY);
+    cout << runFixedKalmanFilter(n, KalmanFilter::CHOLESKY).transpose()
+         << endl;
+  }
+  {
+    gttic_(ExtendedKalmanFilter);
+    runExtendedKalmanFilter(n).print("ExtendedKalmanFilter ");
+  }
+  {
+    gttic_(FixedExtendedKalmanFilter_QR);
+    runFixedExtendedKalmanFilter(n, KalmanFilter::QR)
+        .print("FixedExtendedKalmanFilter QR ");
+  }
+  {
+    gttic_(FixedExtendedKalmanFilter_CHOLESKY);
+    runFixedExtendedKalmanFilter(n, KalmanFilter::CHOLESKY)
+        .print("FixedExtendedKalmanFilter CHOLESKY ");
+  }
+  {
+    gttic_(FixedExtendedKalmanFilter_functions_QR);
+    runFixedExtendedKalmanFilterFunctions(n, KalmanFilter::QR)
+        .print("FixedExtendedKalmanFilter functions QR ");
+  }
+  {
+    gttic_(FixedExtendedKalmanFilter_functions_CHOLESKY);
+    runFixedExtendedKalmanFilterFunctions(n, KalmanFilter::CHOLESKY)
+        .print("FixedExtendedKalmanFilter functions CHOLESKY ");
+  }
+
+  tictoc_print_();
+  return 0;
+}
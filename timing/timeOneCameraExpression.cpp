@@ -45,6 +45,8 @@ int main() {
   // ExpressionFactor
   // Oct 3, 2014, Macbook Air
   // 20.3 musecs/call
+  // Oct 2026, re-used trace storage, single core Linux
+  // 0.5 musecs/call, was 0.8 musecs/call
 //#define TERNARY
   NonlinearFactor::shared_ptr f = std::make_shared<ExpressionFactor<Point2> >
 #ifdef TERNARY
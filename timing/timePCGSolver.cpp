@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timePCGSolver.cpp
+ * @brief   time PCG on a large grid graph with the GTSAM and BLOCK_CSR kernels
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace gtsam;
+
+// Linear grid graph of size x size variables of dimension 3, with a prior on
+// every variable and random 3x3 blocks on the edges to the right and below.
+static GaussianFactorGraph createGrid(size_t size) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> normal;
+  auto random = [&](int m, int n) {
+    Matrix A(m, n);
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < n; j++) A(i, j) = normal(rng);
+    return A;
+  };
+  const auto model = noiseModel::Isotropic::Sigma(3, 0.1);
+  GaussianFactorGraph gfg;
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      const Key key = i * size + j;
+      gfg.emplace_shared<JacobianFactor>(key, I_3x3, Vector(random(3, 1)));
+      if (j + 1 < size)
+        gfg.emplace_shared<JacobianFactor>(key, random(3, 3), key + 1,
+                                           random(3, 3),
+                                           Vector(random(3, 1)), model);
+      if (i + 1 < size)
+        gfg.emplace_shared<JacobianFactor>(key, random(3, 3), key + size,
+                                           random(3, 3),
+                                           Vector(random(3, 1)), model);
+    }
+  }
+  return gfg;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t size = argc > 1 ? stoul(argv[1]) : 300;
+  const size_t nrProducts = 100;
+  const GaussianFactorGraph gfg = createGrid(size);
+  const KeyInfo keyInfo(gfg);
+  cout << gfg.size() << " factors, " << keyInfo.numCols() << " columns"
+       << endl;
+
+  // Hessian-vector products, as in every CG iteration
+  DummyPreconditioner dummy;
+  const std::map<Key, Vector> lambda;
+  for (auto kernel :
+       {ConjugateGradientParameters::GTSAM,
+        ConjugateGradientParameters::BLOCK_CSR}) {
+    const string name = ConjugateGradientParameters::blasTranslator(kernel);
+    Vector x = Vector::Ones(keyInfo.numCols()), y;
+    {
+      gttic_(build);
+      GaussianFactorGraphSystem system(gfg, dummy, keyInfo, lambda, kernel);
+      gttoc_(build);
+      gttic_(multiply);
+      for (size_t k = 0; k < nrProducts; k++) {
+        system.multiply(x, y);
+        x = y.normalized();
+      }
+    }
+    cout << name << " |A'A x| = " << y.norm() << endl;
+    tictoc_print_();
+    tictoc_reset_();
+  }
+
+  // Complete solves with a block-Jacobi preconditioner
+  for (auto kernel :
+       {ConjugateGradientParameters::GTSAM,
+        ConjugateGradientParameters::BLOCK_CSR}) {
+    const string name = ConjugateGradientParameters::blasTranslator(kernel);
+    PCGSolverParameters parameters(
+        std::make_shared<BlockJacobiPreconditionerParameters>());
+    parameters.blas_kernel = kernel;
+    parameters.maxIterations = 200;
+    parameters.epsilon_rel = 1e-6;
+    VectorValues solution;
+    {
+      gttic_(solve);
+      PCGSolver solver(parameters);
+      solution = solver.optimize(gfg, keyInfo, lambda, keyInfo.x0());
+    }
+    cout << name << " error = " << gfg.error(solution) << endl;
+    tictoc_print_();
+    tictoc_reset_();
+  }
+
+  return 0;
+}
@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timePreconditioners.cpp
+ * @brief   time PCG with the block-Jacobi, incomplete Cholesky and multigrid
+ *          preconditioners on the linearized w20000 and sphere2500 datasets
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/IncompleteCholeskyPreconditioner.h>
+#include <gtsam/linear/MultigridPreconditioner.h>
+#include <gtsam/linear/PCGSolver.h>
+#include <gtsam/linear/Preconditioner.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/slam/dataset.h>
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace gtsam;
+
+// Linearize a pose graph at the odometry initialization, with a prior on the
+// first pose.
+template <class POSE>
+static GaussianFactorGraph linearize(NonlinearFactorGraph graph,
+                                     const SharedNoiseModel& priorModel) {
+  Values initial;
+  initial.insert(0, POSE());
+  for (const auto& factor : graph) {
+    const auto between = std::dynamic_pointer_cast<BetweenFactor<POSE>>(factor);
+    if (between && between->key2() == between->key1() + 1 &&
+        initial.exists(between->key1()) && !initial.exists(between->key2()))
+      initial.insert(between->key2(), initial.at<POSE>(between->key1()) *
+                                          between->measured());
+  }
+  graph.addPrior(0, POSE(), priorModel);
+  return *graph.linearize(initial);
+}
+
+static void timePreconditioners(const string& name,
+                                const GaussianFactorGraph& gfg) {
+  const KeyInfo keyInfo(gfg);
+  const std::map<Key, Vector> lambda;
+  cout << name << ": " << gfg.size() << " factors, " << keyInfo.numCols()
+       << " columns" << endl;
+
+  // The error of a PCG solution is reported relative to the reduction by the
+  // exact solution, (f(x) - f*) / (f(0) - f*), with f the linear graph error.
+  const double optimal = gfg.error(gfg.optimize());
+  const double initial = gfg.error(keyInfo.x0());
+
+  vector<pair<string, std::shared_ptr<PreconditionerParameters>>> cases = {
+      {"block-Jacobi", std::make_shared<BlockJacobiPreconditionerParameters>()},
+      {"IC(0)", std::make_shared<IncompleteCholeskyPreconditionerParameters>()},
+      {"ICT(1e-3)",
+       std::make_shared<IncompleteCholeskyPreconditionerParameters>(true,
+                                                                    1e-3)},
+      {"multigrid", std::make_shared<MultigridPreconditionerParameters>()}};
+
+  for (const auto& [preconditionerName, preconditioner] : cases) {
+    cout << "--- " << name << ", " << preconditionerName << endl;
+    {
+      const auto p = createPreconditioner(preconditioner);
+      gttic_(build);
+      p->build(gfg, keyInfo, lambda);
+    }
+    PCGSolverParameters parameters(preconditioner);
+    parameters.blas_kernel = ConjugateGradientParameters::BLOCK_CSR;
+    parameters.maxIterations = 2000;
+    parameters.epsilon_rel = 1e-6;
+    parameters.epsilon_abs = 0.0;
+    parameters.setVerbosity("COMPLEXITY");
+    VectorValues solution;
+    {
+      gttic_(build_and_solve);
+      solution = PCGSolver(parameters).optimize(gfg, keyInfo, lambda,
+                                                keyInfo.x0());
+    }
+    cout << "relative error "
+         << (gfg.error(solution) - optimal) / (initial - optimal) << endl;
+    tictoc_print_();
+    tictoc_reset_();
+  }
+}
+
+int main(int argc, char* argv[]) {
+  {
+    const auto [graph, initial] = load2D(findExampleDataFile("w20000.txt"));
+    timePreconditioners(
+        "w20000",
+        linearize<Pose2>(*graph, noiseModel::Isotropic::Sigma(3, 0.1)));
+  }
+  {
+    const auto [graph, initial] = load3D(findExampleDataFile("sphere2500.txt"));
+    timePreconditioners(
+        "sphere2500",
+        linearize<Pose3>(*graph, noiseModel::Isotropic::Sigma(6, 0.1)));
+  }
+  return 0;
+}
@@ -36,11 +36,13 @@ int main(int argc, char* argv[]) {
 
   // Build graph using conventional GeneralSFMFactor
   NonlinearFactorGraph graph;
+  std::vector<SfmFactor::shared_ptr> factors;
   for (size_t j = 0; j < db.numberTracks(); j++) {
     for (const SfmMeasurement& m: db.tracks[j].measurements) {
       size_t i = m.first;
       Point2 z = m.second;
-      graph.emplace_shared<SfmFactor>(z, gNoiseModel, C(i), P(j));
+      factors.push_back(std::make_shared<SfmFactor>(z, gNoiseModel, C(i), P(j)));
+      graph.push_back(factors.back());
     }
   }
 
@@ -51,5 +53,18 @@ int main(int argc, char* argv[]) {
   for (const SfmTrack& track: db.tracks)
     initial.insert(P(j++), track.p);
 
+  // Compare linearizing factor by factor with batch linearization
+  for (size_t k = 0; k < 10; k++) {
+    {
+      gttic_(linearize);
+      graph.linearize(initial);
+    }
+    {
+      gttic_(Linearize_batch);
+      SfmFactor::Linearize(factors, initial);
+    }
+    tictoc_finishedIteration_();
+  }
+
   return optimize(db, graph, initial);
 }
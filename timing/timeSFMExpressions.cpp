@@ -18,6 +18,8 @@
 
 #include <gtsam/slam/expressions.h>
 #include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/FusedExpressionFactor.h>
+#include <gtsam/slam/fusedExpressions.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 
@@ -78,5 +80,34 @@ int main() {
   cout << seconds << " seconds to linearize" << endl;
   cout << ((double) seconds * 1000000 / n) << " musecs/call" << endl;
 
+  // Same graph with fused expressions
+  timeLog = clock();
+  NonlinearFactorGraph fusedGraph;
+  for (size_t i = 0; i < M; i++) {
+    for (size_t j = 0; j < N; j++) {
+      const fused::Pose3_ x_i(Symbol('x', i));
+      const fused::Point3_ p_j(Symbol('p', j));
+      const fused::Leaf<Cal3_S2> K_0(Symbol('K', 0));
+#ifdef TERNARY
+      auto h = fused::project3(x_i, p_j, K_0);
+#else
+      auto h =
+          fused::uncalibrate(K_0, fused::project(fused::transformTo(x_i, p_j)));
+#endif
+      fusedGraph.emplace_shared<FusedExpressionFactor<decltype(h)>>(model, z,
+                                                                    h);
+    }
+  }
+  timeLog2 = clock();
+  seconds = (double) (timeLog2 - timeLog) / CLOCKS_PER_SEC;
+  cout << seconds << " seconds to build fused" << endl;
+
+  timeLog = clock();
+  gfg = fusedGraph.linearize(values);
+  timeLog2 = clock();
+  seconds = (double) (timeLog2 - timeLog) / CLOCKS_PER_SEC;
+  cout << seconds << " seconds to linearize fused" << endl;
+  cout << ((double) seconds * 1000000 / n) << " musecs/call" << endl;
+
   return 0;
 }
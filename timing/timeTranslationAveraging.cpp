@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeTranslationAveraging.cpp
+ * @brief   time translation averaging on a large synthetic problem,
+ *          TranslationRecovery vs TranslationAveraging
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/sfm/TranslationAveraging.h>
+#include <gtsam/sfm/TranslationRecovery.h>
+
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace gtsam;
+
+int main(int argc, char* argv[]) {
+  // primitive argument parsing:
+  if (argc > 3) {
+    throw runtime_error(
+        "Usage: timeTranslationAveraging [nrCameras] [nrProjectionDirections]");
+  }
+  const size_t n = argc > 1 ? stoul(argv[1]) : 50000;
+  const size_t nrDirections = argc > 2 ? stoul(argv[2]) : 48;
+
+  // Cameras on a random walk, each observing the next 5 cameras, plus random
+  // loop closures between cameras close to each other.
+  std::mt19937 rng(42);
+  std::normal_distribution<double> step(0, 1);
+  Values poses;
+  Point3 position(0, 0, 0);
+  for (size_t j = 0; j < n; j++) {
+    poses.insert<Pose3>(j, Pose3(Rot3(), position));
+    position += Point3(step(rng), step(rng), step(rng));
+  }
+  std::vector<TranslationRecovery::KeyPair> pairs;
+  std::uniform_int_distribution<size_t> offset(6, 50);
+  for (size_t j = 0; j < n; j++) {
+    for (size_t k = j + 1; k < std::min(n, j + 6); k++)
+      pairs.emplace_back(j, k);
+    if (j + 50 < n) pairs.emplace_back(j, j + offset(rng));
+  }
+  auto edges = TranslationRecovery::SimulateMeasurements(poses, pairs);
+
+  // Add noise to the directions, and reverse 1% of the loop closures, which
+  // 1DSfM should reject.
+  std::normal_distribution<double> noise(0, 0.01);
+  std::uniform_real_distribution<double> uniform(0, 1);
+  for (auto& edge : edges) {
+    Point3 direction = edge.measured().point3() +
+                       Point3(noise(rng), noise(rng), noise(rng));
+    if (edge.key2() - edge.key1() > 5 && uniform(rng) < 0.01)
+      direction = -direction;
+    edge = BinaryMeasurement<Unit3>(edge.key1(), edge.key2(), Unit3(direction),
+                                    edge.noiseModel());
+  }
+  cout << n << " cameras, " << edges.size() << " edges" << endl;
+
+  TranslationAveraging::Parameters parameters;
+  parameters.nrProjectionDirections = nrDirections;
+  const TranslationAveraging averaging(parameters);
+
+  TranslationAveraging::TranslationEdges inliers;
+  {
+    gttic_(rejectOutliers);
+    inliers = averaging.rejectOutliers(edges);
+  }
+  cout << inliers.size() << " inliers" << endl;
+
+  Values initial;
+  {
+    gttic_(initialize);
+    initial = averaging.initialize(inliers);
+  }
+  Values actual, expected;
+  {
+    gttic_(TranslationAveraging_optimize);
+    actual = averaging.optimize(inliers, initial);
+  }
+  {
+    gttic_(TranslationRecovery_run);
+    expected = TranslationRecovery().run(inliers, 1.0, {}, initial);
+  }
+
+  // Both should reach the same cost.
+  const TranslationRecovery recovery;
+  NonlinearFactorGraph graph = recovery.buildGraph(inliers);
+  recovery.addPrior(inliers, 1.0, {}, &graph);
+  cout << "error: " << graph.error(actual) << " vs " << graph.error(expected)
+       << endl;
+
+  tictoc_print_();
+  return 0;
+}
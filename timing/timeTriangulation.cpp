@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeTriangulation.cpp
+ * @brief   time triangulation of many tracks: triangulateSafe per track vs
+ *          triangulateTracks
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/triangulation.h>
+
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace gtsam;
+
+using Camera = PinholeCamera<Cal3DS2>;
+
+// Returns the number of valid results, so the loops are not removed.
+static size_t triangulateOneByOne(const CameraSet<Camera>& cameras,
+                                  const vector<TriangulationTrack>& tracks,
+                                  const TriangulationParameters& params) {
+  size_t nrValid = 0;
+  CameraSet<Camera> trackCameras;
+  Point2Vector measured;
+  for (const auto& track : tracks) {
+    trackCameras.clear();
+    measured.clear();
+    for (const auto& [i, z] : track) {
+      trackCameras.push_back(cameras[i]);
+      measured.push_back(z);
+    }
+    nrValid += triangulateSafe(trackCameras, measured, params).valid();
+  }
+  return nrValid;
+}
+
+static size_t triangulateBatch(const CameraSet<Camera>& cameras,
+                               const vector<TriangulationTrack>& tracks,
+                               const TriangulationParameters& params) {
+  size_t nrValid = 0;
+  for (const auto& result : triangulateTracks(cameras, tracks, params))
+    nrValid += result.valid();
+  return nrValid;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t n = argc > 1 ? stoul(argv[1]) : 20000;
+
+  // 50 cameras on a circle looking at the origin, tracks of 2-8 views.
+  const Cal3DS2 K(500, 480, 0.0, 320, 240, -0.1, 0.02, 1e-3, -5e-4);
+  CameraSet<Camera> cameras;
+  for (size_t i = 0; i < 50; i++) {
+    const double theta = 2 * M_PI * i / 50;
+    const Point3 eye(10 * cos(theta), 10 * sin(theta), 1);
+    cameras.push_back(Camera::Lookat(eye, Point3(0, 0, 0), Point3(0, 0, 1), K));
+  }
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-2, 2);
+  std::normal_distribution<double> noise(0, 0.5);
+  vector<TriangulationTrack> tracks(n);
+  for (size_t t = 0; t < n; t++) {
+    const Point3 landmark(uniform(rng), uniform(rng), uniform(rng));
+    const size_t first = rng() % 50, length = 2 + t % 7;
+    for (size_t k = 0; k < length; k++) {
+      const size_t i = (first + k) % 50;
+      tracks[t].emplace_back(
+          i, cameras[i].project(landmark) + Point2(noise(rng), noise(rng)));
+    }
+  }
+  cout << n << " tracks" << endl;
+
+  TriangulationParameters params(1e-9, false, -1, 5.0);
+  {
+    gttic_(DLT_triangulateSafe);
+    cout << "DLT triangulateSafe: "
+         << triangulateOneByOne(cameras, tracks, params) << " valid" << endl;
+  }
+  {
+    gttic_(DLT_triangulateTracks);
+    cout << "DLT triangulateTracks: "
+         << triangulateBatch(cameras, tracks, params) << " valid" << endl;
+  }
+
+  params.useLOST = true;
+  {
+    gttic_(LOST_triangulateSafe);
+    cout << "LOST triangulateSafe: "
+         << triangulateOneByOne(cameras, tracks, params) << " valid" << endl;
+  }
+  {
+    gttic_(LOST_triangulateTracks);
+    cout << "LOST triangulateTracks: "
+         << triangulateBatch(cameras, tracks, params) << " valid" << endl;
+  }
+
+  params.useLOST = false;
+  params.enableEPI = true;
+  params.noiseModel = noiseModel::Isotropic::Sigma(2, 0.5);
+  {
+    gttic_(EPI_triangulateSafe);
+    cout << "EPI triangulateSafe: "
+         << triangulateOneByOne(cameras, tracks, params) << " valid" << endl;
+  }
+  {
+    gttic_(EPI_triangulateTracks);
+    cout << "EPI triangulateTracks: "
+         << triangulateBatch(cameras, tracks, params) << " valid" << endl;
+  }
+
+  tictoc_print_();
+  return 0;
+}
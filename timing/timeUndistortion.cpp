@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeUndistortion.cpp
+ * @brief   time calibrate of 2000 features per frame: point by point, batch,
+ *          and with an UndistortionGrid
+ * @date    October 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Cal3Fisheye.h>
+#include <gtsam/geometry/Cal3Unified.h>
+#include <gtsam/geometry/UndistortionGrid.h>
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+static const int nrFrames = 1000;
+
+template <class CALIBRATION>
+void timeCalibration(const CALIBRATION& K, const Point2Vector& pixels) {
+  double sum = 0;  // keeps the compiler from removing the loops
+  {
+    gttic_(pointByPoint);
+    for (int i = 0; i < nrFrames; i++)
+      for (const Point2& p : pixels) sum += K.calibrate(p).x();
+  }
+  {
+    gttic_(batch);
+    for (int i = 0; i < nrFrames; i++) sum += K.calibrate(pixels)[0].x();
+  }
+  UndistortionGrid<CALIBRATION> grid(K, 640, 480);
+  {
+    gttic_(grid);
+    for (int i = 0; i < nrFrames; i++) sum += grid.calibrate(pixels)[0].x();
+  }
+  cout << "grid max error: " << grid.maxError() << " pixels (" << sum << ")"
+       << endl;
+}
+
+int main() {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> u(0, 640), v(0, 480);
+  Point2Vector pixels;
+  for (size_t k = 0; k < 2000; k++) pixels.emplace_back(u(rng), v(rng));
+  cout << "NOTE: Times are reported for " << nrFrames << " frames of "
+       << pixels.size() << " features" << endl;
+
+  {
+    gttic_(Cal3DS2);
+    timeCalibration(Cal3DS2(500, 480, 0.1, 320, 240, -0.1, 0.01, 1e-3, 2e-3),
+                    pixels);
+  }
+  {
+    gttic_(Cal3Fisheye);
+    timeCalibration(
+        Cal3Fisheye(400, 410, 0.1, 320, 240, -0.0137, 0.0023, -1e-4, 1e-5),
+        pixels);
+  }
+  {
+    gttic_(Cal3Unified);
+    timeCalibration(
+        Cal3Unified(400, 410, 0.1, 320, 240, 1e-3, 2e-3, 3e-3, 4e-3, 0.1),
+        pixels);
+  }
+
+  tictoc_print_();
+  return 0;
+}
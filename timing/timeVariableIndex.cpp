@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeVariableIndex.cpp
+ * @brief   Time VariableIndex vs FlatVariableIndex on a 1M-factor graph,
+ *          for batch construction and for iSAM2-style incremental updates.
+ * @date    October 2026
+ */
+
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/inference/FlatVariableIndex.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/inference/VariableIndex.h>
+#include <gtsam/symbolic/SymbolicFactorGraph.h>
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::L;
+using symbol_shorthand::X;
+
+/**
+ * Pose graph with landmarks: odometry between consecutive poses, and every
+ * pose observes a few landmarks. Landmark keys sort before pose keys, so new
+ * landmarks fall in the middle of the key range.
+ */
+SymbolicFactorGraph createUpdate(size_t pose, size_t nrLandmarks,
+                                 std::mt19937* rng) {
+  std::uniform_int_distribution<size_t> landmark(0, nrLandmarks - 1);
+  SymbolicFactorGraph graph;
+  if (pose > 0) graph.push_factor(X(pose - 1), X(pose));
+  for (size_t k = 0; k < 3; k++) graph.push_factor(X(pose), L(landmark(*rng)));
+  return graph;
+}
+
+int main(int argc, char* argv[]) {
+  const size_t nrPoses = 250000, nrLandmarks = 50000;  // ~1M factors
+  const size_t nrUpdates = 1000;
+
+  std::mt19937 rng(42);
+  SymbolicFactorGraph graph;
+  for (size_t i = 0; i < nrPoses; i++)
+    graph.push_back(createUpdate(i, nrLandmarks, &rng));
+  cout << "Graph with " << graph.size() << " factors" << endl;
+
+  VariableIndex variableIndex;
+  FlatVariableIndex flatVariableIndex;
+  {
+    gttic_(VariableIndex_batch);
+    variableIndex = VariableIndex(graph);
+  }
+  {
+    gttic_(FlatVariableIndex_batch);
+    flatVariableIndex = FlatVariableIndex(graph);
+  }
+
+  // Incremental updates that add a pose and a new landmark, then remove and
+  // re-add the new factors, as iSAM2 does with relinearized factors.
+  size_t nrFactors = graph.size();
+  for (size_t i = 0; i < nrUpdates; i++) {
+    const size_t pose = nrPoses + i;
+    SymbolicFactorGraph update = createUpdate(pose, nrLandmarks, &rng);
+    update.push_factor(X(pose), L(nrLandmarks + i));  // new landmark
+    FactorIndices newIndices(update.size());
+    for (size_t k = 0; k < newIndices.size(); k++)
+      newIndices[k] = nrFactors++;
+
+    {
+      gttic_(VariableIndex_update);
+      variableIndex.augment(update, newIndices);
+      variableIndex.remove(newIndices.begin(), newIndices.end(), update);
+      variableIndex.augment(update, newIndices);
+    }
+    {
+      gttic_(FlatVariableIndex_update);
+      flatVariableIndex.augment(update, newIndices);
+      flatVariableIndex.remove(newIndices.begin(), newIndices.end(), update);
+      flatVariableIndex.augment(update, newIndices);
+    }
+    tictoc_finishedIteration_();
+  }
+
+  if (!assert_equal(FlatVariableIndex(variableIndex), flatVariableIndex))
+    cout << "FlatVariableIndex and VariableIndex disagree!" << endl;
+
+  tictoc_print_();
+  return 0;
+}